@@ -9,6 +9,15 @@
 
 namespace neml {
 
+/// Distances, in doubles, between consecutive crystals in the batch arrays
+//    A zero stride shares a single d or w between all the crystals
+struct CrystalBatchStrides {
+  size_t d;
+  size_t w;
+  size_t s;
+  size_t h;
+};
+
 NEML_EXPORT void evaluate_crystal_batch(SingleCrystalModel & model, size_t n,
                            const double * const d_np1, const double * const d_n,
                            const double * const w_np1, const double * const w_n,
@@ -20,6 +29,21 @@ NEML_EXPORT void evaluate_crystal_batch(SingleCrystalModel & model, size_t n,
                            double * const u_np1, const double * const u_n,
                            double * const p_np1, const double * const p_n,
                            int nthreads = 1);
+/// Same, but with arbitrary strides between the crystals
+//    Without advance_decoupled the decoupled history in h_np1 must already
+//    be advanced, e.g. once for all the crystals of a polycrystal
+NEML_EXPORT void evaluate_crystal_batch(SingleCrystalModel & model, size_t n,
+                           const CrystalBatchStrides & strides,
+                           const double * const d_np1, const double * const d_n,
+                           const double * const w_np1, const double * const w_n,
+                           const double * const T_np1, const double * const T_n,
+                           double t_np1, double t_n,
+                           double * const s_np1, const double * const s_n,
+                           double * const h_np1, const double * const h_n,
+                           double * const A_np1, double * const B_np1,
+                           double * const u_np1, const double * const u_n,
+                           double * const p_np1, const double * const p_n,
+                           int nthreads = 1, bool advance_decoupled = true);
 NEML_EXPORT void init_history_batch(SingleCrystalModel & model, size_t n, double * const hist);
 NEML_EXPORT void set_orientation_passive_batch(SingleCrystalModel & model, size_t n,
                                   double * const hist,
@@ -27,6 +51,13 @@ NEML_EXPORT void set_orientation_passive_batch(SingleCrystalModel & model, size_
 NEML_EXPORT void get_orientation_passive_batch(SingleCrystalModel & model, size_t n,
                                   double * const hist,
                                   std::vector<Orientation> & orientations);
+NEML_EXPORT void set_orientation_passive_batch(SingleCrystalModel & model, size_t n,
+                                  double * const hist,
+                                  const double * const q);
+/// Histories are stride apart, or packed if zero
+NEML_EXPORT void get_orientation_passive_batch(SingleCrystalModel & model, size_t n,
+                                  const double * const hist,
+                                  double * const q, size_t stride = 0);
 
 } // namespace neml
 
@@ -39,6 +39,9 @@ class NEML_EXPORT SymmetryGroup: public NEMLObject {
 
   /// Find the disorientation in a blocked way that trades memory for cpu
   std::vector<Orientation> misorientation_block(const std::vector<Orientation> & A, const std::vector<Orientation> & B);
+  /// The blocked disorientation for n contiguous quaternions (n x 4)
+  void misorientation_block(size_t n, const double * const A,
+                            const double * const B, double * const res);
 
  private:
   const std::vector<Orientation> ops_;
@@ -49,40 +52,49 @@ static Register<SymmetryGroup> regSymmetryGroup;
 
 std::shared_ptr<SymmetryGroup> get_group(std::string);
 
+/// Crystal lattice and slip/twin system geometry
+//    The geometry is immutable once the systems are added and is shared
+//    between copies of a Lattice, so copying a Lattice is cheap.  Each copy
+//    keeps its own cache of the slip tensors rotated to the last requested
+//    orientation, so models give each thread of execution its own copy.
 class NEML_EXPORT Lattice {
  public:
   /// Initialize with the three lattice vectors, the symmetry group and
   /// (optionally) a initial list of slip systems
   Lattice(Vector a1, Vector a2, Vector a3, std::shared_ptr<SymmetryGroup> symmetry,
           list_systems isystems = {}, twin_systems tsystems = {});
+  /// Copy, sharing the geometry and keeping any cached rotation
+  Lattice(const Lattice & other);
+  /// Assign, sharing the geometry and keeping any cached rotation
+  Lattice & operator=(const Lattice & other);
   virtual ~Lattice() {}; // clang??
 
   /// Type: slip or twin
   enum SlipType {Slip=0, Twin=1};
 
   /// First lattice vector
-  const Vector & a1() {return a1_;};
+  const Vector & a1() const;
   /// Second lattice vector
-  const Vector & a2() {return a2_;};
+  const Vector & a2() const;
   /// Third lattice vector
-  const Vector & a3() {return a3_;};
+  const Vector & a3() const;
   /// First reciprocal vector
-  const Vector & b1() {return b1_;};
+  const Vector & b1() const;
   /// Second reciprocal vector
-  const Vector & b2() {return b2_;};
+  const Vector & b2() const;
   /// Third reciprocal vector
-  const Vector & b3() {return b3_;};
+  const Vector & b3() const;
 
   /// Return the list of burgers vectors
-  const std::vector<std::vector<Vector>> & burgers_vectors() {return burgers_vectors_;};
+  const std::vector<std::vector<Vector>> & burgers_vectors() const;
   /// Return the list of normalized slip directions
-  const std::vector<std::vector<Vector>> & slip_directions() {return slip_directions_;};
+  const std::vector<std::vector<Vector>> & slip_directions() const;
   /// Return the list of normalized slip normals
-  const std::vector<std::vector<Vector>> & slip_planes() {return slip_planes_;};
+  const std::vector<std::vector<Vector>> & slip_planes() const;
   /// Return the list of characteristic shears
-  const std::vector<double> characteristic_shears() {return shear_;}; 
+  const std::vector<double> characteristic_shears() const;
   /// Return the list of slip system types
-  const std::vector<SlipType> & slip_types() {return slip_types_;};
+  const std::vector<SlipType> & slip_types() const;
 
   /// Convert Miller directions to cartesian vectors
   virtual Vector miller2cart_direction(std::vector<int> m);
@@ -135,7 +147,7 @@ class NEML_EXPORT Lattice {
                     stress);
 
   /// Access the symmetry operations
-  const std::shared_ptr<SymmetryGroup> symmetry();
+  const std::shared_ptr<SymmetryGroup> symmetry() const;
 
   /// Return a list of Cartesian vectors giving the unique slip planes
   const std::vector<Vector> unique_planes() const;
@@ -146,40 +158,35 @@ class NEML_EXPORT Lattice {
   /// Given the unique slip plane index return the vector of (g,i) tuples
   std::vector<std::pair<size_t,size_t>> plane_systems(size_t i) const;
 
+ protected:
+  /// Slip systems as added, for serialization
+  const list_systems & current_slip_() const;
+  /// Twin systems as added, for serialization
+  const twin_systems & current_twin_() const;
+
  private:
+  struct Geometry;
+
   void make_reciprocal_lattice_();
   static void assert_miller_(std::vector<int> m);
 
-  void cache_rot_(const Orientation & Q);
-
-  void update_normals_(const std::vector<Vector> & new_planes);
+  Geometry & modify_();
+  void add_group_(SlipType type, double shear,
+                  const std::vector<Vector> & burgers,
+                  const std::vector<Vector> & directions,
+                  const std::vector<Vector> & normals,
+                  const std::vector<Orientation> & reorientations);
 
- protected:
-  list_systems current_slip_;
-  twin_systems current_twin_;
+  void cache_rot_(const Orientation & Q);
 
  private:
-  Vector a1_, a2_, a3_, b1_, b2_, b3_;
-  const std::shared_ptr<SymmetryGroup> symmetry_;
-
-  std::vector<std::vector<Vector>> burgers_vectors_;
-  std::vector<std::vector<Vector>> slip_directions_;
-  std::vector<std::vector<Vector>> slip_planes_;
-  std::vector<SlipType> slip_types_;
-  std::vector<double> shear_;
-  std::vector<std::vector<Orientation>> reorientations_;
+  std::shared_ptr<const Geometry> geometry_;
 
-  std::vector<size_t> offsets_;
-
-  // Used for caching common asks
+  // Used for caching common asks, indexed by the flat system number
   bool setup_;
   size_t hash_;
-  std::vector<std::vector<Symmetric>> Ms_;
-  std::vector<std::vector<Skew>> Ns_;
-
-  // Used for the normal damage system
-  std::vector<Vector> normals_;
-  std::vector<std::vector<size_t>> normal_map_;
+  std::vector<Symmetric> Ms_;
+  std::vector<Skew> Ns_;
 };
 
 class NEML_EXPORT CubicLattice: public NEMLObject, public Lattice {
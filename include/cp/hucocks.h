@@ -8,8 +8,25 @@
 
 #include "../windows.h"
 
+#include <vector>
+
 namespace neml {
 
+/// Temperature dependent terms of a HuCocksPrecipitationModel
+//  These only change with temperature, so callers keep one around and share
+//  it between every evaluation at the same temperature.  The terms are packed
+//  in one array, starting with the temperature they were evaluated at, so
+//  they can also be stored in the fixed history for a whole substep
+struct HuCocksTemperatureTerms
+{
+  /// Temperature, diffusivity, Boltzmann constant times temperature,
+  //  product of the equilibrium concentrations, nucleation and ripening
+  //  prefactors (multiplied by the rate species concentration), growth
+  //  prefactor, then the initial, precipitate, and equilibrium
+  //  concentrations of each species
+  std::vector<double> data;
+};
+
 /// Implementation of a single chemistry <-> size model
 //  For details see Hu et al. MSE A, 2020
 class NEML_EXPORT HuCocksPrecipitationModel: public NEMLObject
@@ -49,6 +66,38 @@ class NEML_EXPORT HuCocksPrecipitationModel: public NEMLObject
   /// Jacobian matrix
   std::vector<std::vector<double>> jac(const History & history, double T) const;
 
+  /// Rate of the scaled state x = (f/fs, r/rs, N/Ns), fixed size (3)
+  void scaled_rate(const double * const x, double T,
+                   double * const xdot) const;
+
+  /// Jacobian of the scaled rate, fixed size row-major (3x3)
+  void scaled_jac(const double * const x, double T, double * const J) const;
+
+  /// Number of packed temperature dependent terms
+  size_t nterms() const;
+
+  /// Fill in the temperature dependent terms, unless already set for T
+  void temperature_terms(double T, HuCocksTemperatureTerms & terms) const;
+
+  /// All the scaled rates and (if J is not null) the Jacobian in one pass
+  void scaled_evaluate(const double * const x,
+                       const HuCocksTemperatureTerms & terms,
+                       double * const xdot, double * const J) const;
+  /// Same, with the packed terms (nterms) stored elsewhere
+  void scaled_evaluate(const double * const x, const double * const terms,
+                       double * const xdot, double * const J) const;
+
+  /// Sum of the concentrations and its derivative wrt f, without allocating
+  void c_sum(double f, double T, double & cs, double & dcs) const;
+  /// Same, with the packed temperature dependent terms
+  void c_sum(double f, const double * const terms, double & cs,
+             double & dcs) const;
+
+  /// Backward Euler step of the scaled state at constant temperature
+  void integrate(double * const x_np1, const double * const x_n,
+                 const HuCocksTemperatureTerms & terms, double dt,
+                 double rtol, double atol, int miter) const;
+
   /// The volume fraction rate
   virtual double f_rate(double f, double r, double N, double T) const;
 
@@ -116,59 +165,9 @@ class NEML_EXPORT HuCocksPrecipitationModel: public NEMLObject
   /// Diffusivity
   double D_(double T) const;
 
-  /// Check to see if we're still in the nucleation regime
-  bool nucleation_(const std::vector<double> & c, double T) const;
-
-  /// Indicator function for nucleation/ripening
-  void sfn_(double f, double T, double & val, double & dval) const;
-
-  /// The radius rate in the nucleation regime
-  virtual double r_rate_nucleation_(double f, double r, double N, double T) const;
-
-  /// dr_df in the nucleation regime
-  virtual double dr_df_nucleation_(double f, double r, double N, double T) const;
-
-  /// dr_dr in the nucleation regime
-  virtual double dr_dr_nucleation_(double f, double r, double N, double T) const;
-
-  /// dr_dN in the nucleation regime
-  virtual double dr_dN_nucleation_(double f, double r, double N, double T) const;
-
-  /// The radius rate in the ripening regime
-  virtual double r_rate_ripening_(double f, double r, double N, double T) const;
-
-  /// dr_df in the ripening regime
-  virtual double dr_df_ripening_(double f, double r, double N, double T) const;
-
-  /// dr_dr in the ripening regime
-  virtual double dr_dr_ripening_(double f, double r, double N, double T) const;
-
-  /// dr_dN in the ripening regime
-  virtual double dr_dN_ripening_(double f, double r, double N, double T) const;
-
-  /// The number density rate in the nucleation regime
-  virtual double N_rate_nucleation_(double f, double r, double N, double T) const;
-
-  /// dN_df in the nucleation regime
-  virtual double dN_df_nucleation_(double f, double r, double N, double T) const;
-
-  /// dN_dr in the nucleation regime
-  virtual double dN_dr_nucleation_(double f, double r, double N, double T) const;
-
-  /// dN_dN in the nucleation regime
-  virtual double dN_dN_nucleation_(double f, double r, double N, double T) const;
-
-  /// The number density rate in the ripening regime
-  virtual double N_rate_ripening_(double f, double r, double N, double T) const;
-
-  /// dN_df in the ripening regime
-  virtual double dN_df_ripening_(double f, double r, double N, double T) const;
-
-  /// dN_dr in the ripening regime
-  virtual double dN_dr_ripening_(double f, double r, double N, double T) const;
-
-  /// dN_dN in the ripening regime
-  virtual double dN_dN_ripening_(double f, double r, double N, double T) const;
+  /// The unscaled rates and (if J is not null) Jacobian, via scaled_evaluate
+  void unscaled_evaluate_(double f, double r, double N, double T,
+                          double * const rates, double * const J) const;
 
  private:
   std::vector<std::shared_ptr<Interpolate>> c0_;
@@ -265,6 +264,9 @@ static Register<DislocationSpacingHardening> regDislocationSpacingHardening;
 
 /// Full Hu and Cocks hardening model
 //    See Hu and Cocks, 2020 for more details
+//    The precipitation kinetics only depend on temperature, so with
+//    decouple_precipitation they are integrated once per step outside of the
+//    crystal solve and read from the fixed history instead
 class NEML_EXPORT HuCocksHardening: public SlipHardening
 {
  public:
@@ -325,9 +327,32 @@ class NEML_EXPORT HuCocksHardening: public SlipHardening
                      const History & fixed,
                      std::vector<std::string> ext) const;
 
+  /// Precipitation variables, if integrated outside of the crystal update
+  virtual void populate_decoupled(History & history) const;
+  /// Initialize the decoupled precipitation variables
+  virtual void init_decoupled(History & history) const;
+  /// Integrate the decoupled precipitation variables over the step
+  virtual void update_decoupled(History & fixed_np1, const History & fixed_n,
+                                double T_np1, double T_n,
+                                double t_np1, double t_n) const;
+  /// Add anything that stays fixed over a substep at temperature T
+  virtual void populate_fixed(History & fixed, double T) const;
+
  protected:
-  double c_eff_(const History & history, double T) const;
+  /// Packed temperature terms of precipitation model i, from fixed if
+  //  stored there for T and otherwise evaluated into scratch
+  const double * terms_(size_t i, const History & fixed, double T,
+                        HuCocksTemperatureTerms & scratch) const;
+  double c_eff_(const History & history, const History & fixed,
+                double T) const;
   double NA_eff_(const History & history, double T) const;
+  /// Where the precipitation variables live, history or fixed
+  const History & precipitation_(const History & history,
+                                 const History & fixed) const;
+  /// Backward Euler with adaptive substeps for precipitation model i
+  void integrate_precipitation_(size_t i, double * const x_np1,
+                                const double * const x_n, double T_np1,
+                                double T_n, double dt) const;
 
  private:
   std::shared_ptr<SlipHardening> dmodel_;
@@ -335,6 +360,10 @@ class NEML_EXPORT HuCocksHardening: public SlipHardening
   double ap_, ac_, b_;
   std::shared_ptr<Interpolate> G_;
   std::vector<std::vector<std::string>> pnames_;
+  std::vector<std::vector<std::string>> tnames_;
+  bool decouple_;
+  double rtol_, atol_;
+  int miter_, max_divide_;
 };
 
 static Register<HuCocksHardening> regHuCocksHardening;
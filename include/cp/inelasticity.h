@@ -82,6 +82,17 @@ class NEML_EXPORT InelasticModel: public NEMLObject {
                                   Lattice & lattice,
                                   double T, const History & fixed) const = 0;
 
+  /// Request any history integrated outside of the crystal update
+  virtual void populate_decoupled(History & history) const;
+  /// Setup the history integrated outside of the crystal update
+  virtual void init_decoupled(History & history) const;
+  /// Advance the history integrated outside of the crystal update
+  virtual void update_decoupled(History & fixed_np1, const History & fixed_n,
+                                double T_np1, double T_n,
+                                double t_np1, double t_n) const;
+  /// Add anything that stays fixed over a substep at temperature T
+  virtual void populate_fixed(History & fixed, double T) const;
+
   /// Whether this model uses the nye tensor
   virtual bool use_nye() const;
 };
@@ -251,6 +262,17 @@ class NEML_EXPORT AsaroInelasticity: public InelasticModel {
                                   double T,
                                   const History & fixed) const;
 
+  /// Request any history integrated outside of the crystal update
+  virtual void populate_decoupled(History & history) const;
+  /// Setup the history integrated outside of the crystal update
+  virtual void init_decoupled(History & history) const;
+  /// Advance the history integrated outside of the crystal update
+  virtual void update_decoupled(History & fixed_np1, const History & fixed_n,
+                                double T_np1, double T_n,
+                                double t_np1, double t_n) const;
+  /// Add anything that stays fixed over a substep at temperature T
+  virtual void populate_fixed(History & fixed, double T) const;
+
   /// Whether this model uses the Nye tensor
   virtual bool use_nye() const;
 
@@ -439,6 +461,17 @@ class NEML_EXPORT CombinedInelasticity: public InelasticModel {
                                   Lattice & lattice,
                                   double T, const History & fixed) const;
 
+  /// Request any history integrated outside of the crystal update
+  virtual void populate_decoupled(History & history) const;
+  /// Setup the history integrated outside of the crystal update
+  virtual void init_decoupled(History & history) const;
+  /// Advance the history integrated outside of the crystal update
+  virtual void update_decoupled(History & fixed_np1, const History & fixed_n,
+                                double T_np1, double T_n,
+                                double t_np1, double t_n) const;
+  /// Add anything that stays fixed over a substep at temperature T
+  virtual void populate_fixed(History & fixed, double T) const;
+
   /// Whether this model uses the Nye tensor
   virtual bool use_nye() const;
 
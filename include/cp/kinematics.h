@@ -151,7 +151,17 @@ class NEML_EXPORT KinematicModel: public NEMLObject {
                                      Lattice & lattice,
                                      const Orientation & Q,
                                      const History & history,
-                                     double T) = 0;
+                                     double T,
+                                     const History & fixed) = 0;
+
+  /// Request any history integrated outside of the crystal update
+  virtual void populate_decoupled(History & history) const;
+  /// Setup the history integrated outside of the crystal update
+  virtual void init_decoupled(History & history) const;
+  /// Advance the history integrated outside of the crystal update
+  virtual void update_decoupled(History & fixed_np1, const History & fixed_n,
+                                double T_np1, double T_n,
+                                double t_np1, double t_n) const;
 
   /// Whether this model uses the Nye tensor
   virtual bool use_nye() const;
@@ -279,12 +289,27 @@ class NEML_EXPORT StandardKinematicModel: public KinematicModel {
                                      Lattice & lattice,
                                      const Orientation & Q,
                                      const History & history,
-                                     double T);
+                                     double T,
+                                     const History & fixed);
+
+  /// Request any history integrated outside of the crystal update
+  virtual void populate_decoupled(History & history) const;
+  /// Setup the history integrated outside of the crystal update
+  virtual void init_decoupled(History & history) const;
+  /// Advance the history integrated outside of the crystal update
+  virtual void update_decoupled(History & fixed_np1, const History & fixed_n,
+                                double T_np1, double T_n,
+                                double t_np1, double t_n) const;
 
   /// Whether this model uses the Nye tensor
   virtual bool use_nye() const;
 
  protected:
+  /// Rotated stiffness, reusing the copy decouple stores in fixed
+  SymSymR4 C_(double T, const Orientation & Q, const History & fixed) const;
+  /// Rotated compliance, reusing the copy decouple stores in fixed
+  SymSymR4 S_(double T, const Orientation & Q, const History & fixed) const;
+
   std::shared_ptr<LinearElasticModel> emodel_;
   std::shared_ptr<InelasticModel> imodel_;
 };
@@ -383,7 +408,8 @@ class NEML_EXPORT DamagedStandardKinematicModel: public StandardKinematicModel {
                                      Lattice & lattice,
                                      const Orientation & Q,
                                      const History & history,
-                                     double T);
+                                     double T,
+                                     const History & fixed);
 
  protected:
   /// Names of the inelastic model internal variables
@@ -3,25 +3,37 @@
 #include "../models.h"
 #include "../math/rotations.h"
 #include "singlecrystal.h"
+#include "batch.h"
 
 #include "../windows.h"
 
 namespace neml {
 
 /// Generic superclass
+//    Each crystal stores its history and stress and, only if the model
+//    gives the crystals different deformations, its own d and w.
+//    The "blocked" layout stores all the histories, then all the stresses,
+//    and so on.  The "interleaved" layout stores everything for one crystal
+//    together, padded to a multiple of 8 doubles (a 64 byte cache line).
+//    History the crystal model integrates outside of its stress update,
+//    like HuCocks precipitation, is stored once after the crystals,
+//    advanced once per step, and copied into every crystal as fixed history.
 class NEML_EXPORT PolycrystalModel: public NEMLModel_ldi
 {
  public:
-  PolycrystalModel(ParameterSet & params);
+  PolycrystalModel(ParameterSet & params, bool grain_deformation = false);
 
-  size_t n() const;
+  /// Number of crystals integrated and stored
+  virtual size_t n() const;
 
   virtual size_t nhist() const;
   virtual void init_hist(double * const hist) const;
 
   double * history(double * const store, size_t i) const;
   double * stress(double * const store, size_t i) const;
+  /// Only stored with per crystal deformations, throws otherwise
   double * d(double * const store, size_t i) const;
+  /// Only stored with per crystal deformations, throws otherwise
   double * w(double * const store, size_t i) const;
 
   const double * history(const double * const store, size_t i) const;
@@ -29,12 +41,45 @@ class NEML_EXPORT PolycrystalModel: public NEMLModel_ldi
   const double * d(const double * const store, size_t i) const;
   const double * w(const double * const store, size_t i) const;
 
+  /// Size of the history shared by all the crystals
+  size_t nshared() const;
+  /// History shared by all the crystals (SingleCrystalModel::ndecoupled)
+  double * shared(double * const store) const;
+  const double * shared(const double * const store) const;
+
+  /// Strides between the crystals, with zero for a shared d and w
+  CrystalBatchStrides strides() const;
+  /// Is the storage interleaved by crystal
+  bool interleaved() const;
+
   virtual std::vector<Orientation> orientations(double * const store) const;
+  /// Current passive orientations as contiguous quaternions (n x 4)
+  virtual void orientations(const double * const store, 
+                            double * const q) const;
+
+ private:
+  size_t history_offset_(size_t i) const;
+  size_t stress_offset_(size_t i) const;
+  size_t d_offset_(size_t i) const;
+  size_t w_offset_(size_t i) const;
+
+ protected:
+  /// Start the shared history from that of the first crystal
+  void init_shared_(double * const hist) const;
+  /// Advance the shared history and copy it into crystals [0, nc)
+  void update_shared_(double * const h_np1, const double * const h_n,
+                      double T_np1, double T_n, double t_np1, double t_n,
+                      size_t nc) const;
 
  protected:
   std::shared_ptr<SingleCrystalModel> model_;
   const std::vector<std::shared_ptr<Orientation>> q0s_;
   int nthreads_;
+
+ private:
+  bool grain_deformation_;
+  bool interleaved_;
+  size_t block_;
 };
 
 class NEML_EXPORT TaylorModel: public PolycrystalModel
@@ -65,6 +110,8 @@ class NEML_EXPORT TaylorModel: public PolycrystalModel
      double & p_np1, double p_n);
 
   virtual double alpha(double T) const;
+  virtual void alpha(const double * const T, double * const a,
+                     size_t n) const;
   virtual void elastic_strains(const double * const s_np1,
                               double T_np1, const double * const h_np1,
                               double * const e_np1) const;
@@ -72,4 +119,159 @@ class NEML_EXPORT TaylorModel: public PolycrystalModel
 
 static Register<TaylorModel> regTaylorModel;
 
+/// Reduced order Taylor model integrating only representative grains
+//    The initial orientations are clustered by disorientation and only one
+//    crystal per cluster is integrated, weighted by the cluster size.
+//    With adaptive each cluster also integrates a probe, its member furthest
+//    from the representative, and splits in two when the probe's stress
+//    diverges from the representative's
+class NEML_EXPORT ClusteredTaylorModel: public PolycrystalModel
+{
+ public:
+  ClusteredTaylorModel(ParameterSet & params);
+
+  /// Type for the object system
+  static std::string type();
+  /// Parameters for the object system
+  static ParameterSet parameters();
+  /// Setup from a ParameterSet
+  static std::unique_ptr<NEMLObject> initialize(ParameterSet & params);
+
+  /// The cluster slots, followed by their probes if adaptive
+  virtual size_t n() const;
+
+  virtual size_t nhist() const;
+  virtual void init_hist(double * const hist) const;
+
+  virtual size_t nstore() const;
+  virtual void init_store(double * const store) const;
+
+  /// Large strain incremental update
+  virtual void update_ld_inc(
+     const double * const d_np1, const double * const d_n,
+     const double * const w_np1, const double * const w_n,
+     double T_np1, double T_n,
+     double t_np1, double t_n,
+     double * const s_np1, const double * const s_n,
+     double * const h_np1, const double * const h_n,
+     double * const A_np1, double * const B_np1,
+     double & u_np1, double u_n,
+     double & p_np1, double p_n);
+
+  virtual double alpha(double T) const;
+  virtual void alpha(const double * const T, double * const a,
+                     size_t n) const;
+  virtual void elastic_strains(const double * const s_np1,
+                              double T_np1, const double * const h_np1,
+                              double * const e_np1) const;
+
+  /// Maximum number of clusters
+  size_t capacity() const;
+  /// Number of active clusters
+  size_t nclusters(const double * const store) const;
+  /// Weight of each cluster slot, zero if not active
+  std::vector<double> weights(const double * const store) const;
+  /// Cluster of each of the initial orientations
+  std::vector<size_t> membership(const double * const store) const;
+
+  /// Disorientation distance between two of the initial orientations
+  double distance(size_t i, size_t j) const;
+
+ private:
+  double * clusters_(double * const store) const;
+  const double * clusters_(const double * const store) const;
+  void cluster_(size_t k);
+  size_t furthest_(const double * const clusters, size_t c) const;
+  void init_probe_(double * const store, size_t c) const;
+  void split_(double * const store, size_t c) const;
+
+ private:
+  bool adaptive_;
+  double split_tol_;
+  int iterations_;
+  size_t ninitial_, nclusters_, capacity_;
+  size_t nops_;
+  std::vector<double> equivalents_;
+  std::vector<size_t> members_, representatives_;
+};
+
+static Register<ClusteredTaylorModel> regClusteredTaylorModel;
+
+/// Self-consistent model with an isotropic interaction law
+//    Each grain finds its own deformation increment D_i so that
+//        sigma_i + L* D_i = sigma + L* D
+//    where sigma is the average stress, D the macroscale increment, and L*
+//    Hill's constraint tensor for a spherical grain embedded in the
+//    isotropic projection of the effective tangent.  The effective tangent
+//    starts from the one stored from the previous step.  For a fixed
+//    interaction each Newton iteration solves the grains' linearized
+//    equations in parallel, with the average stress from the constraint
+//    on the mean increment.  Then the effective tangent is updated for the
+//    converged grain tangents, a fixed point accelerated by Anderson
+//    mixing, repeating the grain solve if the tangent changed by more
+//    than tangent_rtol.  That outer iteration on the tangent is mixed the
+//    same way, and either one failing to converge in miter iterations
+//    throws a NonlinearSolverError.  The returned A_np1 is the secant
+//    self-consistent modulus L, which neglects the change of L* with the
+//    deformation.
+class NEML_EXPORT SelfConsistentModel: public PolycrystalModel
+{
+ public:
+  SelfConsistentModel(ParameterSet & params);
+
+  /// Type for the object system
+  static std::string type();
+  /// Parameters for the object system
+  static ParameterSet parameters();
+  /// Setup from a ParameterSet
+  static std::unique_ptr<NEMLObject> initialize(ParameterSet & params);
+
+  virtual size_t nhist() const;
+  virtual void init_hist(double * const hist) const;
+
+  virtual size_t nstore() const;
+  virtual void init_store(double * const store) const;
+
+  /// Large strain incremental update
+  virtual void update_ld_inc(
+     const double * const d_np1, const double * const d_n,
+     const double * const w_np1, const double * const w_n,
+     double T_np1, double T_n,
+     double t_np1, double t_n,
+     double * const s_np1, const double * const s_n,
+     double * const h_np1, const double * const h_n,
+     double * const A_np1, double * const B_np1,
+     double & u_np1, double u_n,
+     double & p_np1, double p_n);
+
+  virtual double alpha(double T) const;
+  virtual void alpha(const double * const T, double * const a,
+                     size_t n) const;
+  virtual void elastic_strains(const double * const s_np1,
+                              double T_np1, const double * const h_np1,
+                              double * const e_np1) const;
+
+  /// Grain evaluations (self-consistent iterations) in the last step
+  size_t iterations(const double * const store) const;
+  /// Effective tangent from the last step (6 x 6)
+  void effective_tangent(const double * const store, 
+                         double * const L) const;
+
+  /// Hill's constraint tensor for the isotropic projection of L
+  static void interaction(const double * const L, double * const Ls);
+
+ private:
+  void self_consistent_tangent_(const double * const A, 
+                                double * const L) const;
+  double * extra_(double * const store) const;
+  const double * extra_(const double * const store) const;
+
+ private:
+  double rtol_, atol_, tangent_rtol_;
+  int miter_;
+  size_t depth_;
+};
+
+static Register<SelfConsistentModel> regSelfConsistentModel;
+
 }
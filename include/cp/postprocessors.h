@@ -19,10 +19,17 @@ class NEML_EXPORT CrystalPostprocessor: public NEMLObject {
   virtual void populate_history(const Lattice & L, History & history) const = 0;
   virtual void init_history(const Lattice & L, History & history) const = 0;
 
+  /// Resolve the history entries act uses into offsets in the full crystal
+  /// history layout, done once when the crystal model is setup
+  virtual std::vector<size_t> resolve_layout(const Lattice & L,
+                                             const History & layout) const = 0;
+
+  /// Act on the raw crystal history, with the offsets from resolve_layout
   virtual void act(SingleCrystalModel & model, const Lattice &,
                    const double & T, const Symmetric & D,
-                   const Skew & W, History & state,
-                   const History & prev_state) = 0;
+                   const Skew & W, double * const state,
+                   const double * const prev_state,
+                   const std::vector<size_t> & slots) = 0;
 };
 
 /// Reorients twins based on a PTR criteria
@@ -40,10 +47,16 @@ class NEML_EXPORT PTRTwinReorientation: public CrystalPostprocessor {
   virtual void populate_history(const Lattice & L, History & history) const;
   virtual void init_history(const Lattice & L, History & history) const;
 
+  /// The twinned flag followed by the slip and twin fraction offsets of
+  /// each twin system
+  virtual std::vector<size_t> resolve_layout(const Lattice & L,
+                                             const History & layout) const;
+
   virtual void act(SingleCrystalModel & model, const Lattice &,
                    const double & T, const Symmetric & D,
-                   const Skew & W, History & state,
-                   const History & prev_state);
+                   const Skew & W, double * const state,
+                   const double * const prev_state,
+                   const std::vector<size_t> & slots);
 
  private:
     std::shared_ptr<Interpolate> threshold_;
@@ -82,6 +82,27 @@ class NEML_EXPORT SingleCrystalModel: public NEMLModel_ldi, public Solvable
        double & u_np1, double u_n,
        double & p_np1, double p_n);
 
+  /// Same update, but with the decoupled history already advanced in h_np1
+  void update_ld_inc_decoupled(
+       const double * const d_np1, const double * const d_n,
+       const double * const w_np1, const double * const w_n,
+       double T_np1, double T_n,
+       double t_np1, double t_n,
+       double * const s_np1, const double * const s_n,
+       double * const h_np1, const double * const h_n,
+       double * const A_np1, double * const B_np1,
+       double & u_np1, double u_n,
+       double & p_np1, double p_n);
+
+  /// Number of history variables the kinematic model integrates itself
+  size_t ndecoupled() const;
+  /// Offset of the (contiguous) decoupled history in the raw history
+  size_t decoupled_location() const;
+  /// Advance only the decoupled history, packed as in decoupled_location
+  void update_decoupled(double * const dec_np1, const double * const dec_n,
+                        double T_np1, double T_n,
+                        double t_np1, double t_n) const;
+
   /// Number of stored history variables
   virtual size_t nhist() const;
   /// Initialize history raw pointer array
@@ -89,6 +110,9 @@ class NEML_EXPORT SingleCrystalModel: public NEMLModel_ldi, public Solvable
 
   /// Instantaneous CTE
   virtual double alpha(double T) const;
+  /// The CTE at n temperatures
+  virtual void alpha(const double * const T, double * const a,
+                     size_t n) const;
 
   /// Helper to calculate the elastic strain
   virtual void elastic_strains(const double * const s_np1,
@@ -103,6 +127,9 @@ class NEML_EXPORT SingleCrystalModel: public NEMLModel_ldi, public Solvable
   virtual void RJ(const double * const x, TrialState * ts, double * const R,
                  double * const J);
 
+  /// Symmetry group of the crystal lattice
+  std::shared_ptr<SymmetryGroup> symmetry() const;
+
   /// Get the current orientation in the active convention (raw ptr history)
   Orientation get_active_orientation(double * const hist) const;
   /// Get the current orientation in the active convention
@@ -121,6 +148,11 @@ class NEML_EXPORT SingleCrystalModel: public NEMLModel_ldi, public Solvable
   /// Set the current orientation given a passive rotation (lab to crystal)
   void set_passive_orientation(History & hist, const Orientation & q);
 
+  /// Offset of the active orientation quaternion in the raw history
+  size_t orientation_location() const;
+  /// Offset of the reference orientation quaternion in the raw history
+  size_t reference_orientation_location() const;
+
   /// Whether this model uses the nye tensor
   virtual bool use_nye() const;
 
@@ -137,14 +169,26 @@ class NEML_EXPORT SingleCrystalModel: public NEMLModel_ldi, public Solvable
        double * const h_np1, const double * const h_n,
        double * const A_np1, double * const B_np1,
        double & u_np1, double u_n,
-       double & p_np1, double p_n, int trial_type);
+       double & p_np1, double p_n, int trial_type,
+       bool advance_decoupled);
+  void update_ld_inc_(
+       const double * const d_np1, const double * const d_n,
+       const double * const w_np1, const double * const w_n,
+       double T_np1, double T_n,
+       double t_np1, double t_n,
+       double * const s_np1, const double * const s_n,
+       double * const h_np1, const double * const h_n,
+       double * const A_np1, double * const B_np1,
+       double & u_np1, double u_n,
+       double & p_np1, double p_n, bool advance_decoupled);
 
   History gather_history_(double * data) const;
   History gather_history_(const double * data) const;
   History gather_blank_history_() const;
 
   void calc_tangents_(Symmetric & S, History & H,
-                      SCTrialState * ts, double * const A, double * const B);
+                      SCTrialState * ts, const double * const J,
+                      double * const A, double * const B);
   Orientation update_rot_(Symmetric & S_np1, History & H_np1, SCTrialState * ts) const;
   double calc_energy_inc_(const Symmetric & D_np1, const Symmetric & D_n,
                           const Symmetric & S_np1, const Symmetric & S_n) const;
@@ -154,7 +198,10 @@ class NEML_EXPORT SingleCrystalModel: public NEMLModel_ldi, public Solvable
                         const Orientation & Q_n, const History & H_np1,
                         const History & H_n) const;
 
-  void solve_substep_(SCTrialState * ts, Symmetric & stress, History & hist);
+  void solve_substep_(SCTrialState * ts, Symmetric & stress, History & hist,
+                      double * const J);
+  void solve_staggered_(SCTrialState * ts, Symmetric & stress, History & hist,
+                        double * const J);
 
   std::vector<std::string> not_updated_() const;
 
@@ -174,12 +221,19 @@ class NEML_EXPORT SingleCrystalModel: public NEMLModel_ldi, public Solvable
   History stored_hist_;
 
   std::vector<std::shared_ptr<CrystalPostprocessor>> postprocessors_;
+  std::vector<std::vector<size_t>> postprocessor_slots_;
   std::vector<std::string> static_names_;
+  std::vector<std::string> decoupled_names_;
+  History decoupled_hist_;
   size_t static_size_;
 
   bool elastic_predictor_, fallback_elastic_predictor_;
   int force_divide_;
   bool elastic_predictor_first_step_;
+
+  bool staggered_;
+  int staggered_miter_;
+  size_t staggered_depth_;
 };
 
 static Register<SingleCrystalModel> regSingleCrystalModel;
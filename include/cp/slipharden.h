@@ -81,6 +81,17 @@ class NEML_EXPORT SlipHardening: public NEMLObject
                      std::vector<std::string> ext) const;
 
 
+  /// Request any history integrated outside of the crystal update
+  virtual void populate_decoupled(History & history) const;
+  /// Setup the history integrated outside of the crystal update
+  virtual void init_decoupled(History & history) const;
+  /// Advance the history integrated outside of the crystal update
+  virtual void update_decoupled(History & fixed_np1, const History & fixed_n,
+                                double T_np1, double T_n,
+                                double t_np1, double t_n) const;
+  /// Add anything that stays fixed over a substep at temperature T
+  virtual void populate_fixed(History & fixed, double T) const;
+
   /// Whether this particular model uses the Nye tensor
   virtual bool use_nye() const;
   
@@ -284,7 +295,72 @@ class NEML_EXPORT FASlipHardening: public SlipHardening
 
 static Register<FASlipHardening> regFASlipHardening;
 
+/// Interaction matrix with one coefficient per type of slip system pair
+//    The type of each pair comes from the lattice geometry:
+//      0: self
+//      1: coplanar, same slip plane
+//      2: collinear, same slip direction
+//      3: orthogonal slip directions (Hirth locks in FCC)
+//      4: glissile junction, the junction Burgers vector lies in one of the
+//         two slip planes
+//      5: sessile junction, the junction Burgers vector lies in neither
+//         plane (Lomer locks in FCC)
+//    The full matrix is still available through the SquareMatrix interface.
+//    The product groups the systems by slip plane and by slip direction,
+//    so the self, coplanar, and collinear terms and the most common of the
+//    remaining types are group sums.  Only the pairs of the other remaining
+//    types are visited one at a time.
+class NEML_EXPORT SlipInteractionMatrix: public SquareMatrix
+{
+ public:
+  SlipInteractionMatrix(ParameterSet & params);
+
+  /// String type for the object system
+  static std::string type();
+  /// Initialize from a parameter set
+  static std::unique_ptr<NEMLObject> initialize(ParameterSet & params);
+  /// Default parameters
+  static ParameterSet parameters();
+
+  /// Number of interaction types
+  static const size_t ntypes = 6;
+  /// Classify the interaction between two systems in a lattice
+  static size_t classify(Lattice & L, size_t g1, size_t i1, size_t g2,
+                         size_t i2);
+
+  /// Type of the interaction between flat systems i and j
+  size_t interaction_type(size_t i, size_t j) const
+  {return types_[i * n() + j];};
+  /// The coefficient for each type
+  const std::vector<double> & coefficients() const {return coefs_;};
+  /// Number of pairs of each type
+  std::vector<size_t> counts() const;
+
+  /// Product res = M v for a n x k block of vectors v
+  //  O((n + p) k) for the p pairs not covered by the group sums
+  void apply(const double * const v, double * const res, size_t k = 1) const;
+  /// Number of pairs the product visits one at a time
+  size_t npairs() const {return cols_.size();};
+
+ private:
+  void setup_groups_(Lattice & L);
+  void apply_pairs_(const double * const v, double * const res,
+                    size_t k) const;
+
+  std::vector<double> coefs_;
+  std::vector<unsigned char> types_;
+
+  bool grouped_;                      // False if the groups do not fit
+  size_t base_;                       // Remaining type done by group sums
+  size_t nplane_, ndir_, nboth_;      // Number of groups
+  std::vector<size_t> plane_, dir_, both_;  // Group of each system
+  std::vector<size_t> start_, cols_;  // Other pairs, row by row
+};
+
+static Register<SlipInteractionMatrix> regSlipInteractionMatrix;
+
 /// Generic linear  hardening of the form tau_i = tau_0_i + H.gamma
+//    If H is a SlipInteractionMatrix the model uses its typed product
 class NEML_EXPORT GeneralLinearHardening: public SlipHardening
 {
  public:
@@ -348,9 +424,18 @@ class NEML_EXPORT GeneralLinearHardening: public SlipHardening
  protected:
   size_t size() const {return tau_0_.size();};
   void consistency(Lattice & L) const;
+  /// res = M v for a n x k block of vectors v
+  void apply_(const double * const v, double * const res, size_t k) const;
+  /// Signed slip rates (for absval) and their history derivatives
+  void slip_derivatives_(const Symmetric & stress, const Orientation & Q,
+                         const History & history, Lattice & L, double T,
+                         const SlipRule & R, const History & fixed,
+                         std::vector<double> & sign,
+                         std::vector<History> & dslip) const;
 
  private:
   std::shared_ptr<SquareMatrix> M_;
+  std::shared_ptr<SlipInteractionMatrix> typed_;
   std::vector<double> tau_0_;
   bool absval_;
   std::string varprefix_;
@@ -697,6 +782,17 @@ class NEML_EXPORT SumSlipSingleStrengthHardening: public SlipSingleHardening
   virtual History d_hist_map(const History & history, double T,
                              const History & fixed) const;
 
+  /// Request any history integrated outside of the crystal update
+  virtual void populate_decoupled(History & history) const;
+  /// Setup the history integrated outside of the crystal update
+  virtual void init_decoupled(History & history) const;
+  /// Advance the history integrated outside of the crystal update
+  virtual void update_decoupled(History & fixed_np1, const History & fixed_n,
+                                double T_np1, double T_n,
+                                double t_np1, double t_n) const;
+  /// Add anything that stays fixed over a substep at temperature T
+  virtual void populate_fixed(History & fixed, double T) const;
+
   /// Whether this model uses the Nye tensor
   virtual bool use_nye() const;
 
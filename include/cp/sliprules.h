@@ -76,6 +76,17 @@ class NEML_EXPORT SlipRule: public NEMLObject
                   const History & history, Lattice & L, double T,
                   const History & fixed) const;
 
+  /// Request any history integrated outside of the crystal update
+  virtual void populate_decoupled(History & history) const;
+  /// Setup the history integrated outside of the crystal update
+  virtual void init_decoupled(History & history) const;
+  /// Advance the history integrated outside of the crystal update
+  virtual void update_decoupled(History & fixed_np1, const History & fixed_n,
+                                double T_np1, double T_n,
+                                double t_np1, double t_n) const;
+  /// Add anything that stays fixed over a substep at temperature T
+  virtual void populate_fixed(History & fixed, double T) const;
+
   /// Whether this model uses the Nye tensor
   virtual bool use_nye() const;
 };
@@ -132,6 +143,17 @@ class NEML_EXPORT SlipMultiStrengthSlipRule: public SlipRule
                       const Orientation & Q, const History & history,
                       Lattice & L, double T, const History & fixed) const;
 
+  /// Request any history integrated outside of the crystal update
+  virtual void populate_decoupled(History & history) const;
+  /// Setup the history integrated outside of the crystal update
+  virtual void init_decoupled(History & history) const;
+  /// Advance the history integrated outside of the crystal update
+  virtual void update_decoupled(History & fixed_np1, const History & fixed_n,
+                                double T_np1, double T_n,
+                                double t_np1, double t_n) const;
+  /// Add anything that stays fixed over a substep at temperature T
+  virtual void populate_fixed(History & fixed, double T) const;
+
   virtual bool use_nye() const;
 
   /// The slip rate on group g, system i given the resolved shear, the strength,
@@ -32,9 +32,9 @@ class NEML_EXPORT LinearElasticModel: public NEMLObject {
   SymSymR4 S(double T) const;
 
   /// The rotated stiffness tensor in a tensor object
-  SymSymR4 C(double T, const Orientation & Q) const;
+  virtual SymSymR4 C(double T, const Orientation & Q) const;
   /// The rotated compliance tensor in a tensor object
-  SymSymR4 S(double T, const Orientation & Q) const;
+  virtual SymSymR4 S(double T, const Orientation & Q) const;
 
   /// An effective shear modulus
   virtual double G(double T) const;
@@ -61,6 +61,11 @@ class NEML_EXPORT IsotropicLinearElasticModel: public LinearElasticModel {
   /// Implement the compliance tensor
   virtual void S(double T, double * const Sv) const;
 
+  /// The stiffness is isotropic, so skip the rotation
+  virtual SymSymR4 C(double T, const Orientation & Q) const;
+  /// The compliance is isotropic, so skip the rotation
+  virtual SymSymR4 S(double T, const Orientation & Q) const;
+
   /// The Young's modulus
   virtual double E(double T) const;
   /// Poisson's ratio
@@ -96,11 +101,19 @@ class NEML_EXPORT CubicLinearElasticModel: public LinearElasticModel {
 
   /// Implement the stiffness tensor
   virtual void C(double T, double * const Cv) const;
-  /// Implement the compliance tensor
+  /// Implement the compliance tensor, from the analytic inverse of C
+  //  Agrees with a numerical inverse of C to round-off, not bitwise
   virtual void S(double T, double * const Sv) const;
 
+  /// The rotated stiffness tensor, in closed form
+  virtual SymSymR4 C(double T, const Orientation & Q) const;
+  /// The rotated compliance tensor, in closed form
+  virtual SymSymR4 S(double T, const Orientation & Q) const;
+
  private:
   void get_components_(double T, double & C1, double & C2, double & C3) const;
+  void get_compliance_components_(double T, double & S1, double & S2,
+                                  double & S3) const;
 
 
  private:
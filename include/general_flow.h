@@ -8,9 +8,18 @@
 #include "windows.h"
 
 #include <cstddef>
+#include <vector>
 
 namespace neml {
 
+/// Scratch space for evaluating a general flow rule
+//  Owned by the caller, for example the integrator trial state, so repeated
+//  evaluations reuse the storage
+struct NEML_EXPORT GeneralFlowEvaluation {
+  ViscoPlasticEvaluation flow;    // Viscoplastic flow rule terms
+  std::vector<double> work;       // Stress rate partial wrt history
+};
+
 /// ABC for a completely general flow rule...
 class NEML_EXPORT GeneralFlowRule: public NEMLObject {
  public:
@@ -63,6 +72,24 @@ class NEML_EXPORT GeneralFlowRule: public NEMLObject {
                 double Tdot,
                 double * const d_adot) = 0;
 
+  /// Stress and history rates along with their stress and history partials
+  //  The default calls the individual methods, implementations can
+  //  override this to share work between them using the scratch in ev
+  virtual void evaluate(const double * const s, const double * const alpha,
+                        const double * const edot, double T,
+                        double Tdot,
+                        double * const sdot, double * const d_sdot_ds,
+                        double * const d_sdot_da, double * const adot,
+                        double * const d_adot_ds, double * const d_adot_da,
+                        GeneralFlowEvaluation & ev);
+  /// As above, with temporary scratch
+  void evaluate(const double * const s, const double * const alpha,
+                const double * const edot, double T,
+                double Tdot,
+                double * const sdot, double * const d_sdot_ds,
+                double * const d_sdot_da, double * const adot,
+                double * const d_adot_ds, double * const d_adot_da);
+
   /// The implementation needs to define inelastic dissipation
   virtual void work_rate(const double * const s, const double * const alpha,
                 const double * const edot, double T,
@@ -78,6 +105,30 @@ class NEML_EXPORT GeneralFlowRule: public NEMLObject {
 
   /// Optional method for modifying the initial guess
   virtual void override_guess(double * const x);
+
+  /// Sizes of groups of history variables that only interact through
+  /// the da_da_coupling term
+  //  Declares the partial of the history rate with respect to history
+  //  as block diagonal with these blocks, plus a low rank coupling.
+  //  The default is a single dense block.
+  virtual std::vector<size_t> history_blocks() const;
+  /// Rank of the coupling between the history blocks
+  virtual size_t history_rank() const;
+  /// Coupling between the history blocks in da_da, as U V^T
+  //  U and V are nhist x history_rank and da_da - U V^T vanishes outside
+  //  the history_blocks.  ev holds the result of evaluate at the same
+  //  point, so implementations can reuse its terms.
+  virtual void da_da_coupling(const double * const s,
+                              const double * const alpha,
+                              const double * const edot, double T,
+                              double Tdot, const GeneralFlowEvaluation & ev,
+                              double * const U, double * const V);
+  /// As above, evaluating the flow rule first
+  void da_da_coupling(const double * const s,
+                      const double * const alpha,
+                      const double * const edot, double T,
+                      double Tdot,
+                      double * const U, double * const V);
 };
 
 /// Thermo-visco-plasticity
@@ -141,6 +192,16 @@ class NEML_EXPORT TVPFlowRule : public GeneralFlowRule {
                 double Tdot,
                 double * const d_adot);
 
+  using GeneralFlowRule::evaluate;
+  /// Stress and history rates along with their stress and history partials
+  virtual void evaluate(const double * const s, const double * const alpha,
+                        const double * const edot, double T,
+                        double Tdot,
+                        double * const sdot, double * const d_sdot_ds,
+                        double * const d_sdot_da, double * const adot,
+                        double * const d_adot_ds, double * const d_adot_da,
+                        GeneralFlowEvaluation & ev);
+
   /// The implementation needs to define inelastic dissipation
   virtual void work_rate(const double * const s, const double * const alpha,
                 const double * const edot, double T,
@@ -157,6 +218,23 @@ class NEML_EXPORT TVPFlowRule : public GeneralFlowRule {
   /// Override the initial guess
   virtual void override_guess(double * const x);
 
+  /// History blocks from the viscoplastic flow rule
+  virtual std::vector<size_t> history_blocks() const;
+  /// Flow rule coupling rank, plus one for the flow rate
+  virtual size_t history_rank() const;
+  using GeneralFlowRule::da_da_coupling;
+  /// Flow rule coupling scaled by the flow rate, plus h dy_da
+  virtual void da_da_coupling(const double * const s,
+                              const double * const alpha,
+                              const double * const edot, double T,
+                              double Tdot, const GeneralFlowEvaluation & ev,
+                              double * const U, double * const V);
+
+  /// Getter for the elastic model
+  std::shared_ptr<const LinearElasticModel> elastic() const;
+  /// Getter for the viscoplastic flow rule
+  std::shared_ptr<const ViscoPlasticFlowRule> flow() const;
+
  private:
   std::shared_ptr<LinearElasticModel> elastic_;
   std::shared_ptr<ViscoPlasticFlowRule> flow_;
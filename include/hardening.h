@@ -248,6 +248,11 @@ class NEML_EXPORT CombinedHardeningRule: public HardeningRule {
   /// Derivative of the map
   virtual void dq_da(const double * const alpha, double T, double * const dqv) const;
 
+  /// Getter for the isotropic part
+  std::shared_ptr<const IsotropicHardeningRule> iso() const;
+  /// Getter for the kinematic part
+  std::shared_ptr<const KinematicHardeningRule> kin() const;
+
  private:
   std::shared_ptr<IsotropicHardeningRule> iso_;
   std::shared_ptr<KinematicHardeningRule> kin_;
@@ -301,6 +306,26 @@ class NEML_EXPORT NonAssociativeHardening: public NEMLObject {
   /// Derivative of h_temp wrt history
   virtual void dh_da_temp(const double * const s, const double * const alpha, double T,
                 double * const dhv) const;
+
+  /// All of the hardening rates and their derivatives at once
+  virtual void evaluate(const double * const s, const double * const alpha,
+                        double T, double * const hv, double * const dhv_ds,
+                        double * const dhv_da, double * const hv_time,
+                        double * const dhv_ds_time, double * const dhv_da_time,
+                        double * const hv_temp, double * const dhv_ds_temp,
+                        double * const dhv_da_temp) const;
+
+  /// Sizes of groups of history variables that only interact through
+  /// the dh_da_coupling term.  The default is a single dense block.
+  virtual std::vector<size_t> history_blocks() const;
+  /// Rank of the coupling between the history blocks
+  virtual size_t history_rank() const;
+  /// Coupling between the history blocks in dh_da, as U V^T
+  //  U and V are nhist x history_rank.  dh_da - U V^T, dh_da_time and
+  //  dh_da_temp all vanish outside the history_blocks.
+  virtual void dh_da_coupling(const double * const s,
+                              const double * const alpha, double T,
+                              double * const U, double * const V) const;
 };
 
 /// Model for the gamma constant used in Chaboche hardening
@@ -440,14 +465,40 @@ class NEML_EXPORT Chaboche: public NonAssociativeHardening {
   virtual void dh_da_temp(const double * const s, const double * const alpha, double T,
                 double * const dhv) const;
 
+  /// All the rates at once, evaluating the backstress constants only once
+  virtual void evaluate(const double * const s, const double * const alpha,
+                        double T, double * const hv, double * const dhv_ds,
+                        double * const dhv_da, double * const hv_time,
+                        double * const dhv_ds_time, double * const dhv_da_time,
+                        double * const hv_temp, double * const dhv_ds_temp,
+                        double * const dhv_da_temp) const;
+
+  /// One block for the isotropic variable and one per backstress
+  virtual std::vector<size_t> history_blocks() const;
+  /// The isotropic variable and the sum of the backstresses
+  virtual size_t history_rank() const;
+  /// Coupling through gamma and the direction of the effective stress
+  virtual void dh_da_coupling(const double * const s,
+                              const double * const alpha, double T,
+                              double * const U, double * const V) const;
+
   /// Getter for the number of backstresses
   int n() const;
 
   /// Getter for the C constants
   std::vector<double> c(double T) const;
-
- private:
-  void backstress_(const double * const alpha, double * const X) const;
+  /// Gamma values and derivatives wrt the isotropic variable, one per
+  /// backstress
+  void gamma(double a0, double T, double * const g, double * const dg) const;
+  /// Are any of the static recovery terms active?
+  bool static_recovery(double T) const;
+  /// Backward Euler update of the isotropic variable for an increment in
+  /// inelastic strain, along with the derivatives wrt the increment and
+  /// the previous value
+  double iso_update(double a0_n, double dp, double T, double & d_dp,
+                    double & d_a0n) const;
+  /// Isotropic part of the q map and its derivative
+  double iso_q(double a0, double T, double & dq) const;
 
  private:
   std::shared_ptr<IsotropicHardeningRule> iso_;
@@ -524,11 +575,40 @@ class NEML_EXPORT ChabocheVoceRecovery: public NonAssociativeHardening {
   virtual void dh_da_temp(const double * const s, const double * const alpha, double T,
                 double * const dhv) const;
 
+  /// All the rates at once, evaluating the backstress constants only once
+  virtual void evaluate(const double * const s, const double * const alpha,
+                        double T, double * const hv, double * const dhv_ds,
+                        double * const dhv_da, double * const hv_time,
+                        double * const dhv_ds_time, double * const dhv_da_time,
+                        double * const hv_temp, double * const dhv_ds_temp,
+                        double * const dhv_da_temp) const;
+
+  /// One block for the isotropic variable and one per backstress
+  virtual std::vector<size_t> history_blocks() const;
+  /// The isotropic variable and the sum of the backstresses
+  virtual size_t history_rank() const;
+  /// Coupling through gamma and the direction of the effective stress
+  virtual void dh_da_coupling(const double * const s,
+                              const double * const alpha, double T,
+                              double * const U, double * const V) const;
+
   /// Getter for the number of backstresses
   int n() const;
 
- private:
-  void backstress_(const double * const alpha, double * const X) const;
+  /// Getter for the C constants
+  std::vector<double> c(double T) const;
+  /// Gamma values and derivatives wrt the isotropic variable, one per
+  /// backstress
+  void gamma(double a0, double T, double * const g, double * const dg) const;
+  /// Are any of the static recovery terms active?
+  bool static_recovery(double T) const;
+  /// Backward Euler update of the isotropic variable for an increment in
+  /// inelastic strain, along with the derivatives wrt the increment and
+  /// the previous value
+  double iso_update(double a0_n, double dp, double T, double & d_dp,
+                    double & d_a0n) const;
+  /// Isotropic part of the q map and its derivative
+  double iso_q(double a0, double T, double & dq) const;
 
  private:
   const std::shared_ptr<Interpolate> s0_;
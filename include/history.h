@@ -68,8 +68,8 @@ class NEML_EXPORT History {
   History(bool store);
   /// Copy constructor
   History(const History & other);
-  /// Move constructor
-  History(const History && other);
+  /// Move constructor (takes over the data and the maps)
+  History(History && other);
   /// Dangerous constructor, only use if you know what you're doing
   History(double * data);
   /// Dangerous constructor, only use if you know what you're doing
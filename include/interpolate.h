@@ -7,6 +7,7 @@
 
 #include <vector>
 #include <memory>
+#include <atomic>
 
 #include <iostream>
 
@@ -22,6 +23,14 @@ class NEML_EXPORT Interpolate: public NEMLObject {
   virtual double value(double x) const = 0;
   /// Returns the derivative of the function
   virtual double derivative(double x) const = 0;
+  /// Returns both the value and the derivative
+  virtual void value_and_derivative(double x, double & v, double & dv) const;
+  /// Returns the value of the function at n points
+  virtual void value(const double * const x, double * const y, 
+                     size_t n) const;
+  /// Returns the derivative of the function at n points
+  virtual void derivative(const double * const x, double * const dy,
+                          size_t n) const;
   /// Nice wrapper for function call syntax
   double operator()(double x) const;
   /// Is the interpolate valid?
@@ -31,6 +40,35 @@ class NEML_EXPORT Interpolate: public NEMLObject {
   bool valid_;
 };
 
+/// Helper to find the interval containing a point in a sorted table
+//  Uses a direct index calculation if the points are uniformly spaced and
+//  a binary search otherwise.  The interval found by the last query is
+//  checked first, as most callers evaluate at nearby points in sequence.
+//  The lookup does not keep the table: the owner passes its points to each
+//  query, so copies of the owner stay valid.
+class NEML_EXPORT IntervalLookup {
+ public:
+  /// Setup from the table the owner will pass to find
+  IntervalLookup(const std::vector<double> & points);
+  /// Copy, including the last interval
+  IntervalLookup(const IntervalLookup & other);
+  /// Assign, including the last interval
+  IntervalLookup & operator=(const IntervalLookup & other);
+
+  /// Index i with points[i-1] < x <= points[i], for front < x < back
+  size_t find(const std::vector<double> & points, double x) const;
+  /// As above, but check the caller's hint instead of the last interval
+  size_t find(const std::vector<double> & points, double x,
+              size_t hint) const;
+  /// Were the points detected as uniformly spaced?
+  bool uniform() const;
+
+ private:
+  bool uniform_;
+  double x0_, dx_;
+  mutable std::atomic<size_t> last_;
+};
+
 /// Simple polynomial interpolation
 class NEML_EXPORT PolynomialInterpolate : public Interpolate {
  public:
@@ -46,6 +84,14 @@ class NEML_EXPORT PolynomialInterpolate : public Interpolate {
 
   virtual double value(double x) const;
   virtual double derivative(double x) const;
+  virtual void value(const double * const x, double * const y,
+                     size_t n) const;
+  virtual void derivative(const double * const x, double * const dy,
+                          size_t n) const;
+
+ private:
+  void polyval_batch_(const std::vector<double> & poly, const double * const x,
+                      double * const y, size_t n) const;
 
  private:
   const std::vector<double> coefs_;
@@ -66,12 +112,17 @@ class NEML_EXPORT GenericPiecewiseInterpolate: public Interpolate {
   /// Create object from a ParameterSet
   static std::unique_ptr<NEMLObject> initialize(ParameterSet & params);
 
+  using Interpolate::value;
+  using Interpolate::derivative;
   virtual double value(double x) const;
   virtual double derivative(double x) const;
+  virtual void value_and_derivative(double x, double & v,
+                                    double & dv) const;
 
  private:
   const std::vector<double> points_;
   const std::vector<std::shared_ptr<Interpolate>> functions_;
+  IntervalLookup lookup_;
 };
 
 static Register<GenericPiecewiseInterpolate> regGenericPiecewiseInterpolate;
@@ -92,9 +143,16 @@ class NEML_EXPORT PiecewiseLinearInterpolate: public Interpolate {
 
   virtual double value(double x) const;
   virtual double derivative(double x) const;
+  virtual void value(const double * const x, double * const y,
+                     size_t n) const;
+  virtual void derivative(const double * const x, double * const dy,
+                          size_t n) const;
+  virtual void value_and_derivative(double x, double & v,
+                                    double & dv) const;
 
  private:
   const std::vector<double> points_, values_;
+  IntervalLookup lookup_;
 };
 
 static Register<PiecewiseLinearInterpolate> regPiecewiseLinearInterpolate;
@@ -113,12 +171,17 @@ class NEML_EXPORT PiecewiseLogLinearInterpolate: public Interpolate {
   /// Create object from a ParameterSet
   static std::unique_ptr<NEMLObject> initialize(ParameterSet & params);
 
+  using Interpolate::value;
+  using Interpolate::derivative;
   virtual double value(double x) const;
   virtual double derivative(double x) const;
+  virtual void value_and_derivative(double x, double & v,
+                                    double & dv) const;
 
  private:
   const std::vector<double> points_;
   std::vector<double> values_;
+  IntervalLookup lookup_;
 };
 
 static Register<PiecewiseLogLinearInterpolate> regPiecewiseLogLinearInterpolate;
@@ -137,12 +200,17 @@ class NEML_EXPORT PiecewiseSemiLogXLinearInterpolate: public Interpolate {
   /// Create object from a ParameterSet
   static std::unique_ptr<NEMLObject> initialize(ParameterSet & params);
 
+  using Interpolate::value;
+  using Interpolate::derivative;
   virtual double value(double x) const;
   virtual double derivative(double x) const;
+  virtual void value_and_derivative(double x, double & v,
+                                    double & dv) const;
 
  private:
   const std::vector<double> points_;
   std::vector<double> values_;
+  IntervalLookup lookup_;
 };
 
 static Register<PiecewiseSemiLogXLinearInterpolate> regPiecewiseSemiLogXLinearInterpolate;
@@ -160,6 +228,8 @@ class NEML_EXPORT ConstantInterpolate : public Interpolate {
   /// Create object from a ParameterSet
   static std::unique_ptr<NEMLObject> initialize(ParameterSet & params);
 
+  using Interpolate::value;
+  using Interpolate::derivative;
   virtual double value(double x) const;
   virtual double derivative(double x) const;
 
@@ -184,6 +254,10 @@ class NEML_EXPORT ExpInterpolate : public Interpolate {
 
   virtual double value(double x) const;
   virtual double derivative(double x) const;
+  virtual void value(const double * const x, double * const y,
+                     size_t n) const;
+  virtual void derivative(const double * const x, double * const dy,
+                          size_t n) const;
 
  private:
   const double A_, B_;
@@ -206,6 +280,10 @@ class NEML_EXPORT PowerLawInterpolate : public Interpolate {
 
   virtual double value(double x) const;
   virtual double derivative(double x) const;
+  virtual void value(const double * const x, double * const y,
+                     size_t n) const;
+  virtual void derivative(const double * const x, double * const dy,
+                          size_t n) const;
 
  private:
   const double A_, B_;
@@ -228,6 +306,10 @@ class NEML_EXPORT MTSShearInterpolate : public Interpolate {
 
   virtual double value(double x) const;
   virtual double derivative(double x) const;
+  virtual void value(const double * const x, double * const y,
+                     size_t n) const;
+  virtual void derivative(const double * const x, double * const dy,
+                          size_t n) const;
 
  private:
   const double V0_, D_, T0_;
@@ -249,6 +331,8 @@ class NEML_EXPORT MTSInterpolate : public Interpolate {
   /// Create object from a ParameterSet
   static std::unique_ptr<NEMLObject> initialize(ParameterSet & params);
 
+  using Interpolate::value;
+  using Interpolate::derivative;
   virtual double value(double x) const;
   virtual double derivative(double x) const;
 
@@ -48,6 +48,7 @@ class NEML_EXPORT Matrix {
   void matvec(const FlatVector & other, FlatVector & res);
 
   double * data() {return data_;};
+  const double * data() const {return data_;};
   
   const double & operator()(size_t i, size_t j) const;
   double & operator()(size_t i, size_t j);
@@ -76,6 +77,10 @@ class NEML_EXPORT SquareMatrix: public NEMLObject, public Matrix {
   /// Default parameters
   static ParameterSet parameters();
 
+ protected:
+  /// Zero matrix of size m, for subclasses filling in their own data
+  SquareMatrix(ParameterSet & params, size_t m);
+
  private:
   /// Initialize an identity matrix
   void setup_id_();
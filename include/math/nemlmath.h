@@ -19,6 +19,7 @@ extern "C" {
   void dgetrf_(const int & m, const int & n, double* A, const int & lda, int* ipiv, int & info);
   void dgetri_(const int & n, double* A, const int & lda, int* ipiv, double* work, const int & lwork, int & info);
   void dgesv_(const int & n, const int & nrhs, double * A, const int & lda, int * ipiv, double * b, const int & ldb, int & info);
+  void dgetrs_(const char * trans, const int & n, const int & nrhs, const double * A, const int & lda, const int * ipiv, double * b, const int & ldb, int & info);
   void dgemv_(const char * trans, const int & m, const int & n, const double & alpha, const double * A, const int & lda, const double * x, const int & incx, const double & beta, double * y, const int & incy);
   void dgemm_(const char * transa, const char * transb, const int & m, const int & n, const int & k, const double & alpha, const double * A, const int & lda, const double * B, const int & ldb, const double & beta, double * C, const int & ldc);
   void dger_(const int & m, const int & n, const double & alpha, const double * x, const int & incx, const double * y, const int & incy, double * A, const int & lda);
@@ -140,6 +141,10 @@ NEML_EXPORT void invert_mat(double* const A, int n);
 /// Solve unsymmetric system
 NEML_EXPORT void solve_mat(const double * const A, int n, double * const x);
 
+/// Solve unsymmetric system for m right hand sides, B (n x m) becomes X
+NEML_EXPORT void solve_mat_multiple(const double * const A, int n,
+                                    double * const B, int m);
+
 /// Get the condition number of a matrix
 NEML_EXPORT double condition(const double * const A, int n);
 
@@ -182,6 +187,17 @@ NEML_EXPORT bool isclose(double a, double b);
 NEML_EXPORT void rotate_matrix(int m, int n, const double * const A,
                   const double * const B, double * C);
 
+/// The 6x6 matrix rotating Mandel vectors for the rotation matrix M
+NEML_EXPORT void mandel_rotation(const double * const M, double * const R);
+
+/// Perform R * A * R.T for 6x6 matrices without going through BLAS
+NEML_EXPORT void rotate_mandel(const double * const R, const double * const A,
+                               double * const C);
+
+/// Rotate a full fourth order tensor, C_ijkl = M_im M_jn M_ko M_lp A_mnop
+NEML_EXPORT void rotate_fourth(const double * const M, const double * const A,
+                               double * const C);
+
 /// Factorial
 NEML_EXPORT int fact(int n);
 
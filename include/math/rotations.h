@@ -182,6 +182,8 @@ class NEML_EXPORT Orientation: public Quaternion {
                      std::string angles = "radians") const;
   /// Convert to a rotation matrix
   void to_matrix(double * const M) const;
+  /// Convert to the 6x6 matrix rotating Mandel vectors
+  void to_mandel(double * const R) const;
   /// Convert to a rank 2 tensor
   RankTwo to_tensor() const;
   /// Convert to a Rodrigues vector
@@ -282,6 +284,70 @@ NEML_EXPORT Orientation rotate_to_family(const Vector & a, const Vector & b, dou
 /// Convert an orientation to a crystal orientation
 NEML_EXPORT CrystalOrientation make_crystal_orientation(const Orientation & o);
 
+// Batched operations on contiguous arrays of n quaternions (n x 4, each
+// stored as [s v1 v2 v3]).  These work directly on the raw data rather
+// than building a Quaternion or Orientation per entry.
+
+/// Generate n random orientations, the same algorithm as
+/// random_orientations
+NEML_EXPORT void random_orientations_batch(size_t n, double * const q);
+
+/// Quaternion product c_i = a_i * b_i
+NEML_EXPORT void quat_multiply_batch(size_t n, const double * const a,
+                                     const double * const b,
+                                     double * const c);
+
+/// Quaternion conjugate, the inverse of a unit quaternion as in
+/// Orientation::inverse
+NEML_EXPORT void quat_conj_batch(size_t n, const double * const a,
+                                 double * const c);
+
+/// Quaternion inverse c_i = a_i^-1
+NEML_EXPORT void quat_inverse_batch(size_t n, const double * const a,
+                                    double * const c);
+
+/// Quaternion exponential, matching Quaternion::exp
+NEML_EXPORT void quat_exp_batch(size_t n, const double * const a,
+                                double * const c);
+
+/// Quaternion logarithm, matching Quaternion::log
+NEML_EXPORT void quat_log_batch(size_t n, const double * const a,
+                                double * const c);
+
+/// Rotate vectors v_i (n x 3) by unit quaternions q_i
+NEML_EXPORT void quat_apply_vector_batch(size_t n, const double * const q,
+                                         const double * const v,
+                                         double * const res);
+
+/// Rotate Mandel symmetric tensors s_i (n x 6) by unit quaternions q_i
+NEML_EXPORT void quat_apply_symmetric_batch(size_t n, const double * const q,
+                                            const double * const s,
+                                            double * const res);
+
+/// Exponential map of skew tensors (n x 3) in the wexp convention
+NEML_EXPORT void wexp_batch(size_t n, const double * const w,
+                            double * const q);
+
+/// Inverse exponential map to skew tensors (n x 3) in the wlog convention
+NEML_EXPORT void wlog_batch(size_t n, const double * const q,
+                            double * const w);
+
+/// Geodesic distance between a_i and b_i
+NEML_EXPORT void distance_batch(size_t n, const double * const a,
+                                const double * const b, double * const d);
+
+/// Rotate one SymSymR4 by n unit quaternions stored contiguously (n x 4),
+/// giving n 6x6 results
+NEML_EXPORT void rotate_symsym_batch(size_t n, const double * const q,
+                                     const double * const A,
+                                     double * const C);
+
+/// Rotate one full RankFour by n unit quaternions stored contiguously
+/// (n x 4), giving n 81 entry results
+NEML_EXPORT void rotate_fourth_batch(size_t n, const double * const q,
+                                     const double * const A,
+                                     double * const C);
+
 } // namespace neml
 
 #endif // ROTATIONS_H
\ No newline at end of file
@@ -36,6 +36,8 @@ class NEML_EXPORT NEMLModel: public NEMLObject {
    virtual void init_store(double * const store) const = 0;
 
    /// Small strain update interface
+   //  Callers that do not need the algorithmic tangent can pass nullptr
+   //  for A_np1 and the model will skip that work
    virtual void update_sd(
        const double * const e_np1, const double * const e_n,
        double T_np1, double T_n,
@@ -47,6 +49,7 @@ class NEML_EXPORT NEMLModel: public NEMLObject {
        double & p_np1, double p_n) = 0;
 
    /// Large strain incremental update
+   //  As above, passing nullptr for both A_np1 and B_np1 skips the tangents
    virtual void update_ld_inc(
        const double * const d_np1, const double * const d_n,
        const double * const w_np1, const double * const w_n,
@@ -65,6 +68,9 @@ class NEML_EXPORT NEMLModel: public NEMLObject {
 
    /// Instantaneous thermal expansion coefficient as a function of temperature
    virtual double alpha(double T) const = 0;
+   /// Thermal expansion coefficient at n temperatures
+   virtual void alpha(const double * const T, double * const a,
+                      size_t n) const;
    /// Elastic strain for a given stress, temperature, and history state
    virtual void elastic_strains(const double * const s_np1,
                                double T_np1, const double * const h_np1,
@@ -151,6 +157,9 @@ class NEML_EXPORT NEMLModel_sd: public NEMLModel {
 
    /// Provide the instantaneous CTE
    virtual double alpha(double T) const;
+   /// The CTE at n temperatures, through the batched interpolate
+   virtual void alpha(const double * const T, double * const a,
+                      size_t n) const;
    /// Returns the elasticity model, for sub-objects that want to use it
    const std::shared_ptr<const LinearElasticModel> elastic() const;
 
@@ -193,6 +202,7 @@ class SubstepModel_sd: public NEMLModel_sd, public Solvable {
       double & p_np1, double p_n);
 
   /// Single step update
+  //  A and E are nullptr if the caller does not need the tangent
   virtual void update_step(
       const double * const e_np1, const double * const e_n,
       double T_np1, double T_n,
@@ -250,6 +260,9 @@ class SubstepModel_sd: public NEMLModel_sd, public Solvable {
       double & u_np1, double u_n,
       double & p_np1, double p_n) = 0;
 
+  /// Invert the converged jacobian in place to get the step tangent
+  virtual void invert_jacobian(double * const A, TrialState * ts);
+
  protected:
   double rtol_, atol_;
   int miter_;
@@ -334,6 +347,8 @@ class GITrialState : public TrialState {
   double T, Tdot, dt;             // Temperature, temperature rate, time inc.
   std::vector<double> h_n;        // Previous history
   double s_guess[6];              // Reasonable guess at the next stress
+  std::vector<double> U, V;       // Coupling between the history blocks
+  GeneralFlowEvaluation ev;       // Flow rule scratch for the iterations
 };
 
 /// Small strain, associative, perfect plasticity
@@ -437,11 +452,18 @@ static Register<SmallStrainPerfectPlasticity> regSmallStrainPerfectPlasticity;
 //    for associative flow models.  For non-associative models the algorithm
 //    may theoretically fail the discrete Kuhn-Tucker conditions, even
 //    putting aside convergence issues on the nonlinear solver.
+//
+//    Associative J2 models with isotropic elasticity, linear or Voce
+//    isotropic hardening, and optionally linear kinematic hardening
+//    instead use a radial return, which reduces the update to a scalar 
+//    equation in the consistency parameter and gives the tangent in 
+//    closed form.
 class NEML_EXPORT SmallStrainRateIndependentPlasticity: public SubstepModel_sd {
  public:
   /// Parameters: elasticity model, flow rule, CTE, solver tolerance, maximum
   /// solver iterations, verbosity flag, tolerance on the Kuhn-Tucker conditions
-  /// check, and a flag on whether the KT conditions should be evaluated
+  /// check, a flag on whether the KT conditions should be evaluated, and a
+  /// flag enabling the J2 radial return
   SmallStrainRateIndependentPlasticity(ParameterSet & params);
 
   /// Type for the object system
@@ -456,6 +478,17 @@ class NEML_EXPORT SmallStrainRateIndependentPlasticity: public SubstepModel_sd {
   /// Initialize history at time zero
   virtual void init_hist(double * const hist) const;
 
+  /// Single step update, using the radial return if possible
+  virtual void update_step(
+      const double * const e_np1, const double * const e_n,
+      double T_np1, double T_n,
+      double t_np1, double t_n,
+      double * const s_np1, const double * const s_n,
+      double * const h_np1, const double * const h_n,
+      double * const A, double * const E,
+      double & u_np1, double u_n,
+      double & p_np1, double p_n);
+
   /// Setup the trial state
   virtual TrialState * setup(
       const double * const e_np1, const double * const e_n,
@@ -521,8 +554,32 @@ class NEML_EXPORT SmallStrainRateIndependentPlasticity: public SubstepModel_sd {
                        const double * const s_n, const double * const h_n,
                        SSRIPTrialState & ts);
 
+  /// Override the elastic model, which may change the radial return check
+  virtual void set_elastic_model(std::shared_ptr<LinearElasticModel> emodel);
+
+  /// Is the model using the J2 radial return?
+  bool radial_return() const;
+
+ private:
+  void setup_radial_return_();
+  void radial_return_step_(
+      const double * const e_np1, const double * const e_n,
+      double T_np1, double T_n,
+      double t_np1, double t_n,
+      double * const s_np1, const double * const s_n,
+      double * const h_np1, const double * const h_n,
+      double * const A, double * const E,
+      double & u_np1, double u_n,
+      double & p_np1, double p_n);
+  double flow_stress_(double a, double T, double & dsy) const;
+
  private:
   std::shared_ptr<RateIndependentFlowRule> flow_;
+
+  bool use_radial_return_, radial_return_;
+  std::shared_ptr<const LinearIsotropicHardeningRule> linear_iso_;
+  std::shared_ptr<const VoceIsotropicHardeningRule> voce_iso_;
+  std::shared_ptr<const LinearKinematicHardeningRule> linear_kin_;
 };
 
 static Register<SmallStrainRateIndependentPlasticity> regSmallStrainRateIndependentPlasticity;
@@ -596,12 +653,21 @@ static Register<SmallStrainCreepPlasticity> regSmallStrainCreepPlasticity;
 /// Small strain general integrator
 //    General NR one some stress rate + history evolution rate
 //
+//    Optionally, isothermal steps of a TVPFlowRule with J2 Chaboche flow
+//    (ChabocheFlowRule with an IsoKinJ2 surface, Chaboche or 
+//    ChabocheVoceRecovery hardening without static recovery, and
+//    isotropic elasticity) reduce to a scalar equation in the inelastic
+//    strain increment.  The reduced mode solves that equation and then
+//    reconstructs the backstresses and the full sensitivity matrix, so the
+//    history layout and the substepping are unchanged.
+//
 class NEML_EXPORT GeneralIntegrator: public SubstepModel_sd {
  public:
   /// Parameters are an elastic model, a general flow rule,
   /// the CTE, the integration tolerance, the maximum
-  /// nonlinear iterations, a verbosity flag, and the
-  /// maximum number of subdivisions for adaptive integration
+  /// nonlinear iterations, a verbosity flag, the
+  /// maximum number of subdivisions for adaptive integration, and a
+  /// flag enabling the reduced Chaboche integration
   GeneralIntegrator(ParameterSet & params);
 
   /// Type for the object system
@@ -628,6 +694,17 @@ class NEML_EXPORT GeneralIntegrator: public SubstepModel_sd {
       const double * const s_n,
       const double * const h_n);
 
+  /// Single step update, using the reduced integration if possible
+  virtual void update_step(
+      const double * const e_np1, const double * const e_n,
+      double T_np1, double T_n,
+      double t_np1, double t_n,
+      double * const s_np1, const double * const s_n,
+      double * const h_np1, const double * const h_n,
+      double * const A, double * const E,
+      double & u_np1, double u_n,
+      double & p_np1, double p_n);
+
   /// Interpret the x vector
   virtual void update_internal(
       const double * const x,
@@ -670,6 +747,11 @@ class NEML_EXPORT GeneralIntegrator: public SubstepModel_sd {
   /// The residual and jacobian for the nonlinear solve
   virtual void RJ(const double * const x, TrialState * ts,
                  double * const R, double * const J);
+  /// Newton update, condensing out the history if it has block structure
+  virtual void linear_solve(const double * const J, TrialState * ts,
+                            double * const R);
+  /// Tangent from the condensed jacobian, if the history has block structure
+  virtual void invert_jacobian(double * const A, TrialState * ts);
 
   /// Initialize a trial state
   void make_trial_state(const double * const e_np1, const double * const e_n,
@@ -680,9 +762,49 @@ class NEML_EXPORT GeneralIntegrator: public SubstepModel_sd {
   /// Set a new elastic model
   virtual void set_elastic_model(std::shared_ptr<LinearElasticModel> emodel);
 
+  /// Is the model set up for the reduced Chaboche integration?
+  bool reduced_integration() const;
+
+ private:
+  /// The factored history part of the jacobian, see condense_
+  struct HistoryFactor {
+    std::vector<double> Binv;     // Inverse of the block diagonal part
+    std::vector<double> P;        // Binv U
+    std::vector<double> Kinv;     // Inverse of the capacitance matrix
+  };
+
+  void setup_blocks_();
+  void condense_(const double * const J, const GITrialState & ts,
+                 HistoryFactor & f, std::vector<double> & DiC,
+                 double * const S) const;
+  void apply_history_inverse_(const HistoryFactor & f,
+                              const GITrialState & ts, double * const X,
+                              size_t m) const;
+  void setup_reduced_();
+  template <class H>
+  bool reduced_step_(
+      const H & hardening,
+      const double * const e_np1, const double * const e_n,
+      double T_np1, double T_n,
+      double t_np1, double t_n,
+      double * const s_np1, const double * const s_n,
+      double * const h_np1, const double * const h_n,
+      double * const A, double * const E,
+      double & u_np1, double u_n,
+      double & p_np1, double p_n);
+
  private:
   std::shared_ptr<GeneralFlowRule> rule_;
   bool skip_first_;
+
+  std::vector<size_t> blocks_;
+  size_t rank_;
+
+  bool use_reduced_, reduced_;
+  std::shared_ptr<const LinearElasticModel> reduced_elastic_;
+  std::shared_ptr<const ChabocheFlowRule> chaboche_flow_;
+  std::shared_ptr<const Chaboche> chaboche_;
+  std::shared_ptr<const ChabocheVoceRecovery> chaboche_voce_;
 };
 
 static Register<GeneralIntegrator> regGeneralIntegrator;
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "windows.h"
+
+#include <cstddef>
+#include <functional>
+
+namespace neml {
+
+/// Run f(i) for i in [0, n) in parallel
+//    Called inside an OpenMP parallel region the iterations become tasks on
+//    the existing team, so nested batches, like the grains of each
+//    polycrystal point in a block, share one set of threads and balance
+//    the load by task stealing instead of oversubscribing or running
+//    serially.  Otherwise a team of nthreads threads is started with
+//    proc_bind(spread), which pins the threads across the OMP_PLACES.
+//    The first exception thrown by any iteration is rethrown once all the
+//    iterations finish.
+NEML_EXPORT void parallel_for(size_t n, int nthreads,
+                              const std::function<void(size_t)> & f);
+
+/// Default number of threads for a new parallel region
+NEML_EXPORT int default_threads();
+
+} // namespace neml
@@ -101,6 +101,11 @@ class NEML_EXPORT RateIndependentAssociativeFlow: public RateIndependentFlowRule
   virtual void dh_da(const double * const s, const double * const alpha, double T,
                 double * const dhv) const;
 
+  /// Getter for the yield surface
+  std::shared_ptr<const YieldSurface> surface() const;
+  /// Getter for the hardening rule
+  std::shared_ptr<const HardeningRule> hardening() const;
+
  private:
   std::shared_ptr<YieldSurface> surface_;
   std::shared_ptr<HardeningRule> hardening_;
@@ -3,6 +3,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <vector>
 
 #include "windows.h"
 
@@ -48,6 +49,11 @@ class NEML_EXPORT Solvable {
   /// Nonlinear residual equations and corresponding jacobian
   virtual void RJ(const double * const x, TrialState * ts, double * const R,
                  double * const J) = 0;
+  /// Solve the linearized system J dx = R for the update, overwriting R
+  //  The default is a dense solve, systems that know the structure of
+  //  their jacobian can override this with something cheaper
+  virtual void linear_solve(const double * const J, TrialState * ts,
+                            double * const R);
 };
 
 /// Call the built-in solver
@@ -88,6 +94,25 @@ void NEML_EXPORT nox(Solvable * system, double * x, TrialState * ts,
 
 #endif
 
+/// Anderson mixing for the fixed point iteration x = x + f(x)
+//    Keeps the last depth differences of the iterates and residuals and
+//    replaces the plain update with the combination minimizing the
+//    linearized residual.  A depth of zero is the plain iteration.
+class NEML_EXPORT AndersonMixing {
+ public:
+  AndersonMixing(size_t n, size_t depth);
+
+  /// Given the residual f at x, overwrite x with the next iterate
+  void update(double * const x, const double * const f);
+  /// Forget the stored differences and the last iterate
+  void reset();
+
+ private:
+  size_t n_, depth_;
+  std::vector<std::vector<double>> dX_, dF_;
+  std::vector<double> x_prev_, f_prev_;
+};
+
 /// Helper to get numerical jacobian
 void NEML_EXPORT diff_jac(Solvable * system, const double * const x, TrialState * ts,
              double * const nJ, double eps = 1.0e-9);
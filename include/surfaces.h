@@ -10,6 +10,7 @@
 #include "windows.h"
 
 #include "objects.h"
+#include "nemlerror.h"
 #include "math/nemlmath.h"
 #include "interpolate.h"
 
@@ -56,6 +57,9 @@ class NEML_EXPORT YieldSurface: public NEMLObject {
 };
 
 /// Helper to reduce a isotropic + kinematic function to isotropic only
+//  The base surface must use the [isotropic 6-Mandel-vector-backstress]
+//  history layout.  The expanded history and the base surface results
+//  live on the stack, as these get called several times per iteration.
 template<class BT>
 class NEML_EXPORT IsoFunction: public YieldSurface {
  public:
@@ -63,7 +67,9 @@ class NEML_EXPORT IsoFunction: public YieldSurface {
       YieldSurface(params),
       base_(new BT(params))
   {
-
+    if (base_->nhist() != nbase_) {
+      throw NEMLError("IsoFunction requires a base surface with 7 history variables");
+    }
   }
 
   /// Also interfaces with a single isotropic hardening variable
@@ -76,51 +82,49 @@ class NEML_EXPORT IsoFunction: public YieldSurface {
   virtual void f(const double* const s, const double* const q, double T,
                 double & fv) const
   {
-    double * qn = expand_hist_(q);
+    double qn[nbase_];
+    expand_hist_(q, qn);
     base_->f(s, qn, T, fv);
-    delete [] qn;
   }
 
   /// Call with zero kinematic hardening
   virtual void df_ds(const double* const s, const double* const q, double T,
                 double * const df) const
   {
-    double * qn = expand_hist_(q);
+    double qn[nbase_];
+    expand_hist_(q, qn);
     base_->df_ds(s, qn, T, df);
-    delete [] qn;
   }
 
   /// Call with zero kinematic hardening
   virtual void df_dq(const double* const s, const double* const q, double T,
                 double * const df) const
   {
-    double * qn = expand_hist_(q);
-    double * dfn = new double[base_->nhist()];
-     base_->df_dq(s, qn, T, dfn);
+    double qn[nbase_];
+    double dfn[nbase_];
+    expand_hist_(q, qn);
+    base_->df_dq(s, qn, T, dfn);
     df[0] = dfn[0];
-    delete [] qn;
-    delete [] dfn;
   }
 
   /// Call with zero kinematic hardening
   virtual void df_dsds(const double* const s, const double* const q, double T,
                 double * const ddf) const
   {
-    double * qn = expand_hist_(q);
+    double qn[nbase_];
+    expand_hist_(q, qn);
     base_->df_dsds(s, qn, T, ddf);
-    delete [] qn;
   }
 
   /// Call with zero kinematic hardening
   virtual void df_dqdq(const double* const s, const double* const q, double T,
                 double * const ddf) const
   {
-    double * qn = expand_hist_(q);
-    double * ddfn = new double[(base_->nhist())*(base_->nhist())];
+    double qn[nbase_];
+    double ddfn[nbase_*nbase_];
+    expand_hist_(q, qn);
     base_->df_dqdq(s, qn, T, ddfn);
     ddf[0] = ddfn[0];
-    delete [] qn;
-    delete [] ddfn;
   }
 
   /// Call with zero kinematic hardening
@@ -128,38 +132,35 @@ class NEML_EXPORT IsoFunction: public YieldSurface {
                 double * const ddf) const
   {
     // This one is annoying
-    double * qn = expand_hist_(q);
-    double * ddfn = new double[6*(base_->nhist())];
-     base_->df_dsdq(s, qn, T, ddfn);
+    double qn[nbase_];
+    double ddfn[6*nbase_];
+    expand_hist_(q, qn);
+    base_->df_dsdq(s, qn, T, ddfn);
     for (int i=0; i<6; i++) {
-      ddf[i] = ddfn[CINDEX(i,0,base_->nhist())];
+      ddf[i] = ddfn[CINDEX(i,0,nbase_)];
     }
-    delete [] qn;
-    delete [] ddfn;
   }
 
   /// Call with zero kinematic hardening
   virtual void df_dqds(const double* const s, const double* const q, double T,
                 double * const ddf) const
   {
-    double * qn = expand_hist_(q);
-    double * ddfn = new double[(base_->nhist())*6];
+    double qn[nbase_];
+    double ddfn[nbase_*6];
+    expand_hist_(q, qn);
     base_->df_dqds(s, qn, T, ddfn);
     std::copy(ddfn,ddfn+6,ddf);
-    delete [] qn;
-    delete [] ddfn;
   }
 
  private:
-  double * expand_hist_(const double* const q) const
+  void expand_hist_(const double* const q, double * const qn) const
   {
-    double * qn = new double[7];
     qn[0] = q[0];
-    std::fill(qn+1,qn+7,0.0);
-    return qn;
+    std::fill(qn+1,qn+nbase_,0.0);
   }
 
  private:
+  static const size_t nbase_ = 7;
   std::unique_ptr<BT> base_;
 
 };
@@ -219,8 +220,7 @@ static Register<IsoKinJ2> regIsoKinJ2;
 //    hist[0]     K (isotropic hardening)
 //
 //  Originally I coded a custom version of this that didn't re-use the
-//  IsoKinJ2 code.  I switched to this for convenience and reliability but
-//  note it is slightly memory inefficient.
+//  IsoKinJ2 code.  I switched to this for convenience and reliability.
 //
 class NEML_EXPORT IsoJ2: public IsoFunction<IsoKinJ2> {
  public:
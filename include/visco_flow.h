@@ -10,9 +10,47 @@
 #include "windows.h"
 
 #include <memory>
+#include <vector>
 
 namespace neml {
 
+/// Everything a ViscoPlasticFlowRule provides at a single state
+//  The stress-sized blocks are stored inline, the history-sized blocks
+//  are vectors so that the same object can be reused across evaluations
+//  without reallocating.  Layouts match the individual methods.
+struct NEML_EXPORT ViscoPlasticEvaluation {
+  /// Size the history blocks for nhist history variables
+  void resize(size_t nhist);
+
+  double y;
+  double dy_ds[6];
+  std::vector<double> dy_da;
+
+  double g[6];
+  double dg_ds[36];
+  std::vector<double> dg_da;
+
+  double g_time[6];
+  double dg_ds_time[36];
+  std::vector<double> dg_da_time;
+
+  double g_temp[6];
+  double dg_ds_temp[36];
+  std::vector<double> dg_da_temp;
+
+  std::vector<double> h;
+  std::vector<double> dh_ds;
+  std::vector<double> dh_da;
+
+  std::vector<double> h_time;
+  std::vector<double> dh_ds_time;
+  std::vector<double> dh_da_time;
+
+  std::vector<double> h_temp;
+  std::vector<double> dh_ds_temp;
+  std::vector<double> dh_da_temp;
+};
+
 /// ABC describing viscoplastic flow
 class NEML_EXPORT ViscoPlasticFlowRule: public NEMLObject {
  public:
@@ -94,8 +132,34 @@ class NEML_EXPORT ViscoPlasticFlowRule: public NEMLObject {
   virtual void dh_da_temp(const double * const s, const double * const alpha, double T,
                 double * const dhv) const;
 
+  /// Everything above, evaluated together
+  //  The default just calls the individual methods; implementations
+  //  override this to share the common work between them
+  virtual void evaluate(const double * const s, const double * const alpha,
+                        double T, ViscoPlasticEvaluation & res) const;
+
   /// Optional method to give a better initial guess
   virtual void override_guess(double * const guess);
+
+  /// Sizes of groups of history variables that only interact through
+  /// the dh_da_coupling term.  The default is a single dense block.
+  virtual std::vector<size_t> history_blocks() const;
+  /// Rank of the coupling between the history blocks
+  virtual size_t history_rank() const;
+  /// Coupling between the history blocks in dh_da, as U V^T
+  //  U and V are nhist x history_rank.  dh_da - U V^T, dh_da_time and
+  //  dh_da_temp all vanish outside the history_blocks.
+  virtual void dh_da_coupling(const double * const s,
+                              const double * const alpha, double T,
+                              double * const U, double * const V) const;
+
+ protected:
+  /// Fill in the time and temperature rate parts of the flow rule
+  void evaluate_g_rates_(const double * const s, const double * const alpha,
+                         double T, ViscoPlasticEvaluation & res) const;
+  /// Fill in the time and temperature rate parts of the hardening rule
+  void evaluate_h_rates_(const double * const s, const double * const alpha,
+                         double T, ViscoPlasticEvaluation & res) const;
 };
 
 /// The "g" function in the Perzyna model -- often a power law
@@ -188,6 +252,10 @@ class NEML_EXPORT PerzynaFlowRule : public ViscoPlasticFlowRule {
   virtual void dh_da(const double * const s, const double * const alpha, double T,
                 double * const dhv) const;
 
+  /// Evaluate everything at once, sharing the hardening map and surface evaluation
+  virtual void evaluate(const double * const s, const double * const alpha,
+                        double T, ViscoPlasticEvaluation & res) const;
+
  private:
   std::shared_ptr<YieldSurface> surface_;
   std::shared_ptr<HardeningRule> hardening_;
@@ -331,6 +399,30 @@ class NEML_EXPORT ChabocheFlowRule: public ViscoPlasticFlowRule {
   virtual void dh_da_temp(const double * const s, const double * const alpha, double T,
                 double * const dhv) const;
 
+  /// Evaluate everything at once, sharing the yield surface and fluidity evaluation
+  virtual void evaluate(const double * const s, const double * const alpha,
+                        double T, ViscoPlasticEvaluation & res) const;
+
+  /// History blocks from the hardening model
+  virtual std::vector<size_t> history_blocks() const;
+  /// Coupling rank from the hardening model
+  virtual size_t history_rank() const;
+  /// Coupling between the history blocks from the hardening model
+  virtual void dh_da_coupling(const double * const s,
+                              const double * const alpha, double T,
+                              double * const U, double * const V) const;
+
+  /// Getter for the yield surface
+  std::shared_ptr<const YieldSurface> surface() const;
+  /// Getter for the hardening model
+  std::shared_ptr<const NonAssociativeHardening> hardening() const;
+  /// Getter for the fluidity model
+  std::shared_ptr<const FluidityModel> fluidity() const;
+  /// Rate sensitivity exponent
+  double n(double T) const;
+  /// Prefactor on the rate
+  double prefactor(double T) const;
+
  private:
   std::shared_ptr<YieldSurface> surface_;
   std::shared_ptr<NonAssociativeHardening> hardening_;
@@ -410,6 +502,10 @@ class NEML_EXPORT YaguchiGr91FlowRule: public ViscoPlasticFlowRule {
   virtual void dh_da_time(const double * const s, const double * const alpha, double T,
                 double * const dhv) const;
 
+  /// Evaluate everything at once, sharing the effective stress and its norm
+  virtual void evaluate(const double * const s, const double * const alpha,
+                        double T, ViscoPlasticEvaluation & res) const;
+
   /// Value of parameter D
   double D(double T) const;
   /// Value of parameter n
@@ -10,6 +10,10 @@
 
 #include "windows.h"
 
+#include <memory>
+#include <utility>
+#include <vector>
+
 namespace neml {
 
 /// WalkerKremplSwitchRule
@@ -495,13 +499,20 @@ class NEML_EXPORT WalkerKinematicHardening: public KinematicHardening {
 
 static Register<WalkerKinematicHardening> regWalkerKinematicHardening;
 
+/// Base class for model-specific quantities precomputed for a State
+struct NEML_EXPORT StateCache {
+  virtual ~StateCache() {};
+};
+
 /// Helper struct for the below
 struct NEML_EXPORT State {
   State(Symmetric S, History h, double T) :
-      S(S), h(h), T(T) {};
+      S(std::move(S)), h(std::move(h)), T(T) {};
   Symmetric S;
   History h;
   double T;
+  /// Optional cached quantities, only valid for these S, h, and T
+  std::shared_ptr<const StateCache> cache;
 };
 
 /// Wrapper between ViscoPlasticFlowRule and a version using the "fancy" objects
@@ -599,6 +610,10 @@ class NEML_EXPORT WrappedViscoPlasticFlowRule : public ViscoPlasticFlowRule {
                 double * const dhv) const;
   /// Wrapped derivative of h_temp wrt history
   virtual void dh_da_temp(const State & state, History & res) const;
+
+  /// Evaluate everything with a single wrapped state
+  virtual void evaluate(const double * const s, const double * const alpha,
+                        double T, ViscoPlasticEvaluation & res) const;
   
   /// Blank history
   History blank_hist_() const;
@@ -610,40 +625,68 @@ class NEML_EXPORT WrappedViscoPlasticFlowRule : public ViscoPlasticFlowRule {
   template <class T>
   History blank_derivative_() const
   {
-    return blank_hist_().derivative<T>(); 
+    History hv = derivative_layout_<T>();
+    hv.make_store();
+    hv.zero();
+    return hv;
   }
 
  protected:
+  /// Populate the stored history and precompute the derivative layouts,
+  /// call from the derived class constructor
+  void setup_hist_();
+
   /// Make a state object
   State make_state_(const double * const s, const double * const alpha, double
                    T) const;
 
+  /// Precompute quantities shared by the wrapped methods (default: none)
+  virtual std::shared_ptr<const StateCache> cache_state_(
+      const State & state) const;
+
  private:
   /// Make a history object
   History gather_hist_(double * const h) const;
   History gather_hist_(const double * const h) const;
 
+  /// Precomputed (non-owning) layout of a derivative wrt T
+  template <class T>
+  const History & derivative_layout_() const;
+
   /// Initialized derivative
   template <class T>
   History gather_derivative_(double * const h) const
   {
-    History hv = blank_derivative_<T>();
+    History hv = derivative_layout_<T>();
     hv.set_data(h);
     return hv;
   }
 
+  /// Scatter a wrapped history-history derivative into row major storage
+  void unravel_hh_(const double * const wrapped, double * const flat) const;
+
  protected:
   History stored_hist_;
+
+ private:
+  History dscalar_layout_;
+  History dsymmetric_layout_;
+  History dhistory_layout_;
+  // Row major location of each entry of the wrapped history derivative
+  std::vector<size_t> hh_index_;
+  // True if the wrapped history derivative is already row major
+  bool hh_flat_;
 };
 
-/// Initialized derivative wrt history
 template <>
-History WrappedViscoPlasticFlowRule::gather_derivative_<History>(double * const h) const
-{
-  History hv = blank_hist_().history_derivative(blank_hist_());
-  hv.set_data(h);
-  return hv;
-}
+NEML_EXPORT const History &
+WrappedViscoPlasticFlowRule::derivative_layout_<double>() const;
+template <>
+NEML_EXPORT const History &
+WrappedViscoPlasticFlowRule::derivative_layout_<Symmetric>() const;
+template <>
+NEML_EXPORT const History &
+WrappedViscoPlasticFlowRule::derivative_layout_<History>() const;
 
 /// Test implementation of a simple flow rule
 class NEML_EXPORT TestFlowRule: public WrappedViscoPlasticFlowRule
@@ -689,6 +732,28 @@ class NEML_EXPORT TestFlowRule: public WrappedViscoPlasticFlowRule
 
 static Register<TestFlowRule> regTestFlowRule;
 
+/// Kinetic quantities shared by all the WalkerFlowRule methods
+struct NEML_EXPORT WalkerKinetics: public StateCache {
+  // History
+  double alpha, R, D;
+  // Temperature dependent parameters
+  double eps0, phi, dphi, scale, n, k, m, D0, Dx;
+  // Effective stress dev(S) - sum(X) and its norm
+  Symmetric d;
+  double nd;
+  // Threshold stress, flow function and derivative, and prefactor
+  double Y, flow, dflow, prefactor;
+  // Rate, direction, and stress derivatives
+  double y;
+  Symmetric dy_ds;
+  Symmetric g;
+  SymSymR4 G;
+  SymSymR4 dg_ds;
+  // States for the internal variable models
+  ScalarInternalVariable::VariableState ss;
+  SymmetricInternalVariable::VariableState Ss;
+};
+
 /// Full Walker flow rule
 class NEML_EXPORT WalkerFlowRule: public WrappedViscoPlasticFlowRule
 {
@@ -739,26 +804,25 @@ class NEML_EXPORT WalkerFlowRule: public WrappedViscoPlasticFlowRule
   virtual void override_guess(double * const x);
 
  protected:
+  /// Compute all the kinetic quantities once for a state
+  virtual std::shared_ptr<const StateCache> cache_state_(
+      const State & state) const;
+  /// The kinetic quantities, from the state cache if available, otherwise
+  /// computed with or without the stress derivatives
+  std::shared_ptr<const WalkerKinetics> kinetics_(const State & state,
+                                                  bool derivatives = true) const;
+  /// Rates and flow direction
+  void rate_kinetics_(const State & state, WalkerKinetics & kin) const;
+  /// Stress derivatives of the rate and flow direction
+  void derivative_kinetics_(WalkerKinetics & kin) const;
+
   /// Sum of the backstresses
   Symmetric TX_(const State & state) const;
-  /// Make a scalar state object (helper for history)
-  ScalarInternalVariable::VariableState scalar_state_(
-      const State & state) const;
-  /// Make a Symmetric state object (helper for history)
-  SymmetricInternalVariable::VariableState symmetric_state_(
-      const State & state) const;
-  
-  /// The prefactor part of the scalar flow rate (Walker's alpha)
-  double prefactor_(const State & state) const;
-  /// The flow rule (Waklker's h)
-  double flow_(const State & state) const;
-  /// The derivative of the flow rule
-  double dflow_(const State & state) const;
-  /// The actual threshold stress (Walker's Y)
-  double Y_(const State & state) const;
-
-  /// Derivative of the flow direction wrt S - X
-  SymSymR4 G_(const State & state) const;
+
+  /// Derivative of y wrt history, given the kinetics
+  void dy_da_(const WalkerKinetics & kin, History & res) const;
+  /// Derivative of g wrt history, given the kinetics
+  void dg_da_(const WalkerKinetics & kin, History & res) const;
 
  private:
   std::shared_ptr<Interpolate> eps0_;
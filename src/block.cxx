@@ -1,6 +1,9 @@
 #include "block.h"
 
 #include "math/nemlmath.h"
+#include "parallel.h"
+
+#include <atomic>
 
 namespace neml {
 
@@ -154,7 +157,8 @@ void block_evaluate(
   double * e_n_local = new double [nblock *6];
   double * s_np1_local = new double [nblock * 6];
   double * s_n_local = new double [nblock * 6];
-  double * A_np1_local = new double [nblock * 6 * 6];
+  bool tangent = (A_np1 != nullptr);
+  double * A_np1_local = tangent ? new double [nblock * 6 * 6] : nullptr;
   
   t2m(e_np1, e_np1_local, nblock);
   t2m(e_n, e_n_local, nblock);
@@ -162,25 +166,26 @@ void block_evaluate(
   
   size_t nh = model->nstore();
 
-  bool failed = false;
-#ifdef USE_OMP
-#pragma omp parallel for reduction(|| : failed)
-#endif
-  for (size_t i = 0; i < nblock; i++) { 
+  // Points are tasks on one team, so models that batch internally (like the
+  // polycrystal models) add their own tasks to the same threads
+  std::atomic<bool> failed(false);
+  parallel_for(nblock, default_threads(), [&](size_t i)
+  { 
     try {
       model->update_sd(
           &e_np1_local[i*6], &e_n_local[i*6], T_np1[i], T_n[i], t_np1, t_n,
           &s_np1_local[i*6], &s_n_local[i*6], &h_np1[i*nh], &h_n[i*nh],
-          &A_np1_local[i*36], u_np1[i], u_n[i], p_np1[i], p_n[i]);
+          tangent ? &A_np1_local[i*36] : nullptr, u_np1[i], u_n[i],
+          p_np1[i], p_n[i]);
     }
     catch (const NEMLError & e) {
       failed = true;
     }
-  }
+  });
   
   if (!failed) {
     m2t(s_np1_local, s_np1, nblock);
-    m42t4(A_np1_local, A_np1, nblock);
+    if (tangent) m42t4(A_np1_local, A_np1, nblock);
   }
 
   // Free the temps
@@ -1,8 +1,6 @@
 #include "cp/batch.h"
 
-#ifdef USE_OMP
-#include <omp.h>
-#endif
+#include "parallel.h"
 
 namespace neml {
 
@@ -18,22 +16,50 @@ void evaluate_crystal_batch(SingleCrystalModel & model, size_t n,
                            double * const p_np1, const double * const p_n,
                            int nthreads)
 {
-  size_t nh = model.nstore();
-  
-  #ifdef USE_OMP
-  omp_set_num_threads(nthreads);
-  #endif
+  CrystalBatchStrides strides = {6, 3, 6, model.nstore()};
+  evaluate_crystal_batch(model, n, strides, d_np1, d_n, w_np1, w_n,
+                         T_np1, T_n, t_np1, t_n, s_np1, s_n, h_np1, h_n,
+                         A_np1, B_np1, u_np1, u_n, p_np1, p_n, nthreads);
+}
 
-#ifdef USE_OMP
-#pragma omp parallel for
-#endif
-  for (size_t i=0; i<n; i++) {
-    model.update_ld_inc(&d_np1[i*6], &d_n[i*6], &w_np1[i*3], &w_n[i*3],
-                                 T_np1[i], T_n[i], t_np1, t_n, &s_np1[i*6],
-                                 &s_n[i*6], &h_np1[i*nh], &h_n[i*nh],
-                                 &A_np1[i*36], &B_np1[i*18], 
-                                 u_np1[i], u_n[i], p_np1[i], p_n[i]);
-  }
+void evaluate_crystal_batch(SingleCrystalModel & model, size_t n, 
+                           const CrystalBatchStrides & strides,
+                           const double * const d_np1, const double * const d_n, 
+                           const double * const w_np1, const double * const w_n, 
+                           const double * const T_np1, const double * const T_n, 
+                           double t_np1, double t_n, 
+                           double * const s_np1, const double * const s_n, 
+                           double * const h_np1, const double * const h_n, 
+                           double * const A_np1, double * const B_np1, 
+                           double * const u_np1, const double * const u_n, 
+                           double * const p_np1, const double * const p_n,
+                           int nthreads, bool advance_decoupled)
+{
+  size_t sd = strides.d;
+  size_t sw = strides.w;
+  size_t ss = strides.s;
+  size_t sh = strides.h;
+  bool tangent = (A_np1 != nullptr);
+
+  // Tasks on the enclosing team when nested, e.g. in block_evaluate
+  parallel_for(n, nthreads, [&](size_t i)
+  {
+    if (advance_decoupled)
+      model.update_ld_inc(&d_np1[i*sd], &d_n[i*sd], &w_np1[i*sw], &w_n[i*sw],
+                          T_np1[i], T_n[i], t_np1, t_n, &s_np1[i*ss],
+                          &s_n[i*ss], &h_np1[i*sh], &h_n[i*sh],
+                          tangent ? &A_np1[i*36] : nullptr,
+                          tangent ? &B_np1[i*18] : nullptr,
+                          u_np1[i], u_n[i], p_np1[i], p_n[i]);
+    else
+      model.update_ld_inc_decoupled(&d_np1[i*sd], &d_n[i*sd], &w_np1[i*sw],
+                                    &w_n[i*sw], T_np1[i], T_n[i], t_np1, t_n,
+                                    &s_np1[i*ss], &s_n[i*ss], &h_np1[i*sh],
+                                    &h_n[i*sh],
+                                    tangent ? &A_np1[i*36] : nullptr,
+                                    tangent ? &B_np1[i*18] : nullptr,
+                                    u_np1[i], u_n[i], p_np1[i], p_n[i]);
+  });
 }
 
 void init_history_batch(SingleCrystalModel & model, size_t n, double * const hist)
@@ -51,23 +77,57 @@ void set_orientation_passive_batch(SingleCrystalModel & model, size_t n,
   if (orientations.size() != n) 
     throw NEMLError("Vector of orientations does not match batch size");
   
-  size_t nh = model.nstore();
-
+  std::vector<double> q(4*n);
   for (size_t i=0; i<n; i++) {
-    model.set_passive_orientation(&hist[i*nh], orientations[i]);
+    std::copy(orientations[i].quat(), orientations[i].quat()+4, &q[4*i]);
   }
+
+  set_orientation_passive_batch(model, n, hist, &q[0]);
 }
 
 void get_orientation_passive_batch(SingleCrystalModel & model, size_t n,
                                   double * const hist,
                                   std::vector<Orientation> & orientations)
 {
+  std::vector<double> q(4*n);
+  get_orientation_passive_batch(model, n, hist, &q[0]);
+
   orientations.resize(n);
+  for (size_t i=0; i<n; i++) {
+    orientations[i] = Orientation(std::vector<double>(&q[4*i], &q[4*i]+4));
+  }
+}
+
+void set_orientation_passive_batch(SingleCrystalModel & model, size_t n,
+                                  double * const hist,
+                                  const double * const q)
+{
   size_t nh = model.nstore();
+  size_t r = model.orientation_location();
+  size_t r0 = model.reference_orientation_location();
+
+  // The history stores the active rotation, which also resets the reference
+  std::vector<double> active(4*n);
+  quat_conj_batch(n, q, &active[0]);
 
   for (size_t i=0; i<n; i++) {
-    orientations[i] = model.get_passive_orientation(&hist[i*nh]);
+    std::copy(&active[4*i], &active[4*i]+4, &hist[i*nh+r]);
+    std::copy(&active[4*i], &active[4*i]+4, &hist[i*nh+r0]);
   }
 }
 
+void get_orientation_passive_batch(SingleCrystalModel & model, size_t n,
+                                  const double * const hist,
+                                  double * const q, size_t stride)
+{
+  size_t nh = (stride == 0) ? model.nstore() : stride;
+  size_t r = model.orientation_location();
+
+  for (size_t i=0; i<n; i++) {
+    std::copy(&hist[i*nh+r], &hist[i*nh+r]+4, &q[4*i]);
+  }
+
+  quat_conj_batch(n, q, q);
+}
+
 } // namespace neml
@@ -27,7 +27,7 @@ PYBIND11_MODULE(batch, m) {
            py::array_t<double, py::array::c_style> h_n,
            py::array_t<double, py::array::c_style> u_n,
            py::array_t<double, py::array::c_style> p_n,
-           int nthreads ) ->
+           int nthreads, bool tangent) ->
         std::tuple<
           py::array_t<double>, py::array_t<double>,
           py::array_t<double>, py::array_t<double>,
@@ -123,6 +123,14 @@ PYBIND11_MODULE(batch, m) {
           double * p_np1_ptr = arr2ptr<double>(p_np1);
           double * p_n_ptr = arr2ptr<double>(p_n);
 
+          // Zero tangents if the caller does not want them
+          if (not tangent) {
+            std::fill(A_np1_ptr, A_np1_ptr + n*36, 0.0);
+            std::fill(B_np1_ptr, B_np1_ptr + n*18, 0.0);
+            A_np1_ptr = nullptr;
+            B_np1_ptr = nullptr;
+          }
+
           // bye bye GIL
           {
             py::gil_scoped_release release;
@@ -142,7 +150,7 @@ PYBIND11_MODULE(batch, m) {
       py::arg("d_np1"), py::arg("d_n"), py::arg("w_np1"), py::arg("w_n"),
       py::arg("T_np1"), py::arg("T_n"), py::arg("t_np1"), py::arg("t_n"),
       py::arg("s_n"), py::arg("h_n"), py::arg("u_n"), py::arg("p_n"), 
-      py::arg("nthreads") = 1
+      py::arg("nthreads") = 1, py::arg("tangent") = true
       );
 
   m.def("init_history_batch",
@@ -194,6 +202,45 @@ PYBIND11_MODULE(batch, m) {
                                                   res);
           return res;
         }, "Get passive orientations from a polycrystal.");
+  m.def("set_orientation_passive_batch",
+        [](SingleCrystalModel & model, py::array_t<double,
+           py::array::c_style> h, py::array_t<double, py::array::c_style> q)
+        {
+          if (h.request().ndim != 2) {
+            throw std::runtime_error("History should have dim = 2");
+          }
+          size_t n = h.request().shape[0];
+
+          if ((size_t) h.request().shape[1] != model.nstore()) {
+            throw std::runtime_error("History input not compatible with model");
+          }
+
+          if ((q.request().ndim != 2) || ((size_t) q.request().shape[0] != n)
+              || (q.request().shape[1] != 4)) {
+            throw std::runtime_error("History and input quaternions are not compatible!");
+          }
+
+          set_orientation_passive_batch(model, n, arr2ptr<double>(h),
+                                        arr2ptr<double>(q));
+        }, "Set passive orientations from an n x 4 array of quaternions");
+  m.def("get_orientation_passive_array",
+        [](SingleCrystalModel & model, py::array_t<double, py::array::c_style>
+           h) -> py::array_t<double>
+        {
+          if (h.request().ndim != 2) {
+            throw std::runtime_error("History should have dim = 2");
+          }
+          size_t n = h.request().shape[0];
+          
+          if ((size_t) h.request().shape[1] != model.nstore()) {
+            throw std::runtime_error("History input not compatible with model");
+          }
+
+          auto q = alloc_mat<double>(n, 4);
+          get_orientation_passive_batch(model, n, arr2ptr<double>(h),
+                                        arr2ptr<double>(q));
+          return q;
+        }, "Get passive orientations as an n x 4 array of quaternions");
 
 } // PYBIND11_MODULE(batch, m)
 
@@ -201,26 +201,43 @@ std::vector<Orientation> SymmetryGroup::misorientation_block(
     throw std::runtime_error("Blocks of input orientations do not have matching sizes!");
   }
 
-  double * V = new double[N*4];
+  std::vector<double> Av(N*4);
+  std::vector<double> Bv(N*4);
   for (size_t i = 0; i < N; i++) {
-    Orientation v(&V[4*i]);
-    v = A[i] * B[i].inverse();
+    std::copy(A[i].quat(), A[i].quat()+4, &Av[4*i]);
+    std::copy(B[i].quat(), B[i].quat()+4, &Bv[4*i]);
   }
 
+  std::vector<double> Rv(N*4);
+  misorientation_block(N, &Av[0], &Bv[0], &Rv[0]);
+
+  std::vector<Orientation> res(N);
+  for (size_t i = 0; i < N; i++) {
+    res[i] = Orientation(std::vector<double>(&Rv[4*i], &Rv[4*i]+4));
+  }
+
+  return res;
+}
+
+void SymmetryGroup::misorientation_block(size_t N, const double * const A,
+                                         const double * const B,
+                                         double * const res)
+{
+  // V = A * B^-1, entry by entry
+  std::vector<double> V(N*4);
+  quat_conj_batch(N, B, &V[0]);
+  quat_multiply_batch(N, A, &V[0], &V[0]);
+
   size_t S = misops_.size();
-  double * M = new double[S * 4 * 4];
+  std::vector<double> M(S * 4 * 4);
   for (size_t i = 0; i < S; i++) {
     misops_[i].to_product_matrix(&M[i*4*4]);
   }
 
   // Answer is now M * V.T
-  double * R = new double[S * 4 * N];
-  mat_mat_ABT(S*4, N, 4, M, V, R);
-
-  delete [] M;
-  delete [] V;
+  std::vector<double> R(S * 4 * N);
+  mat_mat_ABT(S*4, N, 4, &M[0], &V[0], &R[0]);
 
-  std::vector<Orientation> res(N);
   for (size_t i = 0; i < N; i++) {
     double best_angle = 3 * M_PI;
     size_t bi = -1;
@@ -232,12 +249,10 @@ std::vector<Orientation> SymmetryGroup::misorientation_block(
         bi = j;
       }
     }
-    res[i] = Orientation({R[CINDEX((bi*4+0),i,N)],R[CINDEX((bi*4+1),i,N)],R[CINDEX((bi*4+2),i,N)],R[CINDEX((bi*4+3),i,N)]});
+    for (size_t k = 0; k < 4; k++) {
+      res[4*i+k] = R[CINDEX((bi*4+k),i,N)];
+    }
   }
-
-  delete [] R;
-
-  return res;
 }
 
 std::shared_ptr<SymmetryGroup> get_group(std::string grp)
@@ -248,13 +263,45 @@ std::shared_ptr<SymmetryGroup> get_group(std::string grp)
   return std::make_shared<SymmetryGroup>(params);
 }
 
+struct Lattice::Geometry {
+  Vector a1, a2, a3, b1, b2, b3;
+  std::shared_ptr<SymmetryGroup> symmetry;
+
+  list_systems current_slip;
+  twin_systems current_twin;
+
+  std::vector<std::vector<Vector>> burgers_vectors;
+  std::vector<std::vector<Vector>> slip_directions;
+  std::vector<std::vector<Vector>> slip_planes;
+  std::vector<SlipType> slip_types;
+  std::vector<double> shear;
+  std::vector<std::vector<Orientation>> reorientations;
+
+  std::vector<size_t> offsets;
+
+  // Unrotated sym(d x n) and skew(d x n), by flat system number
+  std::vector<Symmetric> M0;
+  std::vector<Skew> N0;
+
+  // Used for the normal damage system
+  std::vector<Vector> normals;
+  std::vector<std::vector<size_t>> normal_map;
+};
+
 Lattice::Lattice(Vector a1, Vector a2, Vector a3,
                  std::shared_ptr<SymmetryGroup> symmetry,
                  list_systems isystems,
                  twin_systems tsystems) :
-    a1_(a1), a2_(a2), a3_(a3), symmetry_(symmetry), 
-    offsets_({0}), setup_(false)
+    setup_(false)
 {
+  auto geometry = std::make_shared<Geometry>();
+  geometry->a1 = a1;
+  geometry->a2 = a2;
+  geometry->a3 = a3;
+  geometry->symmetry = symmetry;
+  geometry->offsets = {0};
+  geometry_ = geometry;
+
   make_reciprocal_lattice_();
 
   for (auto system : isystems) {
@@ -266,12 +313,84 @@ Lattice::Lattice(Vector a1, Vector a2, Vector a3,
   }
 }
 
+Lattice::Lattice(const Lattice & other) :
+    geometry_(other.geometry_), setup_(other.setup_), hash_(other.hash_),
+    Ms_(other.Ms_), Ns_(other.Ns_)
+{
+
+}
+
+Lattice & Lattice::operator=(const Lattice & other)
+{
+  geometry_ = other.geometry_;
+  setup_ = other.setup_;
+  hash_ = other.hash_;
+  Ms_ = other.Ms_;
+  Ns_ = other.Ns_;
+  return *this;
+}
+
+const Vector & Lattice::a1() const
+{
+  return geometry_->a1;
+}
+
+const Vector & Lattice::a2() const
+{
+  return geometry_->a2;
+}
+
+const Vector & Lattice::a3() const
+{
+  return geometry_->a3;
+}
+
+const Vector & Lattice::b1() const
+{
+  return geometry_->b1;
+}
+
+const Vector & Lattice::b2() const
+{
+  return geometry_->b2;
+}
+
+const Vector & Lattice::b3() const
+{
+  return geometry_->b3;
+}
+
+const std::vector<std::vector<Vector>> & Lattice::burgers_vectors() const
+{
+  return geometry_->burgers_vectors;
+}
+
+const std::vector<std::vector<Vector>> & Lattice::slip_directions() const
+{
+  return geometry_->slip_directions;
+}
+
+const std::vector<std::vector<Vector>> & Lattice::slip_planes() const
+{
+  return geometry_->slip_planes;
+}
+
+const std::vector<double> Lattice::characteristic_shears() const
+{
+  return geometry_->shear;
+}
+
+const std::vector<Lattice::SlipType> & Lattice::slip_types() const
+{
+  return geometry_->slip_types;
+}
+
 Vector Lattice::miller2cart_direction(std::vector<int> m)
 {
   Lattice::assert_miller_(m);
   std::vector<int> mr = reduce_gcd(m);
 
-  return (double) mr[0] * a1_ + (double) mr[1] * a2_ + (double) mr[2] * a3_;
+  return (double) mr[0] * a1() + (double) mr[1] * a2() + (double) mr[2] * a3();
 }
 
 Vector Lattice::miller2cart_plane(std::vector<int> m)
@@ -279,13 +398,13 @@ Vector Lattice::miller2cart_plane(std::vector<int> m)
   Lattice::assert_miller_(m);
   std::vector<int> mr = reduce_gcd(m);
 
-  return (double) mr[0] * b1_ + (double) mr[1] * b2_ + (double) mr[2] * b3_;
+  return (double) mr[0] * b1() + (double) mr[1] * b2() + (double) mr[2] * b3();
 }
 
 std::vector<Vector> Lattice::equivalent_vectors(Vector v)
 {
   std::vector<Vector> uniques;
-  for (auto R = symmetry_->ops().begin(); R != symmetry_->ops().end(); ++R) {
+  for (auto R = symmetry()->ops().begin(); R != symmetry()->ops().end(); ++R) {
     Vector curr = R->apply(v);
     bool dup = false;
     for (auto vi = uniques.begin(); vi != uniques.end(); ++vi) {
@@ -326,7 +445,7 @@ std::vector<Vector> Lattice::equivalent_vectors_bidirectional(Vector v)
 
 void Lattice::add_slip_system(std::vector<int> d, std::vector<int> p)
 {
-  current_slip_.push_back(std::make_pair(d,p));
+  modify_().current_slip.push_back(std::make_pair(d,p));
 
   std::vector<Vector> burgers, directions, normals;
   std::vector<Orientation> reorientations;
@@ -350,22 +469,14 @@ void Lattice::add_slip_system(std::vector<int> d, std::vector<int> p)
     }
   }
 
-  if (burgers.size() != 0) {
-    burgers_vectors_.push_back(burgers);
-    slip_directions_.push_back(directions);
-    slip_planes_.push_back(normals);
-    offsets_.push_back(offsets_.back() + burgers.size());
-    slip_types_.push_back(Lattice::SlipType::Slip);
-    shear_.push_back(0.0);
-    reorientations_.push_back(reorientations);
-    update_normals_(normals);
-  }
+  add_group_(Lattice::SlipType::Slip, 0.0, burgers, directions, normals,
+             reorientations);
 }
 
 void Lattice::add_twin_system(std::vector<int> eta1, std::vector<int> K1,
                               std::vector<int> eta2, std::vector<int> K2)
 {
-  current_twin_.push_back(std::make_tuple(eta1,K1,eta2,K2));
+  modify_().current_twin.push_back(std::make_tuple(eta1,K1,eta2,K2));
 
   std::vector<Vector> burgers, directions, normals;
   std::vector<Orientation> reorientations;
@@ -441,74 +552,60 @@ void Lattice::add_twin_system(std::vector<int> eta1, std::vector<int> K1,
     }
   }
   
-  if (burgers.size() != 0) {
-    burgers_vectors_.push_back(burgers);
-    slip_directions_.push_back(directions);
-    slip_planes_.push_back(normals);
-    offsets_.push_back(offsets_.back() + burgers.size());
-    slip_types_.push_back(Lattice::SlipType::Twin);
-    shear_.push_back(shear);
-    reorientations_.push_back(reorientations);
-    update_normals_(normals);
-  }
+  add_group_(Lattice::SlipType::Twin, shear, burgers, directions, normals,
+             reorientations);
 }
 
 size_t Lattice::ntotal() const
 {
-  size_t total = 0;
-  
-  for (size_t i = 0; i < ngroup(); i++) {
-    total += nslip(i);
-  }
-
-  return total;
+  return geometry_->offsets.back();
 }
 
 size_t Lattice::ngroup() const
 {
-  return slip_planes_.size();
+  return geometry_->slip_planes.size();
 }
 
 size_t Lattice::nslip(size_t g) const
 {
-  return slip_planes_[g].size();
+  return geometry_->slip_planes[g].size();
 }
 
 size_t Lattice::flat(size_t g, size_t i) const
 {
-  return offsets_[g] + i;
+  return geometry_->offsets[g] + i;
 }
 
 Lattice::SlipType Lattice::slip_type(size_t g, size_t i) const
 {
-  return slip_types_[g];
+  return geometry_->slip_types[g];
 }
 
 double Lattice::characteristic_shear(size_t g, size_t i) const
 {
-  return shear_[g];
+  return geometry_->shear[g];
 }
 
 Orientation Lattice::reorientation(size_t g, size_t i) const
 {
-  return reorientations_[g][i];
+  return geometry_->reorientations[g][i];
 }
 
 double Lattice::burgers(size_t g, size_t i) const
 {
-  return burgers_vectors_[g][i].norm();
+  return geometry_->burgers_vectors[g][i].norm();
 }
 
 const Symmetric & Lattice::M(size_t g, size_t i, const Orientation & Q)
 {
   cache_rot_(Q);
-  return Ms_[g][i];
+  return Ms_[flat(g,i)];
 }
 
 const Skew & Lattice::N(size_t g, size_t i, const Orientation & Q)
 {
   cache_rot_(Q);
-  return Ns_[g][i];
+  return Ns_[flat(g,i)];
 }
 
 double Lattice::shear(size_t g, size_t i, const Orientation & Q,
@@ -523,24 +620,24 @@ Symmetric Lattice::d_shear(size_t g, size_t i, const Orientation & Q,
   return M(g, i, Q);
 }
 
-const std::shared_ptr<SymmetryGroup> Lattice::symmetry()
+const std::shared_ptr<SymmetryGroup> Lattice::symmetry() const
 {
-  return symmetry_;
+  return geometry_->symmetry;
 }
 
 const std::vector<Vector> Lattice::unique_planes() const
 {
-  return normals_;
+  return geometry_->normals;
 }
 
 size_t Lattice::nplanes() const
 {
-  return normals_.size();
+  return geometry_->normals.size();
 }
 
 size_t Lattice::plane_index(size_t g, size_t i) const
 {
-  return normal_map_[g][i];
+  return geometry_->normal_map[g][i];
 }
 
 std::vector<std::pair<size_t,size_t>> Lattice::plane_systems(size_t i) const
@@ -556,9 +653,10 @@ std::vector<std::pair<size_t,size_t>> Lattice::plane_systems(size_t i) const
 
 void Lattice::make_reciprocal_lattice_()
 {
-  b1_ = a2_.cross(a3_) / a1_.dot(a2_.cross(a3_));
-  b2_ = a3_.cross(a1_) / a2_.dot(a3_.cross(a1_));
-  b3_ = a1_.cross(a2_) / a3_.dot(a1_.cross(a2_));
+  Geometry & G = modify_();
+  G.b1 = G.a2.cross(G.a3) / G.a1.dot(G.a2.cross(G.a3));
+  G.b2 = G.a3.cross(G.a1) / G.a2.dot(G.a3.cross(G.a1));
+  G.b3 = G.a1.cross(G.a2) / G.a3.dot(G.a1.cross(G.a2));
 }
 
 void Lattice::assert_miller_(std::vector<int> m)
@@ -568,45 +666,85 @@ void Lattice::assert_miller_(std::vector<int> m)
   }
 }
 
-void Lattice::cache_rot_(const Orientation & Q)
+Lattice::Geometry & Lattice::modify_()
 {
-  if (setup_ and (hash_ == Q.hash())) return;
+  // Copy on write, as other Lattices may share the geometry
+  if (geometry_.use_count() != 1)
+    geometry_ = std::make_shared<Geometry>(*geometry_);
 
-  setup_ = true;
-  hash_ = Q.hash();
+  // Any cached rotation no longer matches the systems
+  setup_ = false;
 
-  Ms_.resize(ngroup());
-  Ns_.resize(ngroup());
-  for (size_t g = 0; g < ngroup(); g++) {
-    Ms_[g].resize(nslip(g));
-    Ns_[g].resize(nslip(g));
-    for (size_t i = 0; i < nslip(g); i++) {
-      Ms_[g][i] = Q.apply(Symmetric(outer(slip_directions_[g][i],
-                                          slip_planes_[g][i])));
-      Ns_[g][i] = Q.apply(Skew(outer(slip_directions_[g][i],
-                                     slip_planes_[g][i])));
-    }
-  }
+  return const_cast<Geometry&>(*geometry_);
 }
 
-void Lattice::update_normals_(const std::vector<Vector> & new_planes)
+void Lattice::add_group_(SlipType type, double shear,
+                         const std::vector<Vector> & burgers,
+                         const std::vector<Vector> & directions,
+                         const std::vector<Vector> & normals,
+                         const std::vector<Orientation> & reorientations)
 {
+  if (burgers.size() == 0) return;
+
+  Geometry & G = modify_();
+
+  G.burgers_vectors.push_back(burgers);
+  G.slip_directions.push_back(directions);
+  G.slip_planes.push_back(normals);
+  G.offsets.push_back(G.offsets.back() + burgers.size());
+  G.slip_types.push_back(type);
+  G.shear.push_back(shear);
+  G.reorientations.push_back(reorientations);
+
+  for (size_t i = 0; i < burgers.size(); i++) {
+    RankTwo dn = outer(directions[i], normals[i]);
+    G.M0.push_back(Symmetric(dn));
+    G.N0.push_back(Skew(dn));
+  }
+
+  // Map onto the unique planes
   std::vector<size_t> new_indices;
 
-  for (size_t i = 0; i < new_planes.size(); i++) {
+  for (size_t i = 0; i < normals.size(); i++) {
     size_t j = 0;
-    for (; j < normals_.size(); j++) {
-      if (isclose(fabs(normals_[j].dot(new_planes[i])), 1)) {
+    for (; j < G.normals.size(); j++) {
+      if (isclose(fabs(G.normals[j].dot(normals[i])), 1)) {
         new_indices.push_back(j);
         break;
       }
     }
-    if (j == normals_.size()) {
-      normals_.push_back(new_planes[i]);
-      new_indices.push_back(normals_.size()-1);
+    if (j == G.normals.size()) {
+      G.normals.push_back(normals[i]);
+      new_indices.push_back(G.normals.size()-1);
     }
   }
-  normal_map_.push_back(new_indices);
+  G.normal_map.push_back(new_indices);
+}
+
+void Lattice::cache_rot_(const Orientation & Q)
+{
+  if (setup_ and (hash_ == Q.hash())) return;
+
+  setup_ = true;
+  hash_ = Q.hash();
+
+  size_t n = ntotal();
+  Ms_.resize(n);
+  Ns_.resize(n);
+  for (size_t i = 0; i < n; i++) {
+    Ms_[i] = Q.apply(geometry_->M0[i]);
+    Ns_[i] = Q.apply(geometry_->N0[i]);
+  }
+}
+
+const list_systems & Lattice::current_slip_() const
+{
+  return geometry_->current_slip;
+}
+
+const twin_systems & Lattice::current_twin_() const
+{
+  return geometry_->current_twin;
 }
 
 CubicLattice::CubicLattice(ParameterSet & params) :
@@ -642,8 +780,8 @@ ParameterSet CubicLattice::parameters()
 
 ParameterSet & CubicLattice::current_parameters()
 {
-  current_params_.assign_parameter("slip_systems", current_slip_);
-  current_params_.assign_parameter("twin_systems", current_twin_);
+  current_params_.assign_parameter("slip_systems", current_slip_());
+  current_params_.assign_parameter("twin_systems", current_twin_());
   return current_params_;
 }
 
@@ -712,8 +850,8 @@ Vector HCPLattice::miller2cart_plane(std::vector<int> m)
 
 ParameterSet & HCPLattice::current_parameters()
 {
-  current_params_.assign_parameter("slip_systems", current_slip_);
-  current_params_.assign_parameter("twin_systems", current_twin_);
+  current_params_.assign_parameter("slip_systems", current_slip_());
+  current_params_.assign_parameter("twin_systems", current_twin_());
   return current_params_;
 }
 
@@ -1,7 +1,15 @@
 #include "cp/hucocks.h"
 
+#include "math/nemlmath.h"
+#include "nemlerror.h"
+
+#include <cmath>
+
 namespace neml {
 
+// Offsets into the packed HuCocksTemperatureTerms
+enum {TT_T, TT_D, TT_KT, TT_CEQ_EFF, TT_ZB, TT_K, TT_A, TT_SPECIES};
+
 HuCocksPrecipitationModel::HuCocksPrecipitationModel(
     ParameterSet & params) :
       NEMLObject(params),
@@ -101,291 +109,405 @@ void HuCocksPrecipitationModel::init_history(History & history) const
 std::vector<double> HuCocksPrecipitationModel::rate(const History & history,
                                                     double T) const
 {
-  double fi = f(history);
-  double ri = r(history);
-  double Ni = N(history);
+  double x[3] = {history.get<double>(varnames_[0]),
+    history.get<double>(varnames_[1]), history.get<double>(varnames_[2])};
 
-  return {f_rate(fi, ri, Ni, T) / fs_, r_rate(fi, ri, Ni, T) / rs_, 
-    N_rate(fi, ri, Ni, T) / Ns_};
+  std::vector<double> res(3);
+  scaled_rate(x, T, &res[0]);
+  return res;
 }
 
 std::vector<std::vector<double>> HuCocksPrecipitationModel::jac(
     const History & history,double T) const
 {
-  double fi = f(history);
-  double ri = r(history);
-  double Ni = N(history);
+  double x[3] = {history.get<double>(varnames_[0]),
+    history.get<double>(varnames_[1]), history.get<double>(varnames_[2])};
 
-  return
-  {
-    {df_df(fi, ri, Ni, T) / fs_ * fs_, df_dr(fi, ri, Ni, T) / fs_ * rs_, df_dN(fi, ri, Ni, T) / fs_ * Ns_},
-    {dr_df(fi, ri, Ni, T) / rs_ * fs_, dr_dr(fi, ri, Ni, T) / rs_ * rs_, dr_dN(fi, ri, Ni, T) / rs_ * Ns_},
-    {dN_df(fi, ri, Ni, T) / Ns_ * fs_, dN_dr(fi, ri, Ni, T) / Ns_ * rs_, dN_dN(fi, ri, Ni, T )/ Ns_ * Ns_}
-  };
+  double J[9];
+  scaled_jac(x, T, J);
+  return {{J[0], J[1], J[2]}, {J[3], J[4], J[5]}, {J[6], J[7], J[8]}};
 }
 
-double HuCocksPrecipitationModel::f(const History & history) const
+void HuCocksPrecipitationModel::scaled_rate(const double * const x, double T,
+                                            double * const xdot) const
 {
-  return history.get<double>(varnames_[0]) * fs_;
+  HuCocksTemperatureTerms terms;
+  temperature_terms(T, terms);
+  scaled_evaluate(x, terms, xdot, nullptr);
 }
 
-double HuCocksPrecipitationModel::r(const History & history) const
+void HuCocksPrecipitationModel::scaled_jac(const double * const x, double T,
+                                           double * const J) const
 {
-  return history.get<double>(varnames_[1]) * rs_;
+  HuCocksTemperatureTerms terms;
+  temperature_terms(T, terms);
+  double xdot[3];
+  scaled_evaluate(x, terms, xdot, J);
 }
 
-double HuCocksPrecipitationModel::N(const History & history) const
+size_t HuCocksPrecipitationModel::nterms() const
 {
-  return history.get<double>(varnames_[2]) * Ns_;
+  return TT_SPECIES + 3 * nspecies();
 }
 
-double HuCocksPrecipitationModel::f_rate(double f, double r, double N, double T) const
+void HuCocksPrecipitationModel::temperature_terms(
+    double T, HuCocksTemperatureTerms & terms) const
 {
-  return  4.0 * M_PI / 3.0 * (N_rate(f, r, N, T) * std::pow(r, 3.0) + N * 3.0 *
-                           std::pow(r, 2.0) * r_rate(f, r, N, T));
-}
+  if (! terms.data.empty() && terms.data[TT_T] == T) return;
 
-double HuCocksPrecipitationModel::df_df(double f, double r, double N, double T) const
-{
-  return 4.0 * M_PI / 3.0 * (dN_df(f, r, N, T) * std::pow(r, 3.0) + N * 3.0 *
-                           std::pow(r, 2.0) * dr_df(f, r, N, T));
-}
-
-double HuCocksPrecipitationModel::df_dr(double f, double r, double N, double T) const
-{
-  return 4.0 * M_PI / 3.0 * (dN_dr(f, r, N, T) * std::pow(r, 3.0) +
-                             3.0*N_rate(f, r, N, T) * std::pow(r, 2.0) + 6.0* N
-                             * r * r_rate(f, r, N, T) + N * 3.0 * std::pow(r,
-                                                                           2.0)
-                             * dr_dr(f, r, N, T));
-}
+  size_t n = nspecies();
+  terms.data.resize(nterms());
+  double * t = &terms.data[0];
+  double * c0 = t + TT_SPECIES;
+  double * cp = c0 + n;
+  double * ceq = cp + n;
 
-double HuCocksPrecipitationModel::df_dN(double f, double r, double N, double T) const
-{
-  return 4.0 * M_PI / 3.0 * (dN_dN(f, r, N, T) * std::pow(r, 3.0) + 3.0 *
-                             std::pow(r, 2.0) * r_rate(f, r, N, T) + N * 3.0 *
-                             std::pow(r, 2.0) * dr_dN(f, r, N, T));
-}
-
-double HuCocksPrecipitationModel::r_rate(double f, double r, double N, double T) const
-{
-  double s, ds;
-  sfn_(f, T, s, ds);
-
-  return (1.0-s) * r_rate_nucleation_(f, r, N, T) + s * r_rate_ripening_(f, r, N,
-                                                                       T);
-}
+  t[TT_CEQ_EFF] = 1.0;
+  for (size_t i = 0; i < n; i++) {
+    c0[i] = c0_[i]->value(T);
+    cp[i] = cp_[i]->value(T);
+    ceq[i] = ceq_[i]->value(T);
+    t[TT_CEQ_EFF] *= ceq[i];
+  }
 
-double HuCocksPrecipitationModel::dr_df(double f, double r, double N, double T) const
-{
-  double s, ds;
-  sfn_(f, T, s, ds);
+  t[TT_D] = D_(T);
+  t[TT_KT] = kboltz_ * T;
+  t[TT_ZB] = 2.0 * vm_ * t[TT_D] / std::pow(am_, 4.0) * std::sqrt(chi_ /
+                                                                  t[TT_KT]);
+  t[TT_K] = Cf_->value(T) * 8.0 * chi_ * Vm_ * t[TT_D] / (9.0 * R_ * T);
+  t[TT_A] = t[TT_D] / (cp[rate_] - ceq[rate_]);
+  t[TT_T] = T;
+}
+
+void HuCocksPrecipitationModel::scaled_evaluate(
+    const double * const x, const HuCocksTemperatureTerms & terms,
+    double * const xdot, double * const J) const
+{
+  scaled_evaluate(x, &terms.data[0], xdot, J);
+}
+
+void HuCocksPrecipitationModel::scaled_evaluate(
+    const double * const x, const double * const t,
+    double * const xdot, double * const J) const
+{
+  size_t n = nspecies();
+  const double * c0 = t + TT_SPECIES;
+  const double * cp = c0 + n;
+  const double * ceq = cp + n;
+
+  double f = x[0] * fs_;
+  double r = x[1] * rs_;
+  double N = x[2] * Ns_;
+
+  // Concentrations, the effective concentration, and the indicator function
+  // for the ripening regime, all in one sweep over the species
+  double cr = 0.0, dcr = 0.0;
+  double c_eff = 1.0, dc_eff = 0.0;
+  double s = 0.0, ds = 0.0;
+  for (size_t i = 0; i < n; i++) {
+    double ci = (c0[i] - f * cp[i]) / (1.0 - f);
+    double dci = (c0[i] - cp[i]) / ((1.0 - f) * (1.0 - f));
+    if (i == rate_) {
+      cr = ci;
+      dcr = dci;
+    }
+    dc_eff = dc_eff * ci + c_eff * dci;
+    c_eff *= ci;
 
-  return (1.0-s) * dr_df_nucleation_(f, r, N, T) + s * dr_df_ripening_(f, r, N, T) -
-      ds * r_rate_nucleation_(f, r, N, T) + ds * r_rate_ripening_(f, r, N, T);
-}
+    double xi = (ci - c0[i]) / (ceq[i] - c0[i]);
+    if (xi > s) {
+      s = xi;
+      ds = dci / (ceq[i] - c0[i]);
+    }
+  }
+  if (s > 1.0) {
+    s = 1.0;
+    ds = 0.0;
+  }
 
-double HuCocksPrecipitationModel::dr_dr(double f, double r, double N, double T) const
-{
-  double s, ds;
-  sfn_(f, T, s, ds);
+  // Driving force and critical radius
+  double Gvi = -t[TT_KT] / vm_ * std::log(c_eff / t[TT_CEQ_EFF]);
+  double dGvi = -t[TT_KT] / vm_ * dc_eff / c_eff;
+  double rc = -2.0 * chi_ / Gvi;
+  double drc = 2.0 * chi_ / (Gvi * Gvi) * dGvi;
 
-  return (1.0-s) * dr_dr_nucleation_(f, r, N, T) + s * dr_dr_ripening_(f, r, N, T);
+  // Nucleation regime
+  double Gstar = 16.0 * M_PI * std::pow(chi_, 3.0) / (3.0 * Gvi * Gvi) * w_;
+  double dGstar = -2.0 * Gstar / Gvi * dGvi;
+  double E = std::exp(-Gstar / t[TT_KT]);
+
+  double Nn = N0_ * t[TT_ZB] * cr * E;
+  double dNn_df = N0_ * t[TT_ZB] * dcr * E - Nn * dGstar / t[TT_KT];
+
+  double xr = t[TT_A] * (cr - ceq[rate_]);
+  double rn = xr / r + Nn / N * (rc - r);
+  double drn_df = t[TT_A] * dcr / r + dNn_df / N * (rc - r) + Nn / N * drc;
+  double drn_dr = -xr / (r * r) - Nn / N;
+  double drn_dN = -Nn / (N * N) * (rc - r);
+
+  // Ripening regime
+  double rr = t[TT_K] * cr / (3.0 * r * r);
+  double drr_df = t[TT_K] * dcr / (3.0 * r * r);
+  double drr_dr = -2.0 * rr / r;
+
+  double Nr = -3.0 * N / r * rr;
+  double dNr_df = -3.0 * N / r * drr_df;
+  double dNr_dr = -3.0 * N / r * drr_dr + 3.0 * N / (r * r) * rr;
+  double dNr_dN = -3.0 / r * rr;
+
+  // Blend the two
+  double rdot = (1.0 - s) * rn + s * rr;
+  double Ndot = (1.0 - s) * Nn + s * Nr;
+
+  double r2 = r * r;
+  double r3 = r2 * r;
+  double fdot = 4.0 * M_PI / 3.0 * (Ndot * r3 + 3.0 * N * r2 * rdot);
+
+  xdot[0] = fdot / fs_;
+  xdot[1] = rdot / rs_;
+  xdot[2] = Ndot / Ns_;
+
+  if (J == nullptr) return;
+
+  double dr_df = (1.0 - s) * drn_df + s * drr_df + ds * (rr - rn);
+  double dr_dr = (1.0 - s) * drn_dr + s * drr_dr;
+  double dr_dN = (1.0 - s) * drn_dN;
+
+  double dN_df = (1.0 - s) * dNn_df + s * dNr_df + ds * (Nr - Nn);
+  double dN_dr = s * dNr_dr;
+  double dN_dN = s * dNr_dN;
+
+  double df_df = 4.0 * M_PI / 3.0 * (dN_df * r3 + 3.0 * N * r2 * dr_df);
+  double df_dr = 4.0 * M_PI / 3.0 * (dN_dr * r3 + 3.0 * Ndot * r2 + 6.0 * N *
+                                     r * rdot + 3.0 * N * r2 * dr_dr);
+  double df_dN = 4.0 * M_PI / 3.0 * (dN_dN * r3 + 3.0 * r2 * rdot + 3.0 * N *
+                                     r2 * dr_dN);
+
+  J[0] = df_df;
+  J[1] = df_dr / fs_ * rs_;
+  J[2] = df_dN / fs_ * Ns_;
+  J[3] = dr_df / rs_ * fs_;
+  J[4] = dr_dr;
+  J[5] = dr_dN / rs_ * Ns_;
+  J[6] = dN_df / Ns_ * fs_;
+  J[7] = dN_dr / Ns_ * rs_;
+  J[8] = dN_dN;
+}
+
+void HuCocksPrecipitationModel::c_sum(double f, double T, double & cs,
+                                      double & dcs) const
+{
+  cs = 0.0;
+  dcs = 0.0;
+  for (size_t i = 0; i < nspecies(); i++) {
+    double c0 = c0_[i]->value(T);
+    double cp = cp_[i]->value(T);
+    cs += (c0 - f * cp) / (1.0 - f);
+    dcs += (c0 - cp) / ((1.0 - f) * (1.0 - f));
+  }
 }
 
-double HuCocksPrecipitationModel::dr_dN(double f, double r, double N, double T) const
+void HuCocksPrecipitationModel::c_sum(double f, const double * const t,
+                                      double & cs, double & dcs) const
 {
-  double s, ds;
-  sfn_(f, T, s, ds);
+  size_t n = nspecies();
+  const double * c0 = t + TT_SPECIES;
+  const double * cp = c0 + n;
 
-  return (1.0-s) * dr_dN_nucleation_(f, r, N, T) + s * dr_dN_ripening_(f, r, N,
-                                                                     T);
+  cs = 0.0;
+  dcs = 0.0;
+  for (size_t i = 0; i < n; i++) {
+    cs += (c0[i] - f * cp[i]) / (1.0 - f);
+    dcs += (c0[i] - cp[i]) / ((1.0 - f) * (1.0 - f));
+  }
 }
 
-double HuCocksPrecipitationModel::r_rate_nucleation_(double f, double r, double N, double T) const
+void HuCocksPrecipitationModel::unscaled_evaluate_(double f, double r,
+                                                   double N, double T,
+                                                   double * const rates,
+                                                   double * const J) const
 {
-  auto ci = c(f, T);
-  double D = D_(T);
+  double scale[3] = {fs_, rs_, Ns_};
+  double x[3] = {f / fs_, r / rs_, N / Ns_};
 
-  double Gvi = Gv(f, T);
-  double rc = -2.0 * chi_ / Gvi;
-  return D / r * (ci[rate_] - ceq_[rate_]->value(T)) / (cp_[rate_]->value(T) -
-                                                       ceq_[rate_]->value(T))
-      + N_rate_nucleation_(f, r, N, T) / N * (rc - r);
+  HuCocksTemperatureTerms terms;
+  temperature_terms(T, terms);
+  scaled_evaluate(x, terms, rates, J);
 
+  for (size_t i = 0; i < 3; i++) {
+    rates[i] *= scale[i];
+    if (J != nullptr)
+      for (size_t j = 0; j < 3; j++)
+        J[CINDEX(i,j,3)] *= scale[i] / scale[j];
+  }
 }
 
-double HuCocksPrecipitationModel::dr_df_nucleation_(double f, double r, double N, double T) const
+/// Solve a 3x3 row-major system in place with partial pivoting
+static void solve_3x3(double * const A, double * const b)
 {
-  auto ci = c(f, T);
-  auto dci = dc_df(f, T);
-  double D = D_(T);
-
-  double Gvi = Gv(f, T);
-  double dGvi = dG_df(f, T);
-  double rc = -2.0 * chi_ / Gvi;
-  double drc = 2.0 * chi_ / (Gvi * Gvi) * dGvi;
-  return D / r * dci[rate_] / (cp_[rate_]->value(T) - ceq_[rate_]->value(T))
-      + dN_df_nucleation_(f, r, N, T) / N * (rc - r) + N_rate_nucleation_(f, r, N, T) / N * drc;
-
+  for (int k = 0; k < 3; k++) {
+    int p = k;
+    for (int i = k+1; i < 3; i++)
+      if (std::fabs(A[CINDEX(i,k,3)]) > std::fabs(A[CINDEX(p,k,3)])) p = i;
+    if (A[CINDEX(p,k,3)] == 0.0)
+      throw LinalgError("Matrix could not be inverted!");
+    if (p != k) {
+      for (int j = 0; j < 3; j++)
+        std::swap(A[CINDEX(k,j,3)], A[CINDEX(p,j,3)]);
+      std::swap(b[k], b[p]);
+    }
+    for (int i = k+1; i < 3; i++) {
+      double m = A[CINDEX(i,k,3)] / A[CINDEX(k,k,3)];
+      for (int j = k; j < 3; j++)
+        A[CINDEX(i,j,3)] -= m * A[CINDEX(k,j,3)];
+      b[i] -= m * b[k];
+    }
+  }
+  for (int i = 2; i >= 0; i--) {
+    for (int j = i+1; j < 3; j++)
+      b[i] -= A[CINDEX(i,j,3)] * b[j];
+    b[i] /= A[CINDEX(i,i,3)];
+  }
 }
 
-double HuCocksPrecipitationModel::dr_dr_nucleation_(double f, double r, double N, double T) const
-{
-  auto ci = c(f, T);
-  double D = D_(T);
+void HuCocksPrecipitationModel::integrate(double * const x_np1,
+                                          const double * const x_n,
+                                          const HuCocksTemperatureTerms & terms,
+                                          double dt, double rtol, double atol,
+                                          int miter) const
+{
+  // x_np1 and x_n may alias
+  double x0[3] = {x_n[0], x_n[1], x_n[2]};
+  double x[3] = {x0[0], x0[1], x0[2]};
+  double R[3], J[9];
+
+  // The three scaled variables still differ by orders of magnitude, so
+  // converge each Newton increment relative to its own variable rather than
+  // using the norm of the residual
+  for (int i = 0; i < miter; i++) {
+    // R = x - x_n - dt * xdot(x) and J = I - dt * dxdot/dx
+    scaled_evaluate(x, terms, R, J);
+    for (int j = 0; j < 3; j++) {
+      R[j] = x[j] - x0[j] - dt * R[j];
+      for (int k = 0; k < 3; k++)
+        J[CINDEX(j,k,3)] = (j == k ? 1.0 : 0.0) - dt * J[CINDEX(j,k,3)];
+    }
 
-  double Gvi = Gv(f, T);
-  double rc = -2.0 * chi_ / Gvi;
-  return -D / (r*r) * (ci[rate_] - ceq_[rate_]->value(T)) / (cp_[rate_]->value(T) -
-                                                       ceq_[rate_]->value(T))
-      + dN_dr_nucleation_(f, r, N, T) / N * (rc - r) - N_rate_nucleation_(f, r, N,T) / N;
-}
+    solve_3x3(J, R);
 
-double HuCocksPrecipitationModel::dr_dN_nucleation_(double f, double r, double N, double T) const
-{
-  auto ci = c(f, T);
-
-  double Gvi = Gv(f, T);
-  double rc = -2.0 * chi_ / Gvi;
-  return dN_dN_nucleation_(f, r, N, T) / N * (rc - r) - N_rate_nucleation_(f, r, N,T)/(N*N) * (rc - r);
-}
+    bool converged = true;
+    for (int j = 0; j < 3; j++) {
+      x[j] -= R[j];
+      if (! (std::fabs(R[j]) <= rtol * std::fabs(x[j]) + atol))
+        converged = false;
+    }
 
-double HuCocksPrecipitationModel::r_rate_ripening_(double f, double r, double N, double T) const
-{
-  auto ci = c(f, T);
-  double D = D_(T);
+    if (converged) {
+      std::copy(x, x+3, x_np1);
+      return;
+    }
+  }
 
-  double K = Cf_->value(T) * 8.0 * chi_ * Vm_ * D * ci[rate_] / (9.0 * R_ * T);
-  return K / (3.0 * std::pow(r, 2.0));
+  throw NonlinearSolverError("Precipitation update did not converge");
 }
 
-double HuCocksPrecipitationModel::dr_df_ripening_(double f, double r, double N, double T) const
+double HuCocksPrecipitationModel::f(const History & history) const
 {
-  auto dci = dc_df(f, T);
-  double D = D_(T);
-
-  double dK = Cf_->value(T) * 8.0 * chi_ * Vm_ * D * dci[rate_] / (9.0 * R_ * T);
-  return dK / (3.0 * std::pow(r, 2.0));
+  return history.get<double>(varnames_[0]) * fs_;
 }
 
-double HuCocksPrecipitationModel::dr_dr_ripening_(double f, double r, double N, double T) const
+double HuCocksPrecipitationModel::r(const History & history) const
 {
-  auto ci = c(f, T);
-  double D = D_(T);
-
-  double K = Cf_->value(T) * 8.0 * chi_ * Vm_ * D * ci[rate_] / (9.0 * R_ * T);
-  return -2 * K / (3.0 * std::pow(r, 3.0));
+  return history.get<double>(varnames_[1]) * rs_;
 }
 
-double HuCocksPrecipitationModel::dr_dN_ripening_(double f, double r, double N, double T) const
+double HuCocksPrecipitationModel::N(const History & history) const
 {
-  return 0;
+  return history.get<double>(varnames_[2]) * Ns_;
 }
 
-double HuCocksPrecipitationModel::N_rate(double f, double r, double N, double T) const
+double HuCocksPrecipitationModel::f_rate(double f, double r, double N, double T) const
 {
-  double s, ds;
-  sfn_(f, T, s, ds);
-
-  return (1.0-s) * N_rate_nucleation_(f, r, N, T) + s * N_rate_ripening_(f, r, N,
-                                                                       T);
+  double rates[3];
+  unscaled_evaluate_(f, r, N, T, rates, nullptr);
+  return rates[0];
 }
 
-double HuCocksPrecipitationModel::dN_df(double f, double r, double N, double T) const
+double HuCocksPrecipitationModel::df_df(double f, double r, double N, double T) const
 {
-  double s, ds;
-  sfn_(f, T, s, ds);
-
-  return (1.0-s) * dN_df_nucleation_(f, r, N, T) + s * dN_df_ripening_(f, r, N, T) -
-      ds * N_rate_nucleation_(f, r, N, T) + ds * N_rate_ripening_(f, r, N, T);
+  double rates[3], J[9];
+  unscaled_evaluate_(f, r, N, T, rates, J);
+  return J[0];
 }
 
-double HuCocksPrecipitationModel::dN_dr(double f, double r, double N, double T) const
+double HuCocksPrecipitationModel::df_dr(double f, double r, double N, double T) const
 {
-  double s, ds;
-  sfn_(f, T, s, ds);
-
-  return (1.0-s) * dN_dr_nucleation_(f, r, N, T) + s * dN_dr_ripening_(f, r, N, T);
+  double rates[3], J[9];
+  unscaled_evaluate_(f, r, N, T, rates, J);
+  return J[1];
 }
 
-double HuCocksPrecipitationModel::dN_dN(double f, double r, double N, double T) const
+double HuCocksPrecipitationModel::df_dN(double f, double r, double N, double T) const
 {
-  double s, ds;
-  sfn_(f, T, s, ds);
-
-  return (1.0-s) * dN_dN_nucleation_(f, r, N, T) + s * dN_dN_ripening_(f, r, N,
-                                                                     T);
+  double rates[3], J[9];
+  unscaled_evaluate_(f, r, N, T, rates, J);
+  return J[2];
 }
 
-double HuCocksPrecipitationModel::N_rate_nucleation_(double f, double r, double N, double T) const
+double HuCocksPrecipitationModel::r_rate(double f, double r, double N, double T) const
 {
-  auto ci = c(f, T);
-  double D = D_(T);
-
-  double Gvi = Gv(f, T);
-  double Gstar = 16 * M_PI * std::pow(chi_, 3.0) / (3.0 * std::pow(Gvi, 2.0))
-      * w_;
-  double ZB = 2.0 * vm_ * D * ci[rate_] / std::pow(am_, 4.0) * std::sqrt(chi_ /
-                                                                        (kboltz_
-                                                                         * T));
-  return N0_ * ZB * std::exp(-Gstar / (kboltz_ * T));
-
+  double rates[3];
+  unscaled_evaluate_(f, r, N, T, rates, nullptr);
+  return rates[1];
 }
 
-double HuCocksPrecipitationModel::dN_df_nucleation_(double f, double r, double N, double T) const
+double HuCocksPrecipitationModel::dr_df(double f, double r, double N, double T) const
 {
-  auto ci = c(f, T);
-  auto dci = dc_df(f, T);
-  double D = D_(T);
-
-  double Gvi = Gv(f, T);
-  double dGvi = dG_df(f, T);
-  double Gstar = 16 * M_PI * std::pow(chi_, 3.0) / (3.0 * std::pow(Gvi, 2.0))
-      * w_;
-  double dGstar = -32 * M_PI * std::pow(chi_, 3.0) / (3.0 * std::pow(Gvi,
-                                                                     3.0)) *
-      dGvi * w_;
-
-  double ZB = 2.0 * vm_ * D * ci[rate_] / std::pow(am_, 4.0) * std::sqrt(chi_ /
-                                                                        (kboltz_
-                                                                         * T));
-  double dZB = 2.0 * vm_ * D * dci[rate_] / std::pow(am_, 4.0) * std::sqrt(chi_ /
-                                                                        (kboltz_
-                                                                         * T));
-
-  return N0_ * dZB * std::exp(-Gstar / (kboltz_ * T)) - N0_ * ZB *
-      std::exp(-Gstar/ (kboltz_*T)) * dGstar / (kboltz_ * T);
+  double rates[3], J[9];
+  unscaled_evaluate_(f, r, N, T, rates, J);
+  return J[3];
 }
 
-double HuCocksPrecipitationModel::dN_dr_nucleation_(double f, double r, double N, double T) const
+double HuCocksPrecipitationModel::dr_dr(double f, double r, double N, double T) const
 {
-  return 0;
+  double rates[3], J[9];
+  unscaled_evaluate_(f, r, N, T, rates, J);
+  return J[4];
 }
 
-double HuCocksPrecipitationModel::dN_dN_nucleation_(double f, double r, double N, double T) const
+double HuCocksPrecipitationModel::dr_dN(double f, double r, double N, double T) const
 {
-  return 0;
+  double rates[3], J[9];
+  unscaled_evaluate_(f, r, N, T, rates, J);
+  return J[5];
 }
 
-double HuCocksPrecipitationModel::N_rate_ripening_(double f, double r, double N, double T) const
+double HuCocksPrecipitationModel::N_rate(double f, double r, double N, double T) const
 {
-  return -3.0 * N / r * r_rate_ripening_(f, r, N, T);
+  double rates[3];
+  unscaled_evaluate_(f, r, N, T, rates, nullptr);
+  return rates[2];
 }
 
-double HuCocksPrecipitationModel::dN_df_ripening_(double f, double r, double N, double T) const
+double HuCocksPrecipitationModel::dN_df(double f, double r, double N, double T) const
 {
-  return -3.0 * N / r * dr_df_ripening_(f, r, N, T);
+  double rates[3], J[9];
+  unscaled_evaluate_(f, r, N, T, rates, J);
+  return J[6];
 }
 
-double HuCocksPrecipitationModel::dN_dr_ripening_(double f, double r, double N, double T) const
+double HuCocksPrecipitationModel::dN_dr(double f, double r, double N, double T) const
 {
-  return -3.0 * N / r * dr_dr_ripening_(f, r, N, T) + 3.0 * N / (r * r) * r_rate_ripening_(f, r, N, T);
+  double rates[3], J[9];
+  unscaled_evaluate_(f, r, N, T, rates, J);
+  return J[7];
 }
 
-double HuCocksPrecipitationModel::dN_dN_ripening_(double f, double r, double N, double T) const
+double HuCocksPrecipitationModel::dN_dN(double f, double r, double N, double T) const
 {
-  return -3.0 * N / r * dr_dN_ripening_(f, r, N, T) - 3.0 / r * r_rate_ripening_(f, r, N, T);
+  double rates[3], J[9];
+  unscaled_evaluate_(f, r, N, T, rates, J);
+  return J[8];
 }
 
 size_t HuCocksPrecipitationModel::nspecies() const
@@ -471,41 +593,6 @@ double HuCocksPrecipitationModel::vm() const
   return vm_;
 }
 
-void HuCocksPrecipitationModel::sfn_(double f, double T, double & val, double
-                                       & dval) const
-{
-  auto cs = c(f, T);
-  auto dcs = dc_df(f, T);
-  val = 0.0;
-  for (size_t i = 0; i < nspecies(); i++) {
-    double xi = (cs[i] - c0_[i]->value(T)) / (ceq_[i]->value(T) -
-                                              c0_[i]->value(T));
-    if (xi > val) {
-      val = xi;
-      dval = dcs[i] / (ceq_[i]->value(T) - c0_[i]->value(T));
-    }
-  }
-  
-  if (val < 0.0) {
-    val = 0.0;
-    dval = 0.0;
-  }
-  
-  if (val > 1.0) {
-    val = 1.0;
-    dval = 0.0;
-  }
-}
-
-bool HuCocksPrecipitationModel::nucleation_(const std::vector<double> & c,
-                                            double T) const
-{
-  for (size_t i = 0; i < nspecies(); i++) {
-    if (c[i] <= ceq_[i]->value(T)) return false;
-  }
-  return true;
-}
-
 DislocationSpacingHardening::DislocationSpacingHardening(ParameterSet & params) :
     SlipHardening(params),
     J1_(params.get_object_parameter<Interpolate>("J1")),
@@ -606,29 +693,28 @@ History DislocationSpacingHardening::hist(const Symmetric & stress,
                                      Lattice & L, double T, const SlipRule & R, 
                                      const History & fixed) const
 {
-
   // Vector of results
   History res = blank_hist().zero();
+
+  // Temperature terms and slip rates are shared by every spacing variable
+  double J1 = J1_->value(T);
+  double J2 = J2_->value(T);
+  double K = K_->value(T);
+  std::vector<double> slip(L.ntotal());
+  for (size_t g = 0; g < L.ngroup(); g++)
+    for (size_t k = 0; k < L.nslip(g); k++)
+      slip[L.flat(g, k)] = std::fabs(R.slip(g, k, stress, Q, history, L, T,
+                                            fixed));
   
   for (size_t i = 0; i < size(); i++) {
     double Li = history.get<double>(varnames_[i]);
     double Li3 = std::pow(Li, 3);
-    for (size_t g = 0; g < L.ngroup(); g++) {
-      for (size_t k = 0; k < L.nslip(g); k++) {
-        size_t j = L.flat(g, k);
-        double c;
-        if (i == j)
-          c = J1_->value(T);
-        else
-          c = J2_->value(T);
-        res.get<double>(varnames_[i]) -= Li3 * c * 
-            std::fabs(R.slip(g, k, stress, Q, history, L, T, fixed));
-      }
-    }
-    res.get<double>(varnames_[i]) += K_->value(T) / Li3;
+    double & ri = res.get<double>(varnames_[i]);
+    for (size_t j = 0; j < slip.size(); j++)
+      ri -= Li3 * (i == j ? J1 : J2) * slip[j];
+    ri += K / Li3;
   }
 
-
   return res;
 }
 
@@ -641,25 +727,22 @@ History DislocationSpacingHardening::d_hist_d_s(const Symmetric & stress,
 {
   History res = blank_hist().derivative<Symmetric>().zero();
 
+  double J1 = J1_->value(T);
+  double J2 = J2_->value(T);
+  std::vector<Symmetric> dslip(L.ntotal());
+  for (size_t g = 0; g < L.ngroup(); g++) {
+    for (size_t k = 0; k < L.nslip(g); k++) {
+      double si = R.slip(g, k, stress, Q, history, L, T, fixed);
+      dslip[L.flat(g, k)] = std::copysign(1.0, si) * 
+          R.d_slip_d_s(g, k, stress, Q, history, L, T, fixed);
+    }
+  }
+
   for (size_t i = 0; i < size(); i++) {
     double Li = history.get<double>(varnames_[i]);
     double Li3 = std::pow(Li, 3);
-    for (size_t g = 0; g < L.ngroup(); g++) {
-      for (size_t k = 0; k < L.nslip(g); k++) {
-        size_t j = L.flat(g, k);
-        double c;
-        if (i == j)
-          c = J1_->value(T);
-        else
-          c = J2_->value(T);
-        
-        double si = R.slip(g, k, stress, Q, history, L, T, fixed);
-        double sgn = std::copysign(1.0, si);
-        Symmetric dsi = R.d_slip_d_s(g, k, stress, Q, history, L, T, fixed);
-        
-        res.get<Symmetric>(varnames_[i]) -= Li3 * c * sgn * dsi;
-      }
-    }
+    for (size_t j = 0; j < dslip.size(); j++)
+      res.get<Symmetric>(varnames_[i]) -= Li3 * (i == j ? J1 : J2) * dslip[j];
   }
 
   return res;
@@ -674,34 +757,37 @@ History DislocationSpacingHardening::d_hist_d_h(const Symmetric & stress,
 {
   auto res = blank_hist().history_derivative(history).zero();
 
+  double J1 = J1_->value(T);
+  double J2 = J2_->value(T);
+  double K = K_->value(T);
+  std::vector<double> slip;
+  std::vector<History> dslip;
+  slip.reserve(L.ntotal());
+  dslip.reserve(L.ntotal());
+  // In flat order
+  for (size_t g = 0; g < L.ngroup(); g++) {
+    for (size_t k = 0; k < L.nslip(g); k++) {
+      double si = R.slip(g, k, stress, Q, history, L, T, fixed);
+      slip.push_back(std::fabs(si));
+      dslip.push_back(R.d_slip_d_h(g, k, stress, Q, history, L, T, fixed));
+      dslip.back().scalar_multiply(std::copysign(1.0, si));
+    }
+  }
+
   // There is both an effect on the diagonal caused by the Ldi in the equation
   // and an effect from the slip rule
   for (size_t i = 0; i < size(); i++) {
     double Li = history.get<double>(varnames_[i]);
     double Li3 = std::pow(Li, 3);
-    for (size_t g = 0; g < L.ngroup(); g++) {
-      for (size_t k = 0; k < L.nslip(g); k++) {
-        size_t j = L.flat(g, k);
-        double c;
-        if (i == j)
-          c = J1_->value(T);
-        else
-          c = J2_->value(T);
-        
-        double si = R.slip(g, k, stress, Q, history, L, T, fixed);
-        double sgn = std::copysign(1.0, si);
-        History dsi = R.d_slip_d_h(g, k, stress, Q, history, L, T, fixed);
-
-        res.get<double>(varnames_[i]+"_"+varnames_[i]) -= 
-            3.0 * std::pow(Li,2.0) * c * std::fabs(si);
-        
-        for (auto vn : dsi.get_order())
-          res.get<double>(varnames_[i]+"_"+vn) -=
-              Li3 * c * sgn * dsi.get<double>(vn);
-      }
+    double & dii = res.get<double>(varnames_[i]+"_"+varnames_[i]);
+    for (size_t j = 0; j < slip.size(); j++) {
+      double c = i == j ? J1 : J2;
+      dii -= 3.0 * std::pow(Li,2.0) * c * slip[j];
+      for (auto vn : dslip[j].get_order())
+        res.get<double>(varnames_[i]+"_"+vn) -=
+            Li3 * c * dslip[j].get<double>(vn);
     }
-    res.get<double>(varnames_[i]+"_"+varnames_[i]) -= 3.0*K_->value(T) /
-        std::pow(Li,4.0);    
+    dii -= 3.0*K / std::pow(Li,4.0);    
   }
 
   return res;
@@ -716,29 +802,28 @@ History DislocationSpacingHardening::d_hist_d_h_ext(const Symmetric & stress,
 {
   History res = blank_hist().history_derivative(history.subset(ext)).zero();
 
+  double J1 = J1_->value(T);
+  double J2 = J2_->value(T);
+  std::vector<History> dslip;
+  dslip.reserve(L.ntotal());
+  // In flat order
+  for (size_t g = 0; g < L.ngroup(); g++) {
+    for (size_t k = 0; k < L.nslip(g); k++) {
+      double si = R.slip(g, k, stress, Q, history, L, T, fixed);
+      dslip.push_back(R.d_slip_d_h(g, k, stress, Q, history, L, T, fixed));
+      dslip.back().scalar_multiply(std::copysign(1.0, si));
+    }
+  }
+
   for (size_t i = 0; i < size(); i++) {
     double Li = history.get<double>(varnames_[i]);
     double Li3 = std::pow(Li, 3);
-    for (size_t g = 0; g < L.ngroup(); g++) {
-      for (size_t k = 0; k < L.nslip(g); k++) {
-        size_t j = L.flat(g, k);
-        double c;
-        if (i == j)
-          c = J1_->value(T);
-        else
-          c = J2_->value(T);
-        
-        double si = R.slip(g, k, stress, Q, history, L, T, fixed);
-        double sgn = std::copysign(1.0, si);
-        History dsi = R.d_slip_d_h(g, k, stress, Q, history, L, T, fixed);
-
-        for (auto vn : ext)
-          if (dsi.contains(vn)) {
-            res.get<double>(varnames_[i]+"_"+vn) -=
-                Li3 * c * sgn * dsi.get<double>(vn);
-          }
-      }
-    }
+    for (size_t j = 0; j < dslip.size(); j++)
+      for (auto vn : ext)
+        if (dslip[j].contains(vn)) {
+          res.get<double>(varnames_[i]+"_"+vn) -=
+              Li3 * (i == j ? J1 : J2) * dslip[j].get<double>(vn);
+        }
   }
 
   return res;
@@ -756,7 +841,12 @@ HuCocksHardening::HuCocksHardening(ParameterSet & params) :
     ap_(params.get_parameter<double>("ap")),
     ac_(params.get_parameter<double>("ac")),
     b_(params.get_parameter<double>("b")),
-    G_(params.get_object_parameter<Interpolate>("G"))
+    G_(params.get_object_parameter<Interpolate>("G")),
+    decouple_(params.get_parameter<bool>("decouple_precipitation")),
+    rtol_(params.get_parameter<double>("rtol")),
+    atol_(params.get_parameter<double>("atol")),
+    miter_(params.get_parameter<int>("miter")),
+    max_divide_(params.get_parameter<int>("max_divide"))
 {
   // Alter the varnames of the pmodels...
   size_t i = 0;
@@ -767,6 +857,12 @@ HuCocksHardening::HuCocksHardening(ParameterSet & params) :
     }
     pnames_.push_back(new_varnames);
     pmodel->set_varnames(new_varnames);
+
+    std::vector<std::string> tnames;
+    for (size_t j = 0; j < pmodel->nterms(); j++)
+      tnames.push_back("temperature_terms_" + std::to_string(i) + "_" +
+                       std::to_string(j));
+    tnames_.push_back(tnames);
     i++;
   }
   init_cache_();
@@ -793,12 +889,20 @@ ParameterSet HuCocksHardening::parameters()
   pset.add_parameter<double>("b");
   pset.add_parameter<NEMLObject>("G");
 
+  pset.add_optional_parameter<bool>("decouple_precipitation", false);
+  pset.add_optional_parameter<double>("rtol", 1.0e-10);
+  pset.add_optional_parameter<double>("atol", 1.0e-20);
+  pset.add_optional_parameter<int>("miter", 30);
+  pset.add_optional_parameter<int>("max_divide", 8);
+
   return pset;
 }
 
 std::vector<std::string> HuCocksHardening::varnames() const
 {
   std::vector<std::string> names = dmodel_->varnames();
+  if (decouple_) return names;
+
   for (auto pmodel : pmodels_) {
     auto pn = pmodel->varnames();
     names.insert(names.end(), pn.begin(), pn.end());
@@ -815,14 +919,18 @@ void HuCocksHardening::set_varnames(std::vector<std::string> vars)
 void HuCocksHardening::populate_history(History & history) const
 {
   dmodel_->populate_history(history);
+  if (decouple_) return;
+
   for (auto pmodel : pmodels_)
     pmodel->populate_history(history);
 }
 
 void HuCocksHardening::init_history(History & history) const
 {
-  history.zero();
+  // Only touch our own variables, the history belongs to the whole crystal
   dmodel_->init_history(history);
+  if (decouple_) return;
+
   for (auto pmodel : pmodels_)
     pmodel->init_history(history);
 }
@@ -833,8 +941,9 @@ double HuCocksHardening::hist_to_tau(size_t g, size_t i,
                                            double T, const History & fixed) const
 {
   double tau_d = dmodel_->hist_to_tau(g, i, history, L, T, fixed);
-  double c = c_eff_(history, T);
-  double NA = NA_eff_(history, T); 
+  const History & P = precipitation_(history, fixed);
+  double c = c_eff_(P, fixed, T);
+  double NA = NA_eff_(P, T); 
 
   double tau_p = ap_ * G_->value(T) * b_ * std::sqrt(NA);
   double tau_c = ac_ * G_->value(T) * b_ * std::sqrt(c * b_);
@@ -852,8 +961,9 @@ History HuCocksHardening::d_hist_to_tau(size_t g, size_t i,
 
   // Commonly-used things
   double tau_d = dmodel_->hist_to_tau(g, i, history, L, T, fixed);
-  double c = c_eff_(history, T);
-  double NA = NA_eff_(history, T); 
+  const History & P = precipitation_(history, fixed);
+  double c = c_eff_(P, fixed, T);
+  double NA = NA_eff_(P, T); 
 
   double tau_p = ap_ * G_->value(T) * b_ * std::sqrt(NA);
 
@@ -861,16 +971,21 @@ History HuCocksHardening::d_hist_to_tau(size_t g, size_t i,
   History dd = dmodel_->d_hist_to_tau(g, i, history, L, T, fixed);
   dd.scalar_multiply(tau_d / std::sqrt(tau_p * tau_p + tau_d * tau_d));
   std::copy(dd.rawptr(), dd.rawptr()+dd.size(), res.rawptr());
+
+  // The precipitation variables are not unknowns when decoupled
+  if (decouple_) return res;
   
   // For each precipitation model
   for (size_t i = 0; i < pmodels_.size(); i++) {
     // Second block: f
-    auto dc = pmodels_[i]->dc_df(pmodels_[i]->f(history),T);
-    for (auto dci: dc)
-      res.get<double>(pnames_[i][0]) += (ac_ * G_->value(T) * b_ * b_ / (2.0 *
-                                                                       std::sqrt(c
-                                                                                 * b_))
-          * dci / pmodels_[i]->vm())*pmodels_[i]->fs();
+    HuCocksTemperatureTerms scratch;
+    double cs, dcs;
+    pmodels_[i]->c_sum(pmodels_[i]->f(history),
+                       terms_(i, fixed, T, scratch), cs, dcs);
+    res.get<double>(pnames_[i][0]) = (ac_ * G_->value(T) * b_ * b_ / (2.0 *
+                                                                    std::sqrt(c
+                                                                              * b_))
+        * dcs / pmodels_[i]->vm())*pmodels_[i]->fs();
 
     // Third block: r
     res.get<double>(pnames_[i][1]) = (tau_p / std::sqrt(tau_p * tau_p + tau_d *
@@ -903,10 +1018,14 @@ History HuCocksHardening::hist(const Symmetric & stress,
   auto h1 = dmodel_->hist(stress, Q, history, L, T, R, fixed);
   std::copy(h1.rawptr(), h1.rawptr() + h1.size(), 
             res.start_loc(dmodel_->varnames()[0]));
+  if (decouple_) return res;
+
   for (size_t i = 0; i < pmodels_.size(); i++) {
-    auto rate = pmodels_[i]->rate(history, T);
-    for (size_t j = 0; j < 3; j++)
-      res.get<double>(pnames_[i][j]) = rate[j];
+    double x[3] = {history.get<double>(pnames_[i][0]),
+      history.get<double>(pnames_[i][1]), history.get<double>(pnames_[i][2])};
+    HuCocksTemperatureTerms scratch;
+    pmodels_[i]->scaled_evaluate(x, terms_(i, fixed, T, scratch),
+                                 res.start_loc(pnames_[i][0]), nullptr);
   }
 
   return res;
@@ -921,6 +1040,7 @@ History HuCocksHardening::d_hist_d_s(const Symmetric & stress,
 {
   // This could be non-zero
   History res = dmodel_->d_hist_d_s(stress, Q, history, L, T, R, fixed);
+  if (decouple_) return res;
 
   // These are zero
   for (size_t i = 0; i < pmodels_.size(); i++) {
@@ -940,6 +1060,10 @@ History HuCocksHardening::d_hist_d_h(const Symmetric & stress,
                                            double T, const SlipRule & R, 
                                            const History & fixed) const
 {
+  // Only the dislocation model is left in the solve
+  if (decouple_)
+    return dmodel_->d_hist_d_h(stress, Q, history, L, T, R, fixed);
+
   // Cache some useful objects
   std::vector<History> phists;
   for (auto pmodel : pmodels_) {
@@ -963,11 +1087,15 @@ History HuCocksHardening::d_hist_d_h(const Symmetric & stress,
         res.add_union(phists[i].history_derivative(phists[j]).zero());
     }
     // actual non-zeros
-    auto jac = pmodels_[i]->jac(history, T);
+    double x[3] = {history.get<double>(pnames_[i][0]),
+      history.get<double>(pnames_[i][1]), history.get<double>(pnames_[i][2])};
+    HuCocksTemperatureTerms scratch;
+    double xdot[3], jac[9];
+    pmodels_[i]->scaled_evaluate(x, terms_(i, fixed, T, scratch), xdot, jac);
     for (size_t ii = 0; ii < 3; ii++) {
       for (size_t jj = 0; jj < 3; jj++) {
         res.add<double>(pnames_[i][ii]+"_"+pnames_[i][jj]);
-        res.get<double>(pnames_[i][ii]+"_"+pnames_[i][jj]) = jac[ii][jj];
+        res.get<double>(pnames_[i][ii]+"_"+pnames_[i][jj]) = jac[CINDEX(ii,jj,3)];
       }
     }
   }
@@ -1001,13 +1129,80 @@ History HuCocksHardening::d_hist_d_h_ext(const Symmetric & stress,
   return res;
 }
 
-double HuCocksHardening::c_eff_(const History & history, double T) const
+void HuCocksHardening::populate_decoupled(History & history) const
+{
+  dmodel_->populate_decoupled(history);
+  if (! decouple_) return;
+
+  for (auto pmodel : pmodels_)
+    pmodel->populate_history(history);
+}
+
+void HuCocksHardening::init_decoupled(History & history) const
+{
+  dmodel_->init_decoupled(history);
+  if (! decouple_) return;
+
+  for (auto pmodel : pmodels_)
+    pmodel->init_history(history);
+}
+
+void HuCocksHardening::update_decoupled(History & fixed_np1,
+                                        const History & fixed_n,
+                                        double T_np1, double T_n,
+                                        double t_np1, double t_n) const
+{
+  dmodel_->update_decoupled(fixed_np1, fixed_n, T_np1, T_n, t_np1, t_n);
+  if (! decouple_) return;
+
+  for (size_t i = 0; i < pmodels_.size(); i++) {
+    double x_n[3], x_np1[3];
+    for (size_t j = 0; j < 3; j++)
+      x_n[j] = fixed_n.get<double>(pnames_[i][j]);
+    integrate_precipitation_(i, x_np1, x_n, T_np1, T_n, t_np1 - t_n);
+    for (size_t j = 0; j < 3; j++)
+      fixed_np1.get<double>(pnames_[i][j]) = x_np1[j];
+  }
+}
+
+void HuCocksHardening::populate_fixed(History & fixed, double T) const
+{
+  dmodel_->populate_fixed(fixed, T);
+
+  // The precipitation terms only depend on temperature, so evaluate them
+  // once for the substep rather than in every rate and jacobian call
+  for (size_t i = 0; i < pmodels_.size(); i++) {
+    for (auto name : tnames_[i])
+      fixed.add<double>(name);
+    HuCocksTemperatureTerms terms;
+    pmodels_[i]->temperature_terms(T, terms);
+    std::copy(terms.data.begin(), terms.data.end(),
+              fixed.start_loc(tnames_[i][0]));
+  }
+}
+
+const double * HuCocksHardening::terms_(size_t i, const History & fixed,
+                                        double T,
+                                        HuCocksTemperatureTerms & scratch) const
+{
+  if (fixed.contains(tnames_[i][0])) {
+    const double * t = fixed.rawptr() + fixed.get_loc().at(tnames_[i][0]);
+    if (t[TT_T] == T) return t;
+  }
+  pmodels_[i]->temperature_terms(T, scratch);
+  return &scratch.data[0];
+}
+
+double HuCocksHardening::c_eff_(const History & history,
+                                const History & fixed, double T) const
 {
   double res = 0.0;
   for (size_t i = 0; i < pmodels_.size(); i++) {
-    auto c = pmodels_[i]->c(pmodels_[i]->f(history), T);
-    for (auto ci : c)
-      res += ci / pmodels_[i]->vm();
+    HuCocksTemperatureTerms scratch;
+    double cs, dcs;
+    pmodels_[i]->c_sum(pmodels_[i]->f(history),
+                       terms_(i, fixed, T, scratch), cs, dcs);
+    res += cs / pmodels_[i]->vm();
   }
   return res;
 }
@@ -1021,6 +1216,43 @@ double HuCocksHardening::NA_eff_(const History & history, double T) const
   return res;
 }
 
+const History & HuCocksHardening::precipitation_(const History & history,
+                                                 const History & fixed) const
+{
+  return decouple_ ? fixed : history;
+}
+
+void HuCocksHardening::integrate_precipitation_(size_t i,
+                                                double * const x_np1,
+                                                const double * const x_n,
+                                                double T_np1, double T_n,
+                                                double dt) const
+{
+  // Same adaptive strategy as the crystal update: halve the step until the
+  // backward Euler solve goes through.  For isothermal steps the temperature
+  // terms are only evaluated once.
+  HuCocksTemperatureTerms terms;
+  for (int divide = 0; divide <= max_divide_; divide++) {
+    int nsteps = 1 << divide;
+    double x[3] = {x_n[0], x_n[1], x_n[2]};
+    try {
+      for (int k = 0; k < nsteps; k++) {
+        double T = T_n + (T_np1 - T_n) * (k + 1) / nsteps;
+        pmodels_[i]->temperature_terms(T, terms);
+        pmodels_[i]->integrate(x, x, terms, dt / nsteps, rtol_, atol_,
+                               miter_);
+      }
+    }
+    catch (const NEMLError & e) {
+      continue;
+    }
+    std::copy(x, x+3, x_np1);
+    return;
+  }
+  throw NonlinearSolverError("Exceeded maximum adaptive subdivisions "
+                             "integrating precipitation");
+}
+
 ArrheniusSlipRule::ArrheniusSlipRule(ParameterSet & params) :
     SlipStrengthSlipRule(params),
     g0_(params.get_parameter<double>("g0")),
@@ -10,6 +10,29 @@ InelasticModel::InelasticModel(ParameterSet & params) :
 
 }
 
+void InelasticModel::populate_decoupled(History & history) const
+{
+
+}
+
+void InelasticModel::init_decoupled(History & history) const
+{
+
+}
+
+void InelasticModel::update_decoupled(History & fixed_np1,
+                                      const History & fixed_n,
+                                      double T_np1, double T_n,
+                                      double t_np1, double t_n) const
+{
+
+}
+
+void InelasticModel::populate_fixed(History & fixed, double T) const
+{
+
+}
+
 bool InelasticModel::use_nye() const
 {
   return false;
@@ -327,6 +350,29 @@ History AsaroInelasticity::d_w_p_d_history(const Symmetric & stress,
   return h;
 }
 
+void AsaroInelasticity::populate_decoupled(History & history) const
+{
+  rule_->populate_decoupled(history);
+}
+
+void AsaroInelasticity::init_decoupled(History & history) const
+{
+  rule_->init_decoupled(history);
+}
+
+void AsaroInelasticity::update_decoupled(History & fixed_np1,
+                                         const History & fixed_n,
+                                         double T_np1, double T_n,
+                                         double t_np1, double t_n) const
+{
+  rule_->update_decoupled(fixed_np1, fixed_n, T_np1, T_n, t_np1, t_n);
+}
+
+void AsaroInelasticity::populate_fixed(History & fixed, double T) const
+{
+  rule_->populate_fixed(fixed, T);
+}
+
 bool AsaroInelasticity::use_nye() const
 {
   return rule_->use_nye();
@@ -652,6 +698,33 @@ History CombinedInelasticity::d_w_p_d_history(const Symmetric & stress,
   return hist;
 }
 
+void CombinedInelasticity::populate_decoupled(History & history) const
+{
+  for (auto model : models_)
+    model->populate_decoupled(history);
+}
+
+void CombinedInelasticity::init_decoupled(History & history) const
+{
+  for (auto model : models_)
+    model->init_decoupled(history);
+}
+
+void CombinedInelasticity::update_decoupled(History & fixed_np1,
+                                            const History & fixed_n,
+                                            double T_np1, double T_n,
+                                            double t_np1, double t_n) const
+{
+  for (auto model : models_)
+    model->update_decoupled(fixed_np1, fixed_n, T_np1, T_n, t_np1, t_n);
+}
+
+void CombinedInelasticity::populate_fixed(History & fixed, double T) const
+{
+  for (auto model : models_)
+    model->populate_fixed(fixed, T);
+}
+
 bool CombinedInelasticity::use_nye() const
 {
   for (auto model : models_) {
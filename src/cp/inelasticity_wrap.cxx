@@ -25,6 +25,10 @@ PYBIND11_MODULE(inelasticity, m) {
       .def("w_p", &InelasticModel::w_p)
       .def("d_w_p_d_stress", &InelasticModel::d_w_p_d_stress)
       .def("d_w_p_d_history", &InelasticModel::d_w_p_d_history)
+      .def("populate_decoupled", &InelasticModel::populate_decoupled)
+      .def("init_decoupled", &InelasticModel::init_decoupled)
+      .def("update_decoupled", &InelasticModel::update_decoupled)
+      .def("populate_fixed", &InelasticModel::populate_fixed)
       .def_property_readonly("use_nye", &InelasticModel::use_nye)
       ;
 
@@ -43,6 +43,24 @@ History KinematicModel::d_history_rate_d_w_decouple(
   return history.derivative<Skew>();
 }
 
+void KinematicModel::populate_decoupled(History & history) const
+{
+
+}
+
+void KinematicModel::init_decoupled(History & history) const
+{
+
+}
+
+void KinematicModel::update_decoupled(History & fixed_np1,
+                                      const History & fixed_n,
+                                      double T_np1, double T_n,
+                                      double t_np1, double t_n) const
+{
+
+}
+
 bool KinematicModel::use_nye() const
 {
   return false;
@@ -104,12 +122,21 @@ History StandardKinematicModel::decouple(
   constant.add<SymSymR4>("C");
   constant.add<SymSymR4>("S");
 
-  constant.get<Skew>("espin") = spin(stress, d, w, Q, history, lattice, T, fixed);
+  // The rotated elastic tensors are fixed over the step, so evaluate them
+  // once here and let everything else use these copies
   constant.get<SymSymR4>("C") = emodel_->C(T,Q);
   constant.get<SymSymR4>("S") = emodel_->S(T,Q);
   
-  // Return with whatever extra multiphysics variables you need
-  return constant.add_union(fixed);
+  // Along with whatever extra multiphysics variables you need
+  constant.add_union(fixed);
+
+  // And anything the inelastic model only evaluates once per substep
+  imodel_->populate_fixed(constant, T);
+
+  constant.get<Skew>("espin") = spin(stress, d, w, Q, history, lattice, T,
+                                     constant);
+
+  return constant;
 }
 
 Symmetric StandardKinematicModel::stress_rate(
@@ -249,7 +276,7 @@ Skew StandardKinematicModel::spin(
     const History & history, Lattice & lattice,
     double T, const History & fixed) const
 {
-  SymSymR4 S = emodel_->S(T, Q);
+  SymSymR4 S = S_(T, Q, fixed);
   Symmetric e = S.dot(stress);
 
   Skew wp = imodel_->w_p(stress, Q, history, lattice, T, fixed);
@@ -271,17 +298,49 @@ Symmetric StandardKinematicModel::elastic_strains(
 Symmetric StandardKinematicModel::stress_increment(
     const Symmetric & stress,
     const Symmetric & D, const Skew & W, double dt, Lattice & lattice, const Orientation & Q,
-    const History & history, double T)
+    const History & history, double T, const History & fixed)
 {
-  SymSymR4 C = emodel_->C(T,Q);
+  SymSymR4 C = C_(T, Q, fixed);
   return C.dot(D) * dt;
 }
 
+void StandardKinematicModel::populate_decoupled(History & history) const
+{
+  imodel_->populate_decoupled(history);
+}
+
+void StandardKinematicModel::init_decoupled(History & history) const
+{
+  imodel_->init_decoupled(history);
+}
+
+void StandardKinematicModel::update_decoupled(History & fixed_np1,
+                                              const History & fixed_n,
+                                              double T_np1, double T_n,
+                                              double t_np1, double t_n) const
+{
+  imodel_->update_decoupled(fixed_np1, fixed_n, T_np1, T_n, t_np1, t_n);
+}
+
 bool StandardKinematicModel::use_nye() const
 {
   return imodel_->use_nye();
 }
 
+SymSymR4 StandardKinematicModel::C_(double T, const Orientation & Q,
+                                    const History & fixed) const
+{
+  if (fixed.contains("C")) return fixed.get<SymSymR4>("C");
+  return emodel_->C(T, Q);
+}
+
+SymSymR4 StandardKinematicModel::S_(double T, const Orientation & Q,
+                                    const History & fixed) const
+{
+  if (fixed.contains("S")) return fixed.get<SymSymR4>("S");
+  return emodel_->S(T, Q);
+}
+
 DamagedStandardKinematicModel::DamagedStandardKinematicModel(
     ParameterSet & params) :
       StandardKinematicModel(params),
@@ -565,7 +624,7 @@ Skew DamagedStandardKinematicModel::spin(
   History ihist = ihist_(history);
   History dhist = dhist_(history);
 
-  SymSymR4 S = emodel_->S(T, Q);
+  SymSymR4 S = S_(T, Q, fixed);
   SymSymR4 P = dmodel_->projection(stress, dhist, Q, lattice,
                                    amodel_->slip_rule(), T);
   Symmetric e = S.dot(P.inverse()).dot(stress);
@@ -591,9 +650,9 @@ Symmetric DamagedStandardKinematicModel::elastic_strains(
 Symmetric DamagedStandardKinematicModel::stress_increment(
     const Symmetric & stress,
     const Symmetric & D, const Skew & W, double dt, Lattice & lattice, const Orientation & Q,
-    const History & history, double T)
+    const History & history, double T, const History & fixed)
 {
-  SymSymR4 C = emodel_->C(T,Q);
+  SymSymR4 C = C_(T, Q, fixed);
   SymSymR4 P = dmodel_->projection(stress, history, Q, lattice,
                                    amodel_->slip_rule(), T);
   return P.dot(C.dot(D*dt));
@@ -42,6 +42,9 @@ PYBIND11_MODULE(kinematics, m) {
 
       .def("elastic_strains", &KinematicModel::elastic_strains)
 
+      .def("populate_decoupled", &KinematicModel::populate_decoupled)
+      .def("init_decoupled", &KinematicModel::init_decoupled)
+      .def("update_decoupled", &KinematicModel::update_decoupled)
       .def_property_readonly("use_nye", &KinematicModel::use_nye)
       ;
 
@@ -2,15 +2,34 @@
 
 #include "cp/batch.h"
 
+#include "math/nemlmath.h"
+#include "parallel.h"
+#include "solvers.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 namespace neml {
 
-PolycrystalModel::PolycrystalModel(ParameterSet & params) :
+PolycrystalModel::PolycrystalModel(ParameterSet & params,
+                                   bool grain_deformation) :
     NEMLModel_ldi(params),
     model_(params.get_object_parameter<SingleCrystalModel>("model")),
     q0s_(params.get_object_parameter_vector<Orientation>("qs")),
-    nthreads_(params.get_parameter<int>("nthreads"))
+    nthreads_(params.get_parameter<int>("nthreads")),
+    grain_deformation_(grain_deformation)
 {
+  std::string layout = params.get_parameter<std::string>("layout");
+  if (layout == "blocked")
+    interleaved_ = false;
+  else if (layout == "interleaved")
+    interleaved_ = true;
+  else
+    throw std::invalid_argument("Unknown polycrystal layout " + layout);
 
+  block_ = model_->nstore() + 6 + (grain_deformation_ ? 9 : 0);
+  if (interleaved_) block_ = 8 * ((block_ + 7) / 8);
 }
 
 size_t PolycrystalModel::n() const
@@ -20,70 +39,157 @@ size_t PolycrystalModel::n() const
 
 size_t PolycrystalModel::nhist() const
 {
-  return (model_->nstore() + 6 + 6 + 3) * n();
+  return block_ * n() + nshared();
 }
 
 void PolycrystalModel::init_hist(double * const hist) const
 {
+  std::fill(hist, hist + PolycrystalModel::nhist(), 0.0);
   for (size_t i = 0; i < n(); i++) {
     model_->init_store(history(hist, i));
     model_->set_active_orientation(history(hist,i), *q0s_[i]);
-
-    std::fill(stress(hist, i), stress(hist, i) + 6, 0);
-    std::fill(d(hist, i), d(hist, i) + 6, 0);
-    std::fill(w(hist, i), w(hist, i) + 3, 0);
   }
+  init_shared_(hist);
 }
 
 double * PolycrystalModel::history(double * const store, size_t i) const 
 {
-  return &(store[i*(model_->nstore())]);
+  return &(store[history_offset_(i)]);
 }
 
 double * PolycrystalModel::stress(double * const store, size_t i) const
 {
-  return &(store[n()*(model_->nstore()) + i * 6]);
+  return &(store[stress_offset_(i)]);
 }
 
 double * PolycrystalModel::d(double * const store, size_t i) const
 {
-  return &(store[n()*(model_->nstore() + 6) + i * 6]);
+  return &(store[d_offset_(i)]);
 }
 
 double * PolycrystalModel::w(double * const store, size_t i) const
 {
-  return &(store[n()*(model_->nstore() + 6 + 6) + i * 3]); 
+  return &(store[w_offset_(i)]);
 }
 
 const double * PolycrystalModel::history(const double * const store, size_t i) const 
 {
-  return &(store[i*(model_->nstore())]);
+  return &(store[history_offset_(i)]);
 }
 
 const double * PolycrystalModel::stress(const double * const store, size_t i) const
 {
-  return &(store[n()*(model_->nstore()) + i * 6]);
+  return &(store[stress_offset_(i)]);
 }
 
 const double * PolycrystalModel::d(const double * const store, size_t i) const
 {
-  return &(store[n()*(model_->nstore() + 6) + i * 6]);
+  return &(store[d_offset_(i)]);
 }
 
 const double * PolycrystalModel::w(const double * const store, size_t i) const
 {
-  return &(store[n()*(model_->nstore() + 6 + 6) + i * 3]); 
+  return &(store[w_offset_(i)]);
+}
+
+size_t PolycrystalModel::nshared() const
+{
+  return model_->ndecoupled();
+}
+
+double * PolycrystalModel::shared(double * const store) const
+{
+  return &(store[block_ * n()]);
+}
+
+const double * PolycrystalModel::shared(const double * const store) const
+{
+  return &(store[block_ * n()]);
+}
+
+CrystalBatchStrides PolycrystalModel::strides() const
+{
+  size_t dw = grain_deformation_ ? 1 : 0;
+  if (interleaved_)
+    return {dw * block_, dw * block_, block_, block_};
+  else
+    return {dw * 6, dw * 3, 6, model_->nstore()};
+}
+
+bool PolycrystalModel::interleaved() const
+{
+  return interleaved_;
+}
+
+size_t PolycrystalModel::history_offset_(size_t i) const
+{
+  return interleaved_ ? i * block_ : i * model_->nstore();
+}
+
+size_t PolycrystalModel::stress_offset_(size_t i) const
+{
+  size_t nh = model_->nstore();
+  return interleaved_ ? i * block_ + nh : n() * nh + i * 6;
+}
+
+size_t PolycrystalModel::d_offset_(size_t i) const
+{
+  if (! grain_deformation_)
+    throw NEMLError("This polycrystal model does not store per crystal "
+                    "deformations");
+  size_t nh = model_->nstore();
+  return interleaved_ ? i * block_ + nh + 6 : n() * (nh + 6) + i * 6;
+}
+
+size_t PolycrystalModel::w_offset_(size_t i) const
+{
+  if (! grain_deformation_)
+    throw NEMLError("This polycrystal model does not store per crystal "
+                    "deformations");
+  size_t nh = model_->nstore();
+  return interleaved_ ? i * block_ + nh + 12 : n() * (nh + 12) + i * 3;
+}
+
+void PolycrystalModel::init_shared_(double * const hist) const
+{
+  const double * src = history(hist, 0) + model_->decoupled_location();
+  std::copy(src, src + model_->ndecoupled(), shared(hist));
+}
+
+void PolycrystalModel::update_shared_(double * const h_np1,
+                                      const double * const h_n,
+                                      double T_np1, double T_n,
+                                      double t_np1, double t_n,
+                                      size_t nc) const
+{
+  size_t nd = model_->ndecoupled();
+  if (nd == 0) return;
+
+  model_->update_decoupled(shared(h_np1), shared(h_n), T_np1, T_n, t_np1,
+                           t_n);
+
+  size_t loc = model_->decoupled_location();
+  for (size_t i = 0; i < nc; i++)
+    std::copy(shared(h_np1), shared(h_np1) + nd, history(h_np1, i) + loc);
 }
 
 std::vector<Orientation> PolycrystalModel::orientations(double * const store) const
 {
-  std::vector<Orientation> res;
-  
-  get_orientation_passive_batch(*model_, n(), 
-                                history(store, 0), res);
+  std::vector<Orientation> res(n());
+  std::vector<double> q(4 * n());
+  orientations(store, &q[0]);
+  for (size_t i = 0; i < n(); i++)
+    res[i] = Orientation(std::vector<double>(&q[4*i], &q[4*i]+4));
   return res;
 }
 
+void PolycrystalModel::orientations(const double * const store,
+                                    double * const q) const
+{
+  get_orientation_passive_batch(*model_, n(), history(store, 0), q,
+                                strides().h);
+}
+
 TaylorModel::TaylorModel(ParameterSet & params) :
     PolycrystalModel(params)
 {
@@ -102,6 +208,7 @@ ParameterSet TaylorModel::parameters()
   pset.add_parameter<NEMLObject>("model");
   pset.add_parameter<std::vector<NEMLObject>>("qs");
   pset.add_optional_parameter<int>("nthreads", 1);
+  pset.add_optional_parameter<std::string>("layout", std::string("blocked"));
 
   return pset;
 }
@@ -132,14 +239,18 @@ void TaylorModel::update_ld_inc(
    double & u_np1, double u_n,
    double & p_np1, double p_n)
 {
+  bool tangent = (A_np1 != nullptr);
+
   std::fill(s_np1, s_np1+6, 0);
-  std::fill(A_np1, A_np1+36, 0);
-  std::fill(B_np1, B_np1+18, 0);
+  if (tangent) {
+    std::fill(A_np1, A_np1+36, 0);
+    std::fill(B_np1, B_np1+18, 0);
+  }
   u_np1 = 0;
   p_np1 = 0;
 
-  double * A_local = new double[36*n()];
-  double * B_local = new double[18*n()];
+  double * A_local = tangent ? new double[36*n()] : nullptr;
+  double * B_local = tangent ? new double[18*n()] : nullptr;
   double * u_local = new double[n()];
   double * p_local = new double[n()];
 
@@ -151,21 +262,19 @@ void TaylorModel::update_ld_inc(
   double * Ts_n = new double[n()];
   std::fill(Ts_n, Ts_n+n(), T_n);
 
-  for (size_t i = 0; i < n(); i++) {
-    std::copy(d_np1, d_np1+6, d(h_np1, i));
-    std::copy(w_np1, w_np1+3, w(h_np1, i));
-  }
+  update_shared_(h_np1, h_n, T_np1, T_n, t_np1, t_n, n());
 
-  evaluate_crystal_batch(*model_, n(), 
-                         d(h_np1, 0), d(h_n, 0),
-                         w(h_np1, 0), w(h_n, 0),
+  // Every crystal shares the macroscale deformation
+  evaluate_crystal_batch(*model_, n(), strides(),
+                         d_np1, d_n,
+                         w_np1, w_n,
                          Ts_np1, Ts_n,
                          t_np1, t_n,
                          stress(h_np1, 0), stress(h_n, 0),
                          history(h_np1, 0), history(h_n, 0),
                          A_local, B_local,
                          u_local, zero,
-                         p_local, zero, nthreads_);
+                         p_local, zero, nthreads_, false);
   
   delete [] zero;
   delete [] Ts_np1;
@@ -173,8 +282,10 @@ void TaylorModel::update_ld_inc(
                          
   for (size_t i = 0; i < n(); i++) {
     for (size_t j = 0; j < 6; j++) s_np1[j] += stress(h_np1, i)[j];
-    for (size_t j = 0; j < 36; j++) A_np1[j] += A_local[i*36+j];
-    for (size_t j = 0; j < 18; j++) B_np1[j] += B_local[i*18+j];
+    if (tangent) {
+      for (size_t j = 0; j < 36; j++) A_np1[j] += A_local[i*36+j];
+      for (size_t j = 0; j < 18; j++) B_np1[j] += B_local[i*18+j];
+    }
     u_np1 += u_local[i];
     p_np1 += p_local[i];
   }
@@ -185,8 +296,10 @@ void TaylorModel::update_ld_inc(
   delete [] p_local;
 
   for (size_t j = 0; j < 6; j++) s_np1[j] /= n();
-  for (size_t j = 0; j < 36; j++) A_np1[j] /= n();
-  for (size_t j = 0; j < 18; j++) B_np1[j] /= n();
+  if (tangent) {
+    for (size_t j = 0; j < 36; j++) A_np1[j] /= n();
+    for (size_t j = 0; j < 18; j++) B_np1[j] /= n();
+  }
 
   u_np1 /= n();
   p_np1 /= n();
@@ -200,6 +313,12 @@ double TaylorModel::alpha(double T) const
   return model_->alpha(T);
 }
 
+void TaylorModel::alpha(const double * const T, double * const a,
+                        size_t n) const
+{
+  model_->alpha(T, a, n);
+}
+
 void TaylorModel::elastic_strains(const double * const s_np1, 
                                  double T_np1, const double * const h_np1, 
                                  double * const e_np1) const
@@ -210,10 +329,844 @@ void TaylorModel::elastic_strains(const double * const s_np1,
   for (size_t i = 0; i < n(); i++) {
     model_->elastic_strains(stress(h_np1, i), T_np1, history(h_np1, i),
                             e_local);
-    for (size_t j = 0; j < n(); j++) e_np1[j] += e_local[j];
+    for (size_t j = 0; j < 6; j++) e_np1[j] += e_local[j];
+  }
+
+  for (size_t j = 0; j < 6; j++) e_np1[j] /= n();
+}
+
+ClusteredTaylorModel::ClusteredTaylorModel(ParameterSet & params) :
+    PolycrystalModel(params),
+    adaptive_(params.get_parameter<bool>("adaptive")),
+    split_tol_(params.get_parameter<double>("split_tol")),
+    iterations_(params.get_parameter<int>("iterations")),
+    ninitial_(q0s_.size())
+{
+  int k = params.get_parameter<int>("nclusters");
+  int kmax = params.get_parameter<int>("max_clusters");
+  if ((k < 1) || (ninitial_ == 0))
+    throw std::invalid_argument("ClusteredTaylorModel needs at least one "
+                                "orientation and one cluster");
+
+  nclusters_ = std::min((size_t) k, ninitial_);
+  if (adaptive_) {
+    size_t kcap = (kmax > 0) ? (size_t) kmax : 2 * nclusters_;
+    capacity_ = std::max(nclusters_, std::min(kcap, ninitial_));
+  }
+  else {
+    capacity_ = nclusters_;
+  }
+
+  // Store every symmetrically equivalent copy of the initial orientations so
+  // the disorientation is just a max over dot products.  The orientations
+  // are active, rotating the lattice vectors, so the equivalents are Q * S
+  auto ops = model_->symmetry()->ops();
+  nops_ = ops.size();
+  equivalents_.resize(ninitial_ * nops_ * 4);
+  for (size_t i = 0; i < ninitial_; i++) {
+    for (size_t j = 0; j < nops_; j++) {
+      Orientation e = (*q0s_[i]) * ops[j];
+      std::copy(e.quat(), e.quat() + 4, &equivalents_[(i*nops_+j)*4]);
+    }
+  }
+
+  cluster_(nclusters_);
+}
+
+std::string ClusteredTaylorModel::type()
+{
+  return "ClusteredTaylorModel";
+}
+
+ParameterSet ClusteredTaylorModel::parameters()
+{
+  ParameterSet pset(ClusteredTaylorModel::type());
+  
+  pset.add_parameter<NEMLObject>("model");
+  pset.add_parameter<std::vector<NEMLObject>>("qs");
+  pset.add_parameter<int>("nclusters");
+  pset.add_optional_parameter<int>("nthreads", 1);
+  pset.add_optional_parameter<std::string>("layout", std::string("blocked"));
+  pset.add_optional_parameter<bool>("adaptive", false);
+  pset.add_optional_parameter<int>("max_clusters", 0);
+  pset.add_optional_parameter<double>("split_tol", 0.05);
+  pset.add_optional_parameter<int>("iterations", 10);
+
+  return pset;
+}
+
+std::unique_ptr<NEMLObject> ClusteredTaylorModel::initialize(
+    ParameterSet & params)
+{
+  return neml::make_unique<ClusteredTaylorModel>(params);
+}
+
+size_t ClusteredTaylorModel::n() const
+{
+  return adaptive_ ? 2 * capacity_ : capacity_;
+}
+
+size_t ClusteredTaylorModel::nhist() const
+{
+  // The crystals, then the number of active clusters, the weights,
+  // representatives, and probes of each cluster, and the cluster of each
+  // initial orientation
+  return PolycrystalModel::nhist() + 1 + 3 * capacity_ + ninitial_;
+}
+
+void ClusteredTaylorModel::init_hist(double * const hist) const
+{
+  double * cl = clusters_(hist);
+  std::fill(cl, cl + 1 + 3 * capacity_ + ninitial_, 0.0);
+
+  cl[0] = nclusters_;
+  for (size_t i = 0; i < ninitial_; i++) {
+    cl[1 + 3*capacity_ + i] = members_[i];
+    cl[1 + members_[i]] += 1.0 / ninitial_;
+  }
+  for (size_t c = 0; c < nclusters_; c++)
+    cl[1 + capacity_ + c] = representatives_[c];
+
+  std::fill(hist, hist + PolycrystalModel::nhist(), 0.0);
+  for (size_t i = 0; i < n(); i++)
+    model_->init_store(history(hist, i));
+
+  for (size_t c = 0; c < nclusters_; c++)
+    model_->set_active_orientation(history(hist, c),
+                                   *q0s_[representatives_[c]]);
+  init_shared_(hist);
+
+  if (adaptive_) {
+    for (size_t c = 0; c < nclusters_; c++) {
+      cl[1 + 2*capacity_ + c] = furthest_(cl, c);
+      init_probe_(hist, c);
+    }
+  }
+}
+
+size_t ClusteredTaylorModel::nstore() const
+{
+  return nhist();
+}
+
+void ClusteredTaylorModel::init_store(double * const store) const
+{
+  init_hist(store);
+}
+
+void ClusteredTaylorModel::update_ld_inc(
+   const double * const d_np1, const double * const d_n,
+   const double * const w_np1, const double * const w_n,
+   double T_np1, double T_n,
+   double t_np1, double t_n,
+   double * const s_np1, const double * const s_n,
+   double * const h_np1, const double * const h_n,
+   double * const A_np1, double * const B_np1,
+   double & u_np1, double u_n,
+   double & p_np1, double p_n)
+{
+  bool tangent = (A_np1 != nullptr);
+  size_t nh = model_->nstore();
+
+  const double * cl_n = clusters_(h_n);
+  double * cl_np1 = clusters_(h_np1);
+  std::copy(cl_n, cl_n + 1 + 3 * capacity_ + ninitial_, cl_np1);
+  size_t k = nclusters(h_n);
+
+  // The inactive slots just carry their state forward
+  for (size_t i = 0; i < n(); i++) {
+    if ((i % capacity_) >= k) {
+      std::copy(history(h_n, i), history(h_n, i) + nh, history(h_np1, i));
+      std::copy(stress(h_n, i), stress(h_n, i) + 6, stress(h_np1, i));
+    }
+  }
+
+  // After the carry forward, so the inactive slots see it too
+  update_shared_(h_np1, h_n, T_np1, T_n, t_np1, t_n, n());
+
+  std::vector<double> A_local(tangent ? 36 * k : 0);
+  std::vector<double> B_local(tangent ? 18 * k : 0);
+  std::vector<double> u_local(k);
+  std::vector<double> p_local(k);
+  std::vector<double> zero(k, 0.0);
+  std::vector<double> Ts_np1(k, T_np1);
+  std::vector<double> Ts_n(k, T_n);
+
+  // Representatives, which all see the macroscale deformation
+  evaluate_crystal_batch(*model_, k, strides(),
+                         d_np1, d_n,
+                         w_np1, w_n,
+                         &Ts_np1[0], &Ts_n[0],
+                         t_np1, t_n,
+                         stress(h_np1, 0), stress(h_n, 0),
+                         history(h_np1, 0), history(h_n, 0),
+                         tangent ? &A_local[0] : nullptr,
+                         tangent ? &B_local[0] : nullptr,
+                         &u_local[0], &zero[0],
+                         &p_local[0], &zero[0], nthreads_, false);
+
+  std::fill(s_np1, s_np1+6, 0);
+  if (tangent) {
+    std::fill(A_np1, A_np1+36, 0);
+    std::fill(B_np1, B_np1+18, 0);
+  }
+  u_np1 = u_n;
+  p_np1 = p_n;
+
+  for (size_t c = 0; c < k; c++) {
+    double wc = cl_np1[1 + c];
+    for (size_t j = 0; j < 6; j++) s_np1[j] += wc * stress(h_np1, c)[j];
+    if (tangent) {
+      for (size_t j = 0; j < 36; j++) A_np1[j] += wc * A_local[c*36+j];
+      for (size_t j = 0; j < 18; j++) B_np1[j] += wc * B_local[c*18+j];
+    }
+    u_np1 += wc * u_local[c];
+    p_np1 += wc * p_local[c];
+  }
+
+  if (! adaptive_) return;
+
+  // Probes, only to check the clusters
+  std::vector<double> u_probe(k);
+  std::vector<double> p_probe(k);
+  evaluate_crystal_batch(*model_, k, strides(),
+                         d_np1, d_n,
+                         w_np1, w_n,
+                         &Ts_np1[0], &Ts_n[0],
+                         t_np1, t_n,
+                         stress(h_np1, capacity_), stress(h_n, capacity_),
+                         history(h_np1, capacity_), history(h_n, capacity_),
+                         nullptr, nullptr,
+                         &u_probe[0], &zero[0],
+                         &p_probe[0], &zero[0], nthreads_, false);
+
+  // Split the clusters whose probes diverge the most, while there is room.
+  // This only changes the next step, so the update stays explicit
+  double snorm = norm2_vec(s_np1, 6);
+  if (snorm == 0.0) return;
+
+  std::vector<std::pair<double,size_t>> divergence;
+  for (size_t c = 0; c < k; c++) {
+    double diff[6];
+    for (size_t j = 0; j < 6; j++)
+      diff[j] = stress(h_np1, capacity_ + c)[j] - stress(h_np1, c)[j];
+    double dc = norm2_vec(diff, 6) / snorm;
+    if (dc > split_tol_) divergence.push_back(std::make_pair(dc, c));
+  }
+  std::sort(divergence.rbegin(), divergence.rend());
+
+  for (auto dc : divergence) {
+    if (nclusters(h_np1) >= capacity_) break;
+    split_(h_np1, dc.second);
+  }
+}
+
+double ClusteredTaylorModel::alpha(double T) const
+{
+  return model_->alpha(T);
+}
+
+void ClusteredTaylorModel::alpha(const double * const T, double * const a,
+                                 size_t n) const
+{
+  model_->alpha(T, a, n);
+}
+
+void ClusteredTaylorModel::elastic_strains(const double * const s_np1, 
+                                           double T_np1,
+                                           const double * const h_np1, 
+                                           double * const e_np1) const
+{
+  std::fill(e_np1, e_np1+6, 0.0);
+  double e_local[6];
+
+  const double * cl = clusters_(h_np1);
+  for (size_t c = 0; c < nclusters(h_np1); c++) {
+    model_->elastic_strains(stress(h_np1, c), T_np1, history(h_np1, c),
+                            e_local);
+    for (size_t j = 0; j < 6; j++) e_np1[j] += cl[1 + c] * e_local[j];
   }
+}
+
+size_t ClusteredTaylorModel::capacity() const
+{
+  return capacity_;
+}
+
+size_t ClusteredTaylorModel::nclusters(const double * const store) const
+{
+  return (size_t) clusters_(store)[0];
+}
 
-  for (size_t j = 0; j < n(); j++) e_np1[j] /= n();
+std::vector<double> ClusteredTaylorModel::weights(
+    const double * const store) const
+{
+  const double * cl = clusters_(store);
+  return std::vector<double>(cl + 1, cl + 1 + capacity_);
+}
+
+std::vector<size_t> ClusteredTaylorModel::membership(
+    const double * const store) const
+{
+  const double * cl = clusters_(store);
+  std::vector<size_t> res(ninitial_);
+  for (size_t i = 0; i < ninitial_; i++)
+    res[i] = (size_t) cl[1 + 3*capacity_ + i];
+  return res;
+}
+
+double ClusteredTaylorModel::distance(size_t i, size_t j) const
+{
+  // Geodesic distance, as in neml::distance, to the closest symmetrically
+  // equivalent copy Q_i * S of grain i
+  const double * b = q0s_[j]->quat();
+  double best = 0.0;
+  for (size_t k = 0; k < nops_; k++) {
+    const double * a = &equivalents_[(i*nops_+k)*4];
+    double v = std::fabs(a[0]*b[0] + a[1]*b[1] + a[2]*b[2] + a[3]*b[3]);
+    if (v > best) best = v;
+  }
+  return std::acos(std::min(best, 1.0));
+}
+
+double * ClusteredTaylorModel::clusters_(double * const store) const
+{
+  return &(store[PolycrystalModel::nhist()]);
+}
+
+const double * ClusteredTaylorModel::clusters_(
+    const double * const store) const
+{
+  return &(store[PolycrystalModel::nhist()]);
+}
+
+void ClusteredTaylorModel::cluster_(size_t k)
+{
+  // Farthest point seeds, which are deterministic so every copy of the
+  // model agrees on the clusters
+  representatives_.assign(1, 0);
+  std::vector<double> dmin(ninitial_);
+  for (size_t i = 0; i < ninitial_; i++)
+    dmin[i] = distance(i, 0);
+  while (representatives_.size() < k) {
+    size_t next = std::max_element(dmin.begin(), dmin.end()) - dmin.begin();
+    representatives_.push_back(next);
+    for (size_t i = 0; i < ninitial_; i++)
+      dmin[i] = std::min(dmin[i], distance(i, next));
+  }
+
+  // Then k-medoids: assign each orientation to the closest representative
+  // and move each representative to the member closest to the rest
+  members_.resize(ninitial_);
+  auto assign = [this, k]()
+  {
+    for (size_t i = 0; i < ninitial_; i++) {
+      double best = distance(i, representatives_[0]);
+      members_[i] = 0;
+      for (size_t c = 1; c < k; c++) {
+        double dc = distance(i, representatives_[c]);
+        if (dc < best) {
+          best = dc;
+          members_[i] = c;
+        }
+      }
+    }
+  };
+
+  assign();
+  for (int it = 0; it < iterations_; it++) {
+    std::vector<std::vector<size_t>> groups(k);
+    for (size_t i = 0; i < ninitial_; i++)
+      groups[members_[i]].push_back(i);
+
+    bool changed = false;
+    for (size_t c = 0; c < k; c++) {
+      double best = std::numeric_limits<double>::max();
+      size_t medoid = representatives_[c];
+      for (auto a : groups[c]) {
+        double total = 0.0;
+        for (auto b : groups[c]) total += distance(a, b);
+        if (total < best) {
+          best = total;
+          medoid = a;
+        }
+      }
+      if (medoid != representatives_[c]) {
+        representatives_[c] = medoid;
+        changed = true;
+      }
+    }
+
+    if (! changed) break;
+    assign();
+  }
+}
+
+size_t ClusteredTaylorModel::furthest_(const double * const clusters,
+                                       size_t c) const
+{
+  size_t rep = (size_t) clusters[1 + capacity_ + c];
+  size_t res = rep;
+  double best = 0.0;
+  for (size_t i = 0; i < ninitial_; i++) {
+    if ((size_t) clusters[1 + 3*capacity_ + i] != c) continue;
+    double di = distance(i, rep);
+    if (di > best) {
+      best = di;
+      res = i;
+    }
+  }
+  return res;
+}
+
+void ClusteredTaylorModel::init_probe_(double * const store, size_t c) const
+{
+  double * cl = clusters_(store);
+  size_t rep = (size_t) cl[1 + capacity_ + c];
+  size_t probe = (size_t) cl[1 + 2*capacity_ + c];
+  size_t p = capacity_ + c;
+
+  // Start from the representative's state, with the probe's initial
+  // orientation carried through the same lattice rotation
+  std::copy(history(store, c), history(store, c) + model_->nstore(),
+            history(store, p));
+  std::copy(stress(store, c), stress(store, c) + 6, stress(store, p));
+
+  // The stored orientation is a view on the store, so copy it before
+  // composing
+  Orientation dQ =
+      model_->get_active_orientation(history(store, c)).deepcopy() *
+      q0s_[rep]->inverse();
+  model_->set_active_orientation(history(store, p), dQ * (*q0s_[probe]));
+}
+
+void ClusteredTaylorModel::split_(double * const store, size_t c) const
+{
+  double * cl = clusters_(store);
+  size_t m = (size_t) cl[0];
+  size_t rep = (size_t) cl[1 + capacity_ + c];
+  size_t probe = (size_t) cl[1 + 2*capacity_ + c];
+
+  // The members closer to the probe than to the representative form the
+  // new cluster
+  std::vector<size_t> group;
+  for (size_t i = 0; i < ninitial_; i++) {
+    double & mi = cl[1 + 3*capacity_ + i];
+    if ((size_t) mi != c) continue;
+    if (distance(i, probe) < distance(i, rep)) {
+      mi = m;
+      cl[1 + c] -= 1.0 / ninitial_;
+      cl[1 + m] += 1.0 / ninitial_;
+      group.push_back(i);
+    }
+  }
+
+  // Its representative is the medoid of the group, starting from the
+  // probe's state carried through the probe's lattice rotation
+  double best = std::numeric_limits<double>::max();
+  size_t medoid = probe;
+  for (auto a : group) {
+    double total = 0.0;
+    for (auto b : group) total += distance(a, b);
+    if (total < best) {
+      best = total;
+      medoid = a;
+    }
+  }
+
+  size_t p = capacity_ + c;
+  std::copy(history(store, p), history(store, p) + model_->nstore(),
+            history(store, m));
+  std::copy(stress(store, p), stress(store, p) + 6, stress(store, m));
+  Orientation dQ =
+      model_->get_active_orientation(history(store, p)).deepcopy() *
+      q0s_[probe]->inverse();
+  model_->set_active_orientation(history(store, m), dQ * (*q0s_[medoid]));
+  cl[1 + capacity_ + m] = medoid;
+  cl[0] = m + 1;
+
+  // And both halves need new probes
+  cl[1 + 2*capacity_ + c] = furthest_(cl, c);
+  init_probe_(store, c);
+  cl[1 + 2*capacity_ + m] = furthest_(cl, m);
+  init_probe_(store, m);
+}
+
+
+SelfConsistentModel::SelfConsistentModel(ParameterSet & params) :
+    PolycrystalModel(params, true),
+    rtol_(params.get_parameter<double>("rtol")),
+    atol_(params.get_parameter<double>("atol")),
+    tangent_rtol_(params.get_parameter<double>("tangent_rtol")),
+    miter_(params.get_parameter<int>("miter")),
+    depth_(params.get_parameter<int>("depth"))
+{
+
+}
+
+std::string SelfConsistentModel::type()
+{
+  return "SelfConsistentModel";
+}
+
+ParameterSet SelfConsistentModel::parameters()
+{
+  ParameterSet pset(SelfConsistentModel::type());
+  
+  pset.add_parameter<NEMLObject>("model");
+  pset.add_parameter<std::vector<NEMLObject>>("qs");
+  pset.add_optional_parameter<int>("nthreads", 1);
+  pset.add_optional_parameter<std::string>("layout", std::string("blocked"));
+  pset.add_optional_parameter<double>("rtol", 1.0e-6);
+  pset.add_optional_parameter<double>("atol", 1.0e-12);
+  pset.add_optional_parameter<double>("tangent_rtol", 1.0e-3);
+  pset.add_optional_parameter<int>("miter", 50);
+  pset.add_optional_parameter<int>("depth", 5);
+
+  return pset;
+}
+
+std::unique_ptr<NEMLObject> SelfConsistentModel::initialize(
+    ParameterSet & params)
+{
+  return neml::make_unique<SelfConsistentModel>(params);
+}
+
+size_t SelfConsistentModel::nhist() const
+{
+  // The crystals, then the effective tangent and the iteration count
+  return PolycrystalModel::nhist() + 36 + 1;
+}
+
+void SelfConsistentModel::init_hist(double * const hist) const
+{
+  PolycrystalModel::init_hist(hist);
+  // A zero tangent starts the first step from the Voigt average
+  std::fill(extra_(hist), extra_(hist) + 37, 0.0);
+}
+
+size_t SelfConsistentModel::nstore() const
+{
+  return nhist();
+}
+
+void SelfConsistentModel::init_store(double * const store) const
+{
+  init_hist(store);
+}
+
+void SelfConsistentModel::update_ld_inc(
+   const double * const d_np1, const double * const d_n,
+   const double * const w_np1, const double * const w_n,
+   double T_np1, double T_n,
+   double t_np1, double t_n,
+   double * const s_np1, const double * const s_n,
+   double * const h_np1, const double * const h_n,
+   double * const A_np1, double * const B_np1,
+   double & u_np1, double u_n,
+   double & p_np1, double p_n)
+{
+  size_t ng = n();
+  double wt = 1.0 / ng;
+
+  double dD[6];
+  for (size_t j = 0; j < 6; j++) dD[j] = d_np1[j] - d_n[j];
+  double tol = rtol_ * norm2_vec(dD, 6) + atol_;
+
+  // Warm start from the last effective tangent
+  double L[36], Ls[36];
+  std::copy(extra_(h_n), extra_(h_n) + 36, L);
+  bool voigt = (norm2_vec(L, 36) == 0.0);
+
+  std::vector<double> A_local(36 * ng);
+  std::vector<double> B_local(18 * ng);
+  std::vector<double> u_local(ng);
+  std::vector<double> p_local(ng);
+  std::vector<double> zero(ng, 0.0);
+  std::vector<double> Ts_np1(ng, T_np1);
+  std::vector<double> Ts_n(ng, T_n);
+
+  // Grain increments, starting from the macroscale increment
+  std::vector<double> x(6 * ng);
+  for (size_t i = 0; i < ng; i++) std::copy(dD, dD+6, &x[6*i]);
+  std::vector<double> dx(6 * ng);
+  std::vector<double> minv(36 * ng);
+  std::vector<double> res(ng);
+
+  for (size_t i = 0; i < ng; i++)
+    std::copy(w_np1, w_np1+3, w(h_np1, i));
+
+  // Once, outside of the iterations on the grain increments
+  update_shared_(h_np1, h_n, T_np1, T_n, t_np1, t_n, ng);
+
+  // Previous accepted iterate, for backtracking
+  std::vector<double> x_prev(6 * ng);
+  std::vector<double> dx_prev(6 * ng);
+
+  // The outer iteration on the effective tangent is itself a fixed point
+  AndersonMixing outer_mixer(36, depth_);
+  bool outer_converged = false;
+
+  size_t evaluations = 0;
+  for (int outer = 0; outer < miter_; outer++) {
+    // Newton iterations on the grain increments for a fixed interaction
+    bool converged = false;
+    double merit_prev = std::numeric_limits<double>::infinity();
+    double step = 1.0;
+    for (int iter = 0; iter < miter_; iter++) {
+      for (size_t i = 0; i < ng; i++)
+        for (size_t j = 0; j < 6; j++)
+          d(h_np1, i)[j] = d(h_n, i)[j] + x[6*i+j];
+
+      evaluate_crystal_batch(*model_, ng, strides(),
+                             d(h_np1, 0), d(h_n, 0),
+                             w(h_np1, 0), w(h_n, 0),
+                             &Ts_np1[0], &Ts_n[0],
+                             t_np1, t_n,
+                             stress(h_np1, 0), stress(h_n, 0),
+                             history(h_np1, 0), history(h_n, 0),
+                             &A_local[0], &B_local[0],
+                             &u_local[0], &zero[0],
+                             &p_local[0], &zero[0], nthreads_, false);
+      evaluations++;
+
+      if (voigt) {
+        std::fill(L, L+36, 0.0);
+        for (size_t i = 0; i < ng; i++)
+          for (size_t j = 0; j < 36; j++)
+            L[j] += wt * A_local[36*i+j];
+        voigt = false;
+      }
+      if (iter == 0) interaction(L, Ls);
+
+      // Linearize each grain's interaction equation
+      //    s_i + A_i dx_i + L* (x_i + dx_i - D) = sigma
+      parallel_for(ng, nthreads_, [&](size_t i)
+      {
+        double * M = &minv[36*i];
+        for (size_t j = 0; j < 36; j++) M[j] = A_local[36*i+j] + Ls[j];
+        invert_mat(M, 6);
+
+        double r[6], e[6];
+        for (size_t j = 0; j < 6; j++) e[j] = x[6*i+j] - dD[j];
+        mat_vec(Ls, 6, e, 6, r);
+        for (size_t j = 0; j < 6; j++) r[j] = -r[j] - stress(h_np1, i)[j];
+        mat_vec(M, 6, r, 6, &dx[6*i]);
+      });
+
+      // The average stress keeping the mean increment equal to D, the
+      // Schur complement of the bordered system
+      double Mavg[36] = {0}, sigma[6];
+      std::copy(dD, dD+6, sigma);
+      for (size_t i = 0; i < ng; i++) {
+        for (size_t j = 0; j < 36; j++) Mavg[j] += wt * minv[36*i+j];
+        for (size_t j = 0; j < 6; j++) sigma[j] -= wt * (x[6*i+j] + dx[6*i+j]);
+      }
+      solve_mat(Mavg, 6, sigma);
+
+      parallel_for(ng, nthreads_, [&](size_t i)
+      {
+        double ds[6];
+        mat_vec(&minv[36*i], 6, sigma, 6, ds);
+        for (size_t j = 0; j < 6; j++) dx[6*i+j] += ds[j];
+        res[i] = norm2_vec(&dx[6*i], 6);
+      });
+
+      double merit = *std::max_element(res.begin(), res.end());
+      if (merit <= tol) {
+        converged = true;
+        break;
+      }
+
+      // The rate sensitive grains can cycle about the solution, so cut the
+      // last step back if it did not reduce the Newton step
+      if ((merit >= merit_prev) && (step > 1.0 / 64.0)) {
+        step /= 2.0;
+        for (size_t j = 0; j < x.size(); j++) 
+          x[j] = x_prev[j] + step * dx_prev[j];
+        continue;
+      }
+
+      std::copy(x.begin(), x.end(), x_prev.begin());
+      std::copy(dx.begin(), dx.end(), dx_prev.begin());
+      merit_prev = merit;
+      step = 1.0;
+      for (size_t j = 0; j < x.size(); j++) x[j] += dx[j];
+    }
+
+    if (! converged)
+      throw NonlinearSolverError("Self-consistent grain iteration did not "
+                                 "converge");
+
+    // Update the effective tangent for the converged grain tangents and
+    // repeat if it changed the interaction appreciably
+    double L_new[36];
+    std::copy(L, L+36, L_new);
+    self_consistent_tangent_(&A_local[0], L_new);
+
+    double diff[36];
+    for (size_t j = 0; j < 36; j++) diff[j] = L_new[j] - L[j];
+    if (norm2_vec(diff, 36) <= tangent_rtol_ * norm2_vec(L_new, 36)) {
+      std::copy(L_new, L_new+36, L);
+      outer_converged = true;
+      break;
+    }
+    outer_mixer.update(L, diff);
+  }
+
+  if (! outer_converged)
+    throw NonlinearSolverError("Self-consistent effective tangent did not "
+                               "converge");
+
+  for (size_t j = 0; j < 6; j++) {
+    s_np1[j] = 0.0;
+    for (size_t i = 0; i < ng; i++) s_np1[j] += wt * stress(h_np1, i)[j];
+  }
+
+  if (A_np1 != nullptr) {
+    std::copy(L, L+36, A_np1);
+    // Neglects the change in the interaction with the spin
+    std::fill(B_np1, B_np1+18, 0.0);
+    for (size_t i = 0; i < ng; i++)
+      for (size_t j = 0; j < 18; j++)
+        B_np1[j] += wt * B_local[18*i+j];
+  }
+
+  u_np1 = u_n;
+  p_np1 = p_n;
+  for (size_t i = 0; i < ng; i++) {
+    u_np1 += wt * u_local[i];
+    p_np1 += wt * p_local[i];
+  }
+
+  std::copy(L, L+36, extra_(h_np1));
+  extra_(h_np1)[36] = evaluations;
+}
+
+double SelfConsistentModel::alpha(double T) const
+{
+  return model_->alpha(T);
+}
+
+void SelfConsistentModel::alpha(const double * const T, double * const a,
+                                size_t n) const
+{
+  model_->alpha(T, a, n);
+}
+
+void SelfConsistentModel::elastic_strains(const double * const s_np1, 
+                                          double T_np1,
+                                          const double * const h_np1, 
+                                          double * const e_np1) const
+{
+  std::fill(e_np1, e_np1+6, 0.0);
+  double e_local[6];
+  
+  for (size_t i = 0; i < n(); i++) {
+    model_->elastic_strains(stress(h_np1, i), T_np1, history(h_np1, i),
+                            e_local);
+    for (size_t j = 0; j < 6; j++) e_np1[j] += e_local[j] / n();
+  }
+}
+
+size_t SelfConsistentModel::iterations(const double * const store) const
+{
+  return (size_t) extra_(store)[36];
+}
+
+void SelfConsistentModel::effective_tangent(const double * const store,
+                                            double * const L) const
+{
+  std::copy(extra_(store), extra_(store) + 36, L);
+}
+
+void SelfConsistentModel::interaction(const double * const L, 
+                                      double * const Ls)
+{
+  // Isotropic projection, 3 kappa = J :: L and 10 mu = K :: L
+  double k3 = 0.0;
+  double tr = 0.0;
+  for (size_t i = 0; i < 3; i++)
+    for (size_t j = 0; j < 3; j++)
+      k3 += L[CINDEX(i,j,6)] / 3.0;
+  for (size_t i = 0; i < 6; i++)
+    tr += L[CINDEX(i,i,6)];
+  double kappa = k3 / 3.0;
+  double mu = (tr - k3) / 10.0;
+
+  // Softening, or a nearly rigid plastic medium, still needs a definite
+  // interaction
+  mu = std::max(mu, 1.0e-6 * std::fabs(kappa) + 1.0e-12);
+
+  // Hill's constraint tensor for a sphere
+  double ks = 4.0 * mu / 3.0;
+  double ms = mu * (9.0 * kappa + 8.0 * mu) / (6.0 * (kappa + 2.0 * mu));
+
+  std::fill(Ls, Ls+36, 0.0);
+  for (size_t i = 0; i < 3; i++)
+    for (size_t j = 0; j < 3; j++)
+      Ls[CINDEX(i,j,6)] = ks - 2.0 * ms / 3.0 + ((i == j) ? 2.0 * ms : 0.0);
+  for (size_t i = 3; i < 6; i++)
+    Ls[CINDEX(i,i,6)] = 2.0 * ms;
+}
+
+void SelfConsistentModel::self_consistent_tangent_(
+    const double * const A, double * const L) const
+{
+  // Fixed point L = <A B> <B>^-1 with B = (A + L*)^-1 (L + L*), for fixed
+  // grain tangents A, accelerated by Anderson mixing
+  size_t ng = n();
+  double wt = 1.0 / ng;
+  std::vector<double> loc(36 * ng);
+  std::vector<double> stiff(36 * ng);
+
+  std::vector<double> x(L, L+36), f(36);
+  AndersonMixing mixer(36, depth_);
+
+  for (int iter = 0; iter < miter_; iter++) {
+    double Ls[36], LpLs[36];
+    interaction(&x[0], Ls);
+    for (size_t j = 0; j < 36; j++) LpLs[j] = x[j] + Ls[j];
+
+    parallel_for(ng, nthreads_, [&](size_t i)
+    {
+      double M[36];
+      for (size_t j = 0; j < 36; j++) M[j] = A[36*i+j] + Ls[j];
+      invert_mat(M, 6);
+      mat_mat(6, 6, 6, M, LpLs, &loc[36*i]);
+      mat_mat(6, 6, 6, &A[36*i], &loc[36*i], &stiff[36*i]);
+    });
+
+    double AB[36] = {0}, Bavg[36] = {0};
+    for (size_t i = 0; i < ng; i++) {
+      for (size_t j = 0; j < 36; j++) {
+        AB[j] += wt * stiff[36*i+j];
+        Bavg[j] += wt * loc[36*i+j];
+      }
+    }
+    invert_mat(Bavg, 6);
+    mat_mat(6, 6, 6, AB, Bavg, &f[0]);
+
+    for (size_t j = 0; j < 36; j++) f[j] -= x[j];
+    if (norm2_vec(&f[0], 36) <= rtol_ * norm2_vec(&x[0], 36)) {
+      for (size_t j = 0; j < 36; j++) L[j] = x[j] + f[j];
+      return;
+    }
+
+    mixer.update(&x[0], &f[0]);
+  }
+
+  throw NonlinearSolverError("Self-consistent tangent did not converge");
+}
+
+double * SelfConsistentModel::extra_(double * const store) const
+{
+  return &(store[PolycrystalModel::nhist()]);
+}
+
+const double * SelfConsistentModel::extra_(const double * const store) const
+{
+  return &(store[PolycrystalModel::nhist()]);
 }
 
 }
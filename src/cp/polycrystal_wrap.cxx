@@ -17,11 +17,25 @@ PYBIND11_MODULE(polycrystal, m) {
   
   py::class_<PolycrystalModel, NEMLModel_ldi, std::shared_ptr<PolycrystalModel>>(m, "PolycrystalModel")
       .def_property_readonly("n", &PolycrystalModel::n)
+      .def_property_readonly("interleaved", &PolycrystalModel::interleaved)
       .def("orientations", 
            [](PolycrystalModel & m, py::array_t<double, py::array::c_style> h) -> std::vector<Orientation>
            {
             return m.orientations(arr2ptr<double>(h));
            }, "Return the current vector of orientations")
+      .def("orientations_array", 
+           [](PolycrystalModel & m, py::array_t<double, py::array::c_style> h) -> py::array_t<double>
+           {
+            auto q = alloc_mat<double>(m.n(), 4);
+            m.orientations(arr2ptr<double>(h), arr2ptr<double>(q));
+            return q;
+           }, "Return the current orientations as an n x 4 array of quaternions")
+      .def("shared",
+           [](PolycrystalModel & m, py::array_t<double, py::array::c_style> h) -> std::vector<double>
+           {
+            const double * sh = m.shared(arr2ptr<double>(h));
+            return std::vector<double>(sh, sh + m.nshared());
+           }, "History shared by all the crystals")
     ;
 
   py::class_<TaylorModel, PolycrystalModel, std::shared_ptr<TaylorModel>>(m, "TaylorModel")
@@ -33,6 +47,63 @@ PYBIND11_MODULE(polycrystal, m) {
                                                                {"model", "qs"});
                     }))
     ;
+
+  py::class_<ClusteredTaylorModel, PolycrystalModel, std::shared_ptr<ClusteredTaylorModel>>(m, "ClusteredTaylorModel")
+      PICKLEABLE(ClusteredTaylorModel)
+      .def(py::init([](py::args args, py::kwargs kwargs)
+                    {
+                      return create_object_python<ClusteredTaylorModel>(args,
+                                                               kwargs,
+                                                               {"model", "qs",
+                                                               "nclusters"});
+                    }))
+      .def_property_readonly("capacity", &ClusteredTaylorModel::capacity)
+      .def("nclusters",
+           [](ClusteredTaylorModel & m, py::array_t<double, py::array::c_style> h) -> size_t
+           {
+            return m.nclusters(arr2ptr<double>(h));
+           }, "Number of active clusters")
+      .def("weights",
+           [](ClusteredTaylorModel & m, py::array_t<double, py::array::c_style> h) -> std::vector<double>
+           {
+            return m.weights(arr2ptr<double>(h));
+           }, "Weight of each cluster slot")
+      .def("membership",
+           [](ClusteredTaylorModel & m, py::array_t<double, py::array::c_style> h) -> std::vector<size_t>
+           {
+            return m.membership(arr2ptr<double>(h));
+           }, "Cluster of each initial orientation")
+      .def("distance", &ClusteredTaylorModel::distance)
+    ;
+
+  py::class_<SelfConsistentModel, PolycrystalModel, std::shared_ptr<SelfConsistentModel>>(m, "SelfConsistentModel")
+      PICKLEABLE(SelfConsistentModel)
+      .def(py::init([](py::args args, py::kwargs kwargs)
+                    {
+                      return create_object_python<SelfConsistentModel>(args,
+                                                               kwargs,
+                                                               {"model", "qs"});
+                    }))
+      .def("iterations",
+           [](SelfConsistentModel & m, py::array_t<double, py::array::c_style> h) -> size_t
+           {
+            return m.iterations(arr2ptr<double>(h));
+           }, "Grain evaluations in the last step")
+      .def("effective_tangent",
+           [](SelfConsistentModel & m, py::array_t<double, py::array::c_style> h) -> py::array_t<double>
+           {
+            auto L = alloc_mat<double>(6,6);
+            m.effective_tangent(arr2ptr<double>(h), arr2ptr<double>(L));
+            return L;
+           }, "Effective tangent from the last step")
+      .def_static("interaction",
+           [](py::array_t<double, py::array::c_style> L) -> py::array_t<double>
+           {
+            auto Ls = alloc_mat<double>(6,6);
+            SelfConsistentModel::interaction(arr2ptr<double>(L), arr2ptr<double>(Ls));
+            return Ls;
+           }, "Hill's constraint tensor for an effective tangent")
+    ;
 }
 
 }
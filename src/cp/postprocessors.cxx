@@ -65,61 +65,68 @@ void PTRTwinReorientation::init_history(const Lattice & L,
   history.get<double>("twinned") = 0.0;
 }
 
+std::vector<size_t> PTRTwinReorientation::resolve_layout(
+    const Lattice & L, const History & layout) const
+{
+  std::vector<size_t> slots;
+  slots.push_back(layout.get_loc().at("twinned"));
+  size_t j = 0;
+  for (size_t g = 0; g < L.ngroup(); g++) {
+    for (size_t i = 0; i < L.nslip(g); i++) {
+      if (L.slip_type(g, i) == Lattice::SlipType::Twin) {
+        slots.push_back(layout.get_loc().at(prefix_+std::to_string(j)));
+        slots.push_back(layout.get_loc().at("twin_fraction"+
+                                            std::to_string(j)));
+      }
+      j++;
+    }
+  }
+  return slots;
+}
+
 void PTRTwinReorientation::act(SingleCrystalModel & model, 
                                const Lattice & L, const double & T, 
                                const Symmetric & D,
-                               const Skew & W, History & state,
-                               const History & prev_state)
+                               const Skew & W, double * const state,
+                               const double * const prev_state,
+                               const std::vector<size_t> & slots)
 {
+  double & twinned = state[slots[0]];
+
   // If "not twinned"
-  if (prev_state.get<double>("twinned") < 0.5) {
-    state.get<double>("twinned") = prev_state.get<double>("twinned");
-    size_t j = 0;
+  if (prev_state[slots[0]] < 0.5) {
+    twinned = prev_state[slots[0]];
+    double threshold = threshold_->value(T);
+    size_t k = 1;
     for (size_t g = 0; g < L.ngroup(); g++) {
       for (size_t i = 0; i < L.nslip(g); i++) {
         if (L.slip_type(g, i) == Lattice::SlipType::Twin) {
           // Get the twin fraction for this system
-          double slip = state.get<double>(prefix_+std::to_string(j));
-          state.get<double>("twin_fraction"+std::to_string(j)) = slip / 
-              L.characteristic_shear(g,i);
+          double & fraction = state[slots[k+1]];
+          fraction = state[slots[k]] / L.characteristic_shear(g,i);
           // If over the threshold do stuff
-          if ((state.get<double>("twin_fraction"+std::to_string(j)) >
-              threshold_->value(T)) && (state.get<double>("twinned") < 0.5)) {
-            Orientation twinned = L.reorientation(g,i) * 
+          if ((fraction > threshold) && (twinned < 0.5)) {
+            Orientation twinned_Q = L.reorientation(g,i) * 
                 model.get_active_orientation(state);
-            model.set_active_orientation(state, twinned);
-            state.get<double>("twinned") = 1.0;
+            model.set_active_orientation(state, twinned_Q);
+            twinned = 1.0;
           }
+          k += 2;
         }
-        j++;
       }
     }
     // Remove accumulated twin slip
-    if (state.get<double>("twinned") > 0.5) {
-      j = 0;
-      for (size_t g = 0; g < L.ngroup(); g++) {
-        for (size_t i = 0; i < L.nslip(g); i++) {
-          if (L.slip_type(g,i) == Lattice::SlipType::Twin)
-            state.get<double>(prefix_+std::to_string(j)) = 0;
-          j++;
-        }
-      }
+    if (twinned > 0.5) {
+      for (k = 1; k < slots.size(); k += 2)
+        state[slots[k]] = 0;
       // Allow to "retwin"
-      state.get<double>("twinned") = 0.0;
+      twinned = 0.0;
     }
   }
   else {
-    state.get<double>("twinned") = prev_state.get<double>("twinned");
-    size_t j = 0;
-    for (size_t g = 0; g < L.ngroup(); g++) {
-      for (size_t i = 0; i < L.nslip(g); i++) {
-        if (L.slip_type(g, i) == Lattice::SlipType::Twin) {
-          state.get<double>("twin_fraction"+std::to_string(j)) = 
-              prev_state.get<double>("twin_fraction"+std::to_string(j));
-        }
-        j++;
-      }
-    }
+    twinned = prev_state[slots[0]];
+    for (size_t k = 2; k < slots.size(); k += 2)
+      state[slots[k]] = prev_state[slots[k]];
   }
 }
 
@@ -14,7 +14,17 @@ PYBIND11_MODULE(postprocessors, m) {
   py::class_<CrystalPostprocessor, NEMLObject, std::shared_ptr<CrystalPostprocessor>>(m,"CrystalPostprocessor")
       .def("populate_history", &CrystalPostprocessor::populate_history)
       .def("init_history", &CrystalPostprocessor::init_history)
-      .def("act", &CrystalPostprocessor::act)
+      .def("resolve_layout", &CrystalPostprocessor::resolve_layout)
+      .def("act",
+           [](CrystalPostprocessor & m, SingleCrystalModel & model,
+              const Lattice & L, double T, const Symmetric & D,
+              const Skew & W, py::array_t<double, py::array::c_style> state,
+              py::array_t<double, py::array::c_style> prev_state,
+              std::vector<size_t> slots)
+           {
+            m.act(model, L, T, D, W, arr2ptr<double>(state),
+                  arr2ptr<double>(prev_state), slots);
+           }, "Act on the raw crystal history.")
       ;
 
   py::class_<PTRTwinReorientation, CrystalPostprocessor, std::shared_ptr<PTRTwinReorientation>>(m, "PTRTwinReorientation")
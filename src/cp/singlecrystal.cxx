@@ -1,7 +1,52 @@
 #include "cp/singlecrystal.h"
 
+#include "solvers.h"
+
 namespace neml {
 
+namespace {
+
+/// The stress update for a fixed history, used by the staggered integration
+class StressSubproblem: public Solvable {
+ public:
+  StressSubproblem(KinematicModel & kinematics, const Symmetric & guess,
+                   const History & history) :
+      kinematics_(kinematics), guess_(guess), history_(history)
+  {};
+
+  virtual size_t nparams() const {return 6;};
+
+  virtual void init_x(double * const x, TrialState * ts)
+  {
+    std::copy(guess_.data(), guess_.data()+6, x);
+  };
+
+  virtual void RJ(const double * const x, TrialState * ts, double * const R,
+                  double * const J)
+  {
+    SCTrialState * ats = static_cast<SCTrialState*>(ts);
+    Symmetric S(x);
+
+    Symmetric res = S - ats->S_n - kinematics_.stress_rate(
+        S, ats->d, ats->w, ats->Q, history_, ats->lattice, ats->T, 
+        ats->fixed) * ats->dt;
+    std::copy(res.data(), res.data()+6, R);
+
+    SymSymR4 dSdS = kinematics_.d_stress_rate_d_stress(
+        S, ats->d, ats->w, ats->Q, history_, ats->lattice, ats->T, 
+        ats->fixed);
+    for (size_t i = 0; i < 36; i++) J[i] = -dSdS.data()[i] * ats->dt;
+    for (size_t i = 0; i < 6; i++) J[CINDEX(i,i,6)] += 1.0;
+  };
+
+ private:
+  KinematicModel & kinematics_;
+  const Symmetric & guess_;
+  const History & history_;
+};
+
+} // namespace
+
 SingleCrystalModel::SingleCrystalModel(ParameterSet & params) :
     NEMLModel_ldi(params),
     kinematics_(params.get_object_parameter<KinematicModel>("kinematics")), 
@@ -21,8 +66,19 @@ SingleCrystalModel::SingleCrystalModel(ParameterSet & params) :
     fallback_elastic_predictor_(params.get_parameter<bool>("fallback_elastic_predictor")),
     force_divide_(params.get_parameter<int>("force_divide")),
     elastic_predictor_first_step_(params.get_parameter<bool>(
-            "elastic_predictor_first_step"))
-{
+            "elastic_predictor_first_step")),
+    staggered_miter_(params.get_parameter<int>("staggered_miter")),
+    staggered_depth_(params.get_parameter<int>("staggered_depth"))
+{
+  std::string integration = params.get_parameter<std::string>("integration");
+  if (integration == "monolithic")
+    staggered_ = false;
+  else if (integration == "staggered")
+    staggered_ = true;
+  else
+    throw std::invalid_argument("Unknown crystal integration " + integration +
+                                ", options are monolithic or staggered");
+
   populate_history(stored_hist_);
   
   // Really dumb way to get the names of the parameters that stay fixed during
@@ -32,6 +88,14 @@ SingleCrystalModel::SingleCrystalModel(ParameterSet & params) :
   populate_static_(h);
   static_names_ = h.get_order();
   static_size_ = h.size();
+
+  // The subset of those the kinematic model integrates itself
+  kinematics_->populate_decoupled(decoupled_hist_);
+  decoupled_names_ = decoupled_hist_.get_order();
+
+  // Postprocessors work on the raw history, so resolve their offsets once
+  for (auto pp : postprocessors_)
+    postprocessor_slots_.push_back(pp->resolve_layout(*lattice_, stored_hist_));
 }
 
 std::string SingleCrystalModel::type()
@@ -61,6 +125,10 @@ ParameterSet SingleCrystalModel::parameters()
   pset.add_optional_parameter<bool>("fallback_elastic_predictor", true);
   pset.add_optional_parameter<int>("force_divide", 0);
   pset.add_optional_parameter<bool>("elastic_predictor_first_step", false);
+  pset.add_optional_parameter<std::string>("integration", 
+                                           std::string("monolithic"));
+  pset.add_optional_parameter<int>("staggered_miter", 50);
+  pset.add_optional_parameter<int>("staggered_depth", 5);
 
   return pset;
 }
@@ -86,6 +154,7 @@ void SingleCrystalModel::populate_static_(History & history) const
   }
   for (auto pp : postprocessors_)
     pp->populate_history(*lattice_, history);
+  kinematics_->populate_decoupled(history);
 }
 
 void SingleCrystalModel::init_history(History & history) const
@@ -98,6 +167,7 @@ void SingleCrystalModel::init_history(History & history) const
   for (auto pp : postprocessors_)
     pp->init_history(*lattice_, history);
 
+  kinematics_->init_decoupled(history);
   kinematics_->init_history(history);
 }
 
@@ -137,6 +207,65 @@ void SingleCrystalModel::update_ld_inc(
    double * const A_np1, double * const B_np1,
    double & u_np1, double u_n,
    double & p_np1, double p_n)
+{
+  update_ld_inc_(d_np1, d_n, w_np1, w_n, T_np1, T_n, t_np1, t_n,
+                 s_np1, s_n, h_np1, h_n, A_np1, B_np1, u_np1, u_n,
+                 p_np1, p_n, true);
+}
+
+void SingleCrystalModel::update_ld_inc_decoupled(
+   const double * const d_np1, const double * const d_n,
+   const double * const w_np1, const double * const w_n,
+   double T_np1, double T_n,
+   double t_np1, double t_n,
+   double * const s_np1, const double * const s_n,
+   double * const h_np1, const double * const h_n,
+   double * const A_np1, double * const B_np1,
+   double & u_np1, double u_n,
+   double & p_np1, double p_n)
+{
+  update_ld_inc_(d_np1, d_n, w_np1, w_n, T_np1, T_n, t_np1, t_n,
+                 s_np1, s_n, h_np1, h_n, A_np1, B_np1, u_np1, u_n,
+                 p_np1, p_n, false);
+}
+
+size_t SingleCrystalModel::ndecoupled() const
+{
+  return decoupled_hist_.size();
+}
+
+size_t SingleCrystalModel::decoupled_location() const
+{
+  if (decoupled_names_.empty()) return 0;
+  return stored_hist_.get_loc().at(decoupled_names_.front());
+}
+
+void SingleCrystalModel::update_decoupled(double * const dec_np1,
+                                          const double * const dec_n,
+                                          double T_np1, double T_n,
+                                          double t_np1, double t_n) const
+{
+  if (decoupled_names_.empty()) return;
+
+  History F_np1 = decoupled_hist_;
+  F_np1.set_data(dec_np1);
+  History F_n = decoupled_hist_;
+  F_n.set_data(const_cast<double*>(dec_n));
+
+  std::copy(dec_n, dec_n + ndecoupled(), dec_np1);
+  kinematics_->update_decoupled(F_np1, F_n, T_np1, T_n, t_np1, t_n);
+}
+
+void SingleCrystalModel::update_ld_inc_(
+   const double * const d_np1, const double * const d_n,
+   const double * const w_np1, const double * const w_n,
+   double T_np1, double T_n,
+   double t_np1, double t_n,
+   double * const s_np1, const double * const s_n,
+   double * const h_np1, const double * const h_n,
+   double * const A_np1, double * const B_np1,
+   double & u_np1, double u_n,
+   double & p_np1, double p_n, bool advance_decoupled)
 {
   // First step
   if ((t_n == 0.0) && elastic_predictor_first_step_) {
@@ -144,7 +273,7 @@ void SingleCrystalModel::update_ld_inc(
                                     T_np1, T_n, t_np1, t_n,
                                     s_np1, s_n, h_np1, h_n, 
                                     A_np1, B_np1, u_np1, u_n,
-                                    p_np1, p_n, 1);
+                                    p_np1, p_n, 1, advance_decoupled);
     return;
   }
 
@@ -154,7 +283,7 @@ void SingleCrystalModel::update_ld_inc(
                                     T_np1, T_n, t_np1, t_n,
                                     s_np1, s_n, h_np1, h_n, 
                                     A_np1, B_np1, u_np1, u_n,
-                                    p_np1, p_n, 1);
+                                    p_np1, p_n, 1, advance_decoupled);
   }
   else {
     // Base update (no elastic predictor)
@@ -163,7 +292,7 @@ void SingleCrystalModel::update_ld_inc(
                                     T_np1, T_n, t_np1, t_n,
                                     s_np1, s_n, h_np1, h_n, 
                                     A_np1, B_np1, u_np1, u_n,
-                                    p_np1, p_n, 0);
+                                    p_np1, p_n, 0, advance_decoupled);
     }
     catch (const NEMLError & e) {
       // If it fails try with an elastic predictor
@@ -172,7 +301,7 @@ void SingleCrystalModel::update_ld_inc(
                                T_np1, T_n, t_np1, t_n,
                                s_np1, s_n, h_np1, h_n, 
                                A_np1, B_np1, u_np1, u_n,
-                               p_np1, p_n, 1);
+                               p_np1, p_n, 1, advance_decoupled);
       else
         throw e;
     }
@@ -188,10 +317,18 @@ void SingleCrystalModel::attempt_update_ld_inc_(
    double * const h_np1, const double * const h_n,
    double * const A_np1, double * const B_np1,
    double & u_np1, double u_n,
-   double & p_np1, double p_n, int trial_type)
+   double & p_np1, double p_n, int trial_type, bool advance_decoupled)
 {
-  // Shut up a pointless memory error
-  std::fill(h_np1, h_np1+nhist(), 0.0);
+  // Shut up a pointless memory error, keeping any decoupled history the
+  // caller already advanced
+  if (advance_decoupled) {
+    std::fill(h_np1, h_np1+nhist(), 0.0);
+  }
+  else {
+    size_t dl = decoupled_location();
+    std::fill(h_np1, h_np1+dl, 0.0);
+    std::fill(h_np1+dl+ndecoupled(), h_np1+nhist(), 0.0);
+  }
 
   // Setup everything in the appropriate wrappers
   const Symmetric D_np1(d_np1);
@@ -215,8 +352,8 @@ void SingleCrystalModel::attempt_update_ld_inc_(
   History HF_np1 = gather_history_(h_np1);
   const History HF_n = gather_history_(h_n);
 
-  // There is a subtle race condition if you don't copy the lattice
-  // because that object now caches data
+  // The lattice caches the rotated slip tensors, so each update works with
+  // its own copy.  The copy shares the (immutable) geometry.
   Lattice local_lattice = Lattice(*lattice_);
 
   // As the update is decoupled, split the histories into hardening/
@@ -227,6 +364,24 @@ void SingleCrystalModel::attempt_update_ld_inc_(
   History H_n = HF_n.split(not_updated_());
   History F_n = HF_n.split(not_updated_(), false);
 
+  // Advance the variables integrated outside of the crystal solve once for
+  // the whole step, as they cannot depend on the stress or orientation.
+  // A polycrystal advances them once for all its grains and passes them in
+  // through h_np1.  Without any, F_np1 is just another view of F_n
+  bool decoupled = decoupled_names_.size() > 0;
+  History F_np1 = decoupled ? F_n.deepcopy() : F_n;
+  if (decoupled && advance_decoupled) {
+    kinematics_->update_decoupled(F_np1, F_n, T_np1, T_n, t_np1, t_n);
+    for (auto name : decoupled_names_)
+      std::copy(F_np1.start_loc(name), F_np1.start_loc(name) +
+                F_np1.size_of_entry(name), HF_np1.start_loc(name));
+  }
+  else if (decoupled) {
+    for (auto name : decoupled_names_)
+      std::copy(HF_np1.start_loc(name), HF_np1.start_loc(name) +
+                HF_np1.size_of_entry(name), F_np1.start_loc(name));
+  }
+
   /* Begin adaptive stepping */
   double dT = T_np1 - T_n;
   int progress = 0;
@@ -237,6 +392,10 @@ void SingleCrystalModel::attempt_update_ld_inc_(
   // Use S_np1 and H_np1 to iterate
   S_np1.copy_data(S_n.data());
   H_np1.copy_data(H_n.rawptr());
+
+  // Converged jacobian, kept from the solve for the tangent
+  bool tangent = (A_np1 != nullptr);
+  std::vector<double> J(tangent ? nparams() * nparams() : 0);
   
   while (progress < target) {
     double step = 1.0 / pow(2, subdiv);
@@ -244,7 +403,7 @@ void SingleCrystalModel::attempt_update_ld_inc_(
     // Decouple the updates
     History fixed = kinematics_->decouple(S_np1, D, W, Q_n, H_np1, 
                                           local_lattice, T_n + dT *
-                                          step, F_n);
+                                          step, F_np1);
     
     Symmetric strial;
     if (trial_type == 1) {
@@ -252,7 +411,8 @@ void SingleCrystalModel::attempt_update_ld_inc_(
       strial = S_n + kinematics_->stress_increment(S_np1, D, W, dt * step,
                                                              local_lattice, Q_n,
                                                              H_np1,
-                                                             T_n+dT*step);
+                                                             T_n+dT*step,
+                                                             fixed);
     }
     else {
       strial = S_n;
@@ -267,7 +427,7 @@ void SingleCrystalModel::attempt_update_ld_inc_(
 
     // Solve the update
     try {
-      solve_substep_(&trial, S_np1, H_np1);
+      solve_substep_(&trial, S_np1, H_np1, tangent ? &J[0] : nullptr);
     }
     catch (const NEMLError & e) {
       subdiv++;
@@ -299,7 +459,7 @@ void SingleCrystalModel::attempt_update_ld_inc_(
     // Calc tangent if we're going to be done
     if (progress == target) {
       // Tangent
-      calc_tangents_(S_np1, H_np1, &trial, A_np1, B_np1);
+      if (tangent) calc_tangents_(S_np1, H_np1, &trial, &J[0], A_np1, B_np1);
 
       // Calculate the new rotation, if requested
       if (update_rotation_) {
@@ -326,8 +486,9 @@ void SingleCrystalModel::attempt_update_ld_inc_(
                                H_np1, H_n);
 
   // Update model based on any post-processors
-  for (auto pp : postprocessors_)
-    pp->act(*this, local_lattice, T_np1, D, W, HF_np1, HF_n);
+  for (size_t i = 0; i < postprocessors_.size(); i++)
+    postprocessors_[i]->act(*this, local_lattice, T_np1, D, W, HF_np1.rawptr(),
+                            HF_n.rawptr(), postprocessor_slots_[i]);
 }
 
 size_t SingleCrystalModel::nhist() const
@@ -347,6 +508,12 @@ double SingleCrystalModel::alpha(double T) const
   return alpha_->value(T);
 }
 
+void SingleCrystalModel::alpha(const double * const T, double * const a,
+                               size_t n) const
+{
+  alpha_->value(T, a, n);
+}
+
 void SingleCrystalModel::elastic_strains(
     const double * const s_np1,
     double T_np1, const double * const h_np1,
@@ -446,6 +613,11 @@ void SingleCrystalModel::RJ(const double * const x, TrialState * ts,
   }
 }
 
+std::shared_ptr<SymmetryGroup> SingleCrystalModel::symmetry() const
+{
+  return lattice_->symmetry();
+}
+
 Orientation SingleCrystalModel::get_active_orientation(
     double * const hist) const
 {
@@ -507,6 +679,16 @@ void SingleCrystalModel::set_passive_orientation(
   set_active_orientation(hist, q.inverse());
 }
 
+size_t SingleCrystalModel::orientation_location() const
+{
+  return stored_hist_.get_loc().at("rotation");
+}
+
+size_t SingleCrystalModel::reference_orientation_location() const
+{
+  return stored_hist_.get_loc().at("rotation0");
+}
+
 bool SingleCrystalModel::use_nye() const
 {
   return kinematics_->use_nye();
@@ -542,180 +724,70 @@ History SingleCrystalModel::gather_blank_history_() const
 
 void SingleCrystalModel::calc_tangents_(Symmetric & S, History & H,
                                         SCTrialState * ts,
+                                        const double * const J,
                                         double * const A, double * const B)
 {
-  // Resetup x
-  std::vector<double> xv(nparams());
-  double * x = &xv[0];
-  std::copy(S.s(),S.s()+6,x);
-  std::copy(H.rawptr(), H.rawptr()+H.size(),&x[6]);
-
-  // Get the jacobian contributions
-  double * R = new double[nparams()];
-  double * J = new double[nparams()*nparams()];
-  
-  RJ(x, ts, R, J);
-
-  size_t nh = nparams() - 6;
-
-  if (nh > 0) {
-    double * J11 = new double[6*6];
-    double * J12 = new double[6*nh];
-    double * J21 = new double[nh*6];
-    double * J22 = new double[nh*nh];
-
-    for (size_t i=0; i<6; i++) {
-      for (size_t j=0; j<6; j++) {
-        J11[CINDEX(i,j,6)] = J[CINDEX(i,j,nparams())];
-      }
+  // J is the jacobian at the converged state, so the tangents come from a
+  // single factorization with the partials wrt D and W as right hand sides
+  size_t n = nparams();
+  size_t nh = n - 6;
+  History & fixed = ts->fixed;
+
+  // Stress parts
+  SymSymR4 sd = kinematics_->d_stress_rate_d_d(S, ts->d, ts->w, ts->Q, 
+                                             H, ts->lattice, ts->T, fixed) 
+      + kinematics_->d_stress_rate_d_d_decouple(S, ts->d, ts->w,
+                                                ts->Q, H,
+                                                ts->lattice, ts->T, fixed);
+  SymSkewR4 sw = kinematics_->d_stress_rate_d_w(S, ts->d, ts->w, ts->Q, 
+                                             H, ts->lattice, ts->T, fixed);
+  sw += kinematics_->d_stress_rate_d_w_decouple(S, ts->d, ts->w,
+                                                ts->Q, H,
+                                                ts->lattice, ts->T, fixed);
+
+  std::vector<double> X(n*9);
+  for (size_t i = 0; i < 6; i++) {
+    for (size_t j = 0; j < 6; j++) {
+      X[CINDEX(i,j,9)] = sd.data()[CINDEX(i,j,6)];
     }
-
-    for (size_t i=0; i<6; i++) {
-      for (size_t j=0; j<nh; j++) {
-        J12[CINDEX(i,j,nh)] = J[CINDEX(i,(j+6),nparams())];
-      }
-    }
-   
-    for (size_t i=0; i<nh; i++) {
-      for (size_t j=0; j<6; j++) {
-        J21[CINDEX(i,j,6)] = J[CINDEX((i+6),j,nparams())];
-      }
-    }
-
-    for (size_t i=0; i<nh; i++) {
-      for (size_t j=0; j<nh; j++) {
-        J22[CINDEX(i,j,nh)] = J[CINDEX((i+6),(j+6),nparams())];
-      }
-    }
-
-    delete [] R;
-    delete [] J;
-
-    // Let the games begin
-    // J22 inverse
-    invert_mat(J22, nh);
-
-    // J12 J22_inv
-    double * M1 = new double [6*nh];
-    mat_mat(6, nh, nh, J12, J22, M1);
-
-    // J12 J22_inv J21
-    double * M2 = new double[6*6];
-    mat_mat(6, 6, nh, M1, J21, M2);
-
-    // J11 - J12 J22_inv J21
-    for (size_t i = 0; i < 36; i++) {
-      M2[i] = J11[i] - M2[i];
+    for (size_t j = 0; j < 3; j++) {
+      X[CINDEX(i,(j+6),9)] = sw.data()[CINDEX(i,j,3)];
     }
+  }
 
-    // Inverse of J11 - J12 J22_inv J21
-    invert_mat(M2, 6);
-
-    delete [] J11;
-    delete [] J12;
-    delete [] J21;
-    delete [] J22;
-    
-    // Do D
-    History & fixed = ts->fixed;
-    // Get the extra matrices
-    SymSymR4 sd = kinematics_->d_stress_rate_d_d(S, ts->d, ts->w, ts->Q, 
-                                               H, ts->lattice, ts->T, fixed) 
-        + kinematics_->d_stress_rate_d_d_decouple(S, ts->d, ts->w,
-                                                  ts->Q, H,
-                                                  ts->lattice, ts->T, fixed);
+  // History parts
+  if (nh > 0) {
     History hd = kinematics_->d_history_rate_d_d(S, ts->d, ts->w, ts->Q, 
                                                H, ts->lattice, ts->T, fixed);
     hd += kinematics_->d_history_rate_d_d_decouple(S, ts->d, ts->w,
                                                   ts->Q, H,
                                                   ts->lattice, ts->T, fixed);
-    // hd is stored column major...
-    double * hdt = new double[nh*6];
-    for (size_t i = 0; i < nh; i++) {
-      for (size_t j = 0; j < 6; j++) {
-        hdt[CINDEX(i,j,6)] = hd.rawptr()[CINDEX(j,i,nh)];
-      }
-    }
-
-
-    // Sadly need one more intermediate
-    double * I1 = new double[36];
-    mat_mat(6, 6, nh, M1, hdt, I1);
-    delete [] hdt;
-    for (size_t i=0; i<36; i++) {
-      I1[i] = (sd.data()[i] - I1[i]); // Would mult by dt if things were sane
-    }
-
-    // Alright, do the final multiplication
-    mat_mat(6,6,6, M2, I1, A);
-
-    delete [] I1;
-
-    // Do W
-    SymSkewR4 sw = kinematics_->d_stress_rate_d_w(S, ts->d, ts->w, ts->Q, 
-                                               H, ts->lattice, ts->T, fixed);
-    sw += kinematics_->d_stress_rate_d_w_decouple(S, ts->d, ts->w,
-                                                  ts->Q, H,
-                                                  ts->lattice, ts->T, fixed);
-
     History hw = kinematics_->d_history_rate_d_w(S, ts->d, ts->w, ts->Q, 
                                                H, ts->lattice, ts->T, fixed);
     hw += kinematics_->d_history_rate_d_w_decouple(S, ts->d, ts->w,
                                                    ts->Q, H,
                                                    ts->lattice, ts->T, fixed);
-    // This is transposed
-    double * hwt = new double [nh*3];
+
+    // These are stored column major
     for (size_t i = 0; i < nh; i++) {
+      for (size_t j = 0; j < 6; j++) {
+        X[CINDEX((i+6),j,9)] = hd.rawptr()[CINDEX(j,i,nh)];
+      }
       for (size_t j = 0; j < 3; j++) {
-        hwt[CINDEX(i,j,3)] = hw.rawptr()[CINDEX(j,i,nh)];
+        X[CINDEX((i+6),(j+6),9)] = hw.rawptr()[CINDEX(j,i,nh)];
       }
     }
-
-    // Sadly need one more intermediate
-    double * I2 = new double[18];
-    mat_mat(6, 3, nh, M1, hwt, I2);
-    delete [] hwt;
-    for (size_t i=0; i<18; i++) {
-      I2[i] = (sw.data()[i] - I2[i]); // Would mult by dt if things were sane
-    }
-
-    // Alright, do the final multiplication
-    mat_mat(6,3,6, M2, I2, B);
-
-    delete [] I2;
-
-    delete [] M1;
-    delete [] M2;
   }
-  // This is much simpler!
-  else {
-    delete [] R;
-
-    invert_mat(J, 6);
-
-    // Do D
-    History & fixed = ts->fixed;
-    // Get the extra matrices
-    SymSymR4 sd = kinematics_->d_stress_rate_d_d(S, ts->d, ts->w, ts->Q, 
-                                               H, ts->lattice, ts->T, fixed) 
-        + kinematics_->d_stress_rate_d_d_decouple(S, ts->d, ts->w,
-                                                  ts->Q, H,
-                                                  ts->lattice, ts->T, fixed);
-    
-    // Multiply
-    mat_mat(6,6,6, J, sd.data(), A);
 
-    // Do W
-    SymSkewR4 sw = kinematics_->d_stress_rate_d_w(S, ts->d, ts->w, ts->Q, 
-                                               H, ts->lattice, ts->T, fixed);
-    sw += kinematics_->d_stress_rate_d_w_decouple(S, ts->d, ts->w,
-                                                  ts->Q, H,
-                                                  ts->lattice, ts->T, fixed);
-
-    // Multiply
-    mat_mat(6,3,6,J,sw.data(), B);
+  solve_mat_multiple(J, n, &X[0], 9);
 
-    delete [] J;
+  for (size_t i = 0; i < 6; i++) {
+    for (size_t j = 0; j < 6; j++) {
+      A[CINDEX(i,j,6)] = X[CINDEX(i,j,9)];
+    }
+    for (size_t j = 0; j < 3; j++) {
+      B[CINDEX(i,j,3)] = X[CINDEX(i,(j+6),9)];
+    }
   }
 }
 
@@ -754,17 +826,90 @@ double SingleCrystalModel::calc_work_inc_(
 
 void SingleCrystalModel::solve_substep_(SCTrialState * ts,
                                        Symmetric & stress,
-                                       History & hist)
+                                       History & hist,
+                                       double * const J)
 {
+  if (staggered_) {
+    try {
+      solve_staggered_(ts, stress, hist, J);
+      return;
+    }
+    catch (const NEMLError & e) {
+      // Fall back to the monolithic update
+      if (verbose_)
+        std::cout << "Staggered update failed: " << e.what() << std::endl;
+    }
+  }
+
   std::vector<double> xv(nparams());
   double * x = &xv[0];
-  solve(this, x, ts, {rtol_, atol_, miter_, verbose_, linesearch_});
+  solve(this, x, ts, {rtol_, atol_, miter_, verbose_, linesearch_},
+        nullptr, J); // Keep the jacobian for the tangent
 
   // Dump the results
   stress.copy_data(x);
   hist.copy_data(&x[6]);
 }
 
+void SingleCrystalModel::solve_staggered_(SCTrialState * ts,
+                                          Symmetric & stress,
+                                          History & hist,
+                                          double * const J)
+{
+  // Alternate a Newton solve for the stress with the history fixed and an
+  // update of the history for that stress,
+  //    H = H_n + h(S(H), H) dt
+  // as a fixed point accelerated by Anderson mixing
+  size_t nh = nparams() - 6;
+  const History & H_n = ts->history;
+  History H = H_n.copy_blank();
+  H.copy_data(H_n.rawptr());
+  Symmetric S = ts->S;
+
+  std::vector<double> x(nparams());
+  std::vector<double> f(nh);
+  AndersonMixing mixer(nh, staggered_depth_);
+  SolverParameters p(rtol_, atol_, miter_, verbose_, linesearch_);
+
+  double nf0 = 0.0;
+  bool converged = false;
+  for (int i = 0; i < staggered_miter_; i++) {
+    StressSubproblem sub(*kinematics_, S, H);
+    solve(&sub, &x[0], ts, p);
+    S.copy_data(&x[0]);
+
+    History rate = kinematics_->history_rate(S, ts->d, ts->w, ts->Q, H,
+                                             ts->lattice, ts->T, ts->fixed);
+    for (size_t j = 0; j < nh; j++)
+      f[j] = H_n.rawptr()[j] + rate.rawptr()[j] * ts->dt - H.rawptr()[j];
+
+    // Same convergence test as the monolithic Newton, the stress residual
+    // is already zero
+    double nf = norm2_vec(&f[0], nh);
+    if (i == 0) nf0 = nf;
+    if ((nf < atol_) || (nf < rtol_ * nf0)) {
+      converged = true;
+      break;
+    }
+
+    mixer.update(H.rawptr(), &f[0]);
+  }
+
+  if (! converged)
+    throw NonlinearSolverError("Staggered crystal update did not converge");
+
+  stress.copy_data(S.data());
+  hist.copy_data(H.rawptr());
+
+  // The tangent needs the full jacobian, but only at the converged state
+  if (J != nullptr) {
+    std::copy(S.data(), S.data()+6, &x[0]);
+    std::copy(H.rawptr(), H.rawptr()+nh, &x[6]);
+    std::vector<double> R(nparams());
+    RJ(&x[0], ts, &R[0], J);
+  }
+}
+
 std::vector<std::string> SingleCrystalModel::not_updated_() const
 {
   return static_names_;
@@ -87,6 +87,9 @@ PYBIND11_MODULE(singlecrystal, m) {
             m.set_active_orientation(arr2ptr<double>(hist), q);
            }, "Set the orientation using a active rotation (crystal -> sample)")
       .def_property_readonly("use_nye", &SingleCrystalModel::use_nye)
+      .def_property_readonly("ndecoupled", &SingleCrystalModel::ndecoupled)
+      .def_property_readonly("decoupled_location",
+                             &SingleCrystalModel::decoupled_location)
       .def("update_nye",
            [](SingleCrystalModel & m, py::array_t<double, py::array::c_style> hist, py::array_t<double, py::array::c_style> nye)
            {
@@ -1,5 +1,8 @@
 #include "cp/slipharden.h"
 
+#include "math/nemlmath.h"
+
+#include <map>
 #include <stdexcept>
 
 namespace neml {
@@ -50,6 +53,29 @@ History SlipHardening::d_hist_d_h_ext(const Symmetric & stress,
   return blank_hist().history_derivative(history.subset(ext)).zero();
 }
 
+void SlipHardening::populate_decoupled(History & history) const
+{
+
+}
+
+void SlipHardening::init_decoupled(History & history) const
+{
+
+}
+
+void SlipHardening::update_decoupled(History & fixed_np1,
+                                     const History & fixed_n,
+                                     double T_np1, double T_n,
+                                     double t_np1, double t_n) const
+{
+
+}
+
+void SlipHardening::populate_fixed(History & fixed, double T) const
+{
+
+}
+
 bool SlipHardening::use_nye() const
 {
   return false;
@@ -510,9 +536,242 @@ void FASlipHardening::consistency_(Lattice & L) const
     throw std::logic_error("Hardening model size not consistent with lattice!");
 }
 
+const size_t SlipInteractionMatrix::ntypes;
+
+SlipInteractionMatrix::SlipInteractionMatrix(ParameterSet & params) :
+    SquareMatrix(params, 
+                 params.get_object_parameter<Lattice>("lattice")->ntotal()),
+    coefs_(params.get_parameter<std::vector<double>>("coefficients")),
+    types_(m() * m())
+{
+  if (coefs_.size() != ntypes) {
+    throw std::invalid_argument("Slip interaction matrix needs one coefficient"
+                                " for each of the " + std::to_string(ntypes) +
+                                " interaction types");
+  }
+
+  auto L = params.get_object_parameter<Lattice>("lattice");
+  for (size_t g1 = 0; g1 < L->ngroup(); g1++) {
+    for (size_t i1 = 0; i1 < L->nslip(g1); i1++) {
+      size_t a = L->flat(g1, i1);
+      for (size_t g2 = 0; g2 < L->ngroup(); g2++) {
+        for (size_t i2 = 0; i2 < L->nslip(g2); i2++) {
+          size_t b = L->flat(g2, i2);
+          size_t t = classify(*L, g1, i1, g2, i2);
+          types_[CINDEX(a,b,m())] = (unsigned char) t;
+          data_[CINDEX(a,b,m())] = coefs_[t];
+        }
+      }
+    }
+  }
+
+  setup_groups_(*L);
+}
+
+std::string SlipInteractionMatrix::type()
+{
+  return "SlipInteractionMatrix";
+}
+
+std::unique_ptr<NEMLObject> SlipInteractionMatrix::initialize(
+    ParameterSet & params)
+{
+  return neml::make_unique<SlipInteractionMatrix>(params);
+}
+
+ParameterSet SlipInteractionMatrix::parameters()
+{
+  ParameterSet pset(SlipInteractionMatrix::type());
+
+  pset.add_parameter<NEMLObject>("lattice");
+  pset.add_parameter<std::vector<double>>("coefficients");
+
+  return pset;
+}
+
+size_t SlipInteractionMatrix::classify(Lattice & L, size_t g1, size_t i1, 
+                                       size_t g2, size_t i2)
+{
+  const double tol = 1.0e-8;
+
+  if ((g1 == g2) && (i1 == i2)) return 0;
+
+  const Vector & n1 = L.slip_planes()[g1][i1];
+  const Vector & n2 = L.slip_planes()[g2][i2];
+  if (n1.cross(n2).norm() < tol) return 1;
+
+  const Vector & d1 = L.slip_directions()[g1][i1];
+  const Vector & d2 = L.slip_directions()[g2][i2];
+  if (d1.cross(d2).norm() < tol) return 2;
+  if (std::fabs(d1.dot(d2)) < tol) return 3;
+
+  // The junction forms with the shorter of the two possible Burgers vectors
+  const Vector & b1 = L.burgers_vectors()[g1][i1];
+  const Vector & b2 = L.burgers_vectors()[g2][i2];
+  Vector bj = b1 + b2;
+  Vector bm = b1 - b2;
+  if (bm.norm() < bj.norm()) bj = bm;
+  double nb = bj.norm();
+  if ((std::fabs(bj.dot(n1)) < tol * nb) || (std::fabs(bj.dot(n2)) < tol * nb))
+    return 4;
+
+  return 5;
+}
+
+/// Number the groups of parallel vectors, as in the classification
+static size_t parallel_groups(const std::vector<Vector> & vs,
+                              std::vector<size_t> & group)
+{
+  const double tol = 1.0e-8;
+
+  std::vector<size_t> first;
+  group.resize(vs.size());
+  for (size_t i = 0; i < vs.size(); i++) {
+    size_t g = 0;
+    while ((g < first.size()) && (vs[first[g]].cross(vs[i]).norm() >= tol))
+      g++;
+    if (g == first.size()) first.push_back(i);
+    group[i] = g;
+  }
+
+  return first.size();
+}
+
+void SlipInteractionMatrix::setup_groups_(Lattice & L)
+{
+  size_t n = this->n();
+
+  std::vector<Vector> normals(n), directions(n);
+  for (size_t g = 0; g < L.ngroup(); g++) {
+    for (size_t i = 0; i < L.nslip(g); i++) {
+      normals[L.flat(g,i)] = L.slip_planes()[g][i];
+      directions[L.flat(g,i)] = L.slip_directions()[g][i];
+    }
+  }
+  nplane_ = parallel_groups(normals, plane_);
+  ndir_ = parallel_groups(directions, dir_);
+
+  std::map<std::pair<size_t,size_t>, size_t> pairs;
+  both_.resize(n);
+  for (size_t i = 0; i < n; i++) {
+    auto it = pairs.insert(std::make_pair(std::make_pair(plane_[i], dir_[i]),
+                                          pairs.size())).first;
+    both_[i] = it->second;
+  }
+  nboth_ = pairs.size();
+
+  // The group sums cover the self, coplanar, and collinear pairs and the
+  // most common of the remaining types.  If the groups disagree with the
+  // classification fall back to visiting every pair.
+  std::vector<size_t> c = counts();
+  base_ = 3;
+  for (size_t t = 4; t < ntypes; t++)
+    if (c[t] > c[base_]) base_ = t;
+
+  grouped_ = true;
+  start_.assign(1, 0);
+  cols_.clear();
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = 0; j < n; j++) {
+      size_t t = types_[CINDEX(i,j,n)];
+      size_t expected;
+      if (i == j) expected = 0;
+      else if (plane_[i] == plane_[j]) expected = 1;
+      else if (dir_[i] == dir_[j]) expected = 2;
+      else expected = ntypes;
+      if ((expected < ntypes) ? (t != expected) : (t < 3))
+        grouped_ = false;
+      if ((expected == ntypes) && (t != base_)) cols_.push_back(j);
+    }
+    start_.push_back(cols_.size());
+  }
+}
+
+std::vector<size_t> SlipInteractionMatrix::counts() const
+{
+  std::vector<size_t> res(ntypes, 0);
+  for (auto t : types_) res[t]++;
+  return res;
+}
+
+void SlipInteractionMatrix::apply(const double * const v, double * const res,
+                                  size_t k) const
+{
+  if (!grouped_) {
+    apply_pairs_(v, res, k);
+    return;
+  }
+
+  // Sums of the vectors over each group and over all the systems
+  size_t n = this->n();
+  std::vector<double> P(nplane_ * k, 0.0);
+  std::vector<double> D(ndir_ * k, 0.0);
+  std::vector<double> B(nboth_ * k, 0.0);
+  std::vector<double> S(k, 0.0);
+  for (size_t j = 0; j < n; j++) {
+    const double * vj = &v[CINDEX(j,0,k)];
+    double * p = &P[CINDEX(plane_[j],0,k)];
+    double * d = &D[CINDEX(dir_[j],0,k)];
+    double * b = &B[CINDEX(both_[j],0,k)];
+    for (size_t l = 0; l < k; l++) {
+      p[l] += vj[l];
+      d[l] += vj[l];
+      b[l] += vj[l];
+      S[l] += vj[l];
+    }
+  }
+
+  // Row i is
+  //   c0 v_i + c1 (coplanar sum) + c2 (collinear sum) + cb (rest sum)
+  // plus the difference from cb for the rest pairs not of type base_
+  const double c0 = coefs_[0];
+  const double c1 = coefs_[1];
+  const double c2 = coefs_[2];
+  const double cb = coefs_[base_];
+  for (size_t i = 0; i < n; i++) {
+    const double * vi = &v[CINDEX(i,0,k)];
+    const double * p = &P[CINDEX(plane_[i],0,k)];
+    const double * d = &D[CINDEX(dir_[i],0,k)];
+    const double * b = &B[CINDEX(both_[i],0,k)];
+    double * r = &res[CINDEX(i,0,k)];
+    for (size_t l = 0; l < k; l++) {
+      r[l] = c0 * vi[l] + c1 * (p[l] - vi[l]) + c2 * (d[l] - b[l])
+          + cb * (S[l] - p[l] - d[l] + b[l]);
+    }
+    for (size_t q = start_[i]; q < start_[i+1]; q++) {
+      size_t j = cols_[q];
+      double dc = coefs_[types_[CINDEX(i,j,n)]] - cb;
+      const double * vj = &v[CINDEX(j,0,k)];
+      for (size_t l = 0; l < k; l++) r[l] += dc * vj[l];
+    }
+  }
+}
+
+void SlipInteractionMatrix::apply_pairs_(const double * const v,
+                                         double * const res, size_t k) const
+{
+  // Sum the vectors by type first, so each row only multiplies by the
+  // ntypes coefficients.  Each row still visits every column.
+  std::vector<double> partial(ntypes * k);
+  for (size_t i = 0; i < n(); i++) {
+    std::fill(partial.begin(), partial.end(), 0.0);
+    const unsigned char * row = &types_[CINDEX(i,0,n())];
+    for (size_t j = 0; j < n(); j++) {
+      double * p = &partial[row[j] * k];
+      for (size_t l = 0; l < k; l++) p[l] += v[CINDEX(j,l,k)];
+    }
+    for (size_t l = 0; l < k; l++) {
+      double r = 0.0;
+      for (size_t t = 0; t < ntypes; t++) r += coefs_[t] * partial[CINDEX(t,l,k)];
+      res[CINDEX(i,l,k)] = r;
+    }
+  }
+}
+
 GeneralLinearHardening::GeneralLinearHardening(ParameterSet & params) :
     SlipHardening(params),
     M_(params.get_object_parameter<SquareMatrix>("M")), 
+    typed_(std::dynamic_pointer_cast<SlipInteractionMatrix>(M_)),
     tau_0_(params.get_parameter<std::vector<double>>("tau_0")), 
     absval_(params.get_parameter<bool>("absval")), 
     varprefix_(params.get_parameter<std::string>("varprefix"))
@@ -627,7 +886,7 @@ History GeneralLinearHardening::hist(const Symmetric & stress,
   FlatVector resv(L.ntotal(), &(res.get<double>(varnames_[0])));
 
   // Do the multiplication!
-  M_->matvec(v, resv);
+  apply_(v.data(), resv.data(), 1);
 
   return res;
 }
@@ -658,12 +917,14 @@ History GeneralLinearHardening::d_hist_d_s(const Symmetric & stress,
     }
   }
 
-  // Do the sum
-  for (size_t i = 0; i < L.ntotal(); i++) {
-    for (size_t j = 0; j < L.ntotal(); j++) {
-      res.get<Symmetric>(varnames_[i]) += M_->data()[CINDEX(i,j,L.ntotal())] * v[j];
-    }
-  }
+  // Do the sum, treating the derivatives as a n x 6 block
+  std::vector<double> vd(6 * L.ntotal());
+  std::vector<double> rd(6 * L.ntotal());
+  for (size_t j = 0; j < L.ntotal(); j++)
+    std::copy(v[j].data(), v[j].data() + 6, &vd[6*j]);
+  apply_(&vd[0], &rd[0], 6);
+  for (size_t i = 0; i < L.ntotal(); i++)
+    res.get<Symmetric>(varnames_[i]).copy_data(&rd[6*i]);
 
   return res;
 }
@@ -678,23 +939,22 @@ History GeneralLinearHardening::d_hist_d_h(const Symmetric & stress,
   consistency(L); 
   auto res = blank_hist().derivative<History>();
 
-  // Do the sum
-  for (size_t i = 0; i < L.ntotal(); i++) {
-    for (size_t g = 0; g < L.ngroup(); g++) {
-      for (size_t l = 0; l < L.nslip(g); l++) {
-        size_t j = L.flat(g, l); 
-        History curr = R.d_slip_d_h(g, l, stress, Q,  history, L, T, fixed);
-        double sign = 1.0;
-        if (absval_) {
-          sign = copysign(1.0, R.slip(g, l, stress, Q, history, L, T, fixed));
-        }
-        for (auto vn : varnames_) {
-          res.get<double>(varnames_[i]+"_"+vn) += 
-              M_->data()[CINDEX(i,j,L.ntotal())] * sign * curr.get<double>(vn);
-        }
-      }
-    }
-  }
+  std::vector<double> sign;
+  std::vector<History> dslip;
+  slip_derivatives_(stress, Q, history, L, T, R, fixed, sign, dslip);
+
+  // Do the sum, as M times the n x n block of signed slip derivatives.
+  // All the variables are scalars so the result is stored as a row major
+  // matrix in the order of varnames_
+  size_t n = L.ntotal();
+  std::vector<double> vd(n * n);
+  std::vector<size_t> loc(n);
+  for (size_t k = 0; k < n; k++) 
+    loc[k] = dslip[0].get_loc().at(varnames_[k]);
+  for (size_t j = 0; j < n; j++)
+    for (size_t k = 0; k < n; k++)
+      vd[CINDEX(j,k,n)] = sign[j] * dslip[j].rawptr()[loc[k]];
+  apply_(&vd[0], res.rawptr(), n);
 
   return res;
 }
@@ -709,25 +969,28 @@ History GeneralLinearHardening::d_hist_d_h_ext(const Symmetric & stress,
   consistency(L);
   History res = blank_hist().history_derivative(history.subset(ext)).zero();
 
-  // Do the sum
-  for (size_t i = 0; i < L.ntotal(); i++) {
-    for (size_t g = 0; g < L.ngroup(); g++) {
-      for (size_t l = 0; l < L.nslip(g); l++) {
-        size_t j = L.flat(g, l); 
-        History curr = R.d_slip_d_h(g, l, stress, Q,  history, L, T, fixed);
-        double sign = 1.0;
-        if (absval_) {
-          sign = copysign(1.0, R.slip(g, l, stress, Q, history, L, T, fixed));
-        }
-        for (auto vn : ext) {
-          if (curr.contains(vn)) {
-            res.get<double>(varnames_[i]+"_"+vn) += 
-                M_->data()[CINDEX(i,j,L.ntotal())] * sign * curr.get<double>(vn);
-          }
-        }
-      }
-    }
-  }
+  std::vector<double> sign;
+  std::vector<History> dslip;
+  slip_derivatives_(stress, Q, history, L, T, R, fixed, sign, dslip);
+
+  // Only the external variables the slip rule depends on contribute
+  std::vector<std::string> used;
+  for (auto vn : ext)
+    if (dslip.size() > 0 && dslip[0].contains(vn)) used.push_back(vn);
+  if (used.size() == 0) return res;
+
+  // Do the sum, as M times the block of signed slip derivatives
+  size_t n = L.ntotal();
+  size_t m = used.size();
+  std::vector<double> vd(n * m);
+  std::vector<double> rd(n * m);
+  for (size_t j = 0; j < n; j++)
+    for (size_t k = 0; k < m; k++)
+      vd[CINDEX(j,k,m)] = sign[j] * dslip[j].get<double>(used[k]);
+  apply_(&vd[0], &rd[0], m);
+  for (size_t i = 0; i < n; i++)
+    for (size_t k = 0; k < m; k++)
+      res.get<double>(varnames_[i]+"_"+used[k]) = rd[CINDEX(i,k,m)];
 
   return res;
 }
@@ -739,6 +1002,42 @@ void GeneralLinearHardening::consistency(Lattice & L) const
   }
 }
 
+void GeneralLinearHardening::apply_(const double * const v, 
+                                    double * const res, size_t k) const
+{
+  if (typed_) {
+    typed_->apply(v, res, k);
+    return;
+  }
+  size_t n = size();
+  const double * M = M_->data();
+  std::fill(res, res + n * k, 0.0);
+  for (size_t i = 0; i < n; i++)
+    for (size_t j = 0; j < n; j++)
+      for (size_t l = 0; l < k; l++)
+        res[CINDEX(i,l,k)] += M[CINDEX(i,j,n)] * v[CINDEX(j,l,k)];
+}
+
+void GeneralLinearHardening::slip_derivatives_(
+    const Symmetric & stress, const Orientation & Q, const History & history,
+    Lattice & L, double T, const SlipRule & R, const History & fixed,
+    std::vector<double> & sign, std::vector<History> & dslip) const
+{
+  // Once per system, rather than once per pair
+  sign.assign(L.ntotal(), 1.0);
+  dslip.clear();
+  dslip.reserve(L.ntotal());
+  for (size_t g = 0; g < L.ngroup(); g++) {
+    for (size_t l = 0; l < L.nslip(g); l++) {
+      dslip.push_back(R.d_slip_d_h(g, l, stress, Q, history, L, T, fixed));
+      if (absval_) {
+        sign[L.flat(g,l)] = copysign(1.0, R.slip(g, l, stress, Q, history, L,
+                                                 T, fixed));
+      }
+    }
+  }
+}
+
 SimpleLinearHardening::SimpleLinearHardening(ParameterSet & params) :
     SlipHardening(params),
     G_(params.get_object_parameter<SquareMatrix>("G")), 
@@ -1544,6 +1843,33 @@ size_t SumSlipSingleStrengthHardening::nmodels() const
   return models_.size();
 }
 
+void SumSlipSingleStrengthHardening::populate_decoupled(History & history) const
+{
+  for (auto model : models_)
+    model->populate_decoupled(history);
+}
+
+void SumSlipSingleStrengthHardening::init_decoupled(History & history) const
+{
+  for (auto model : models_)
+    model->init_decoupled(history);
+}
+
+void SumSlipSingleStrengthHardening::update_decoupled(History & fixed_np1,
+                                                      const History & fixed_n,
+                                                      double T_np1, double T_n,
+                                                      double t_np1, double t_n) const
+{
+  for (auto model : models_)
+    model->update_decoupled(fixed_np1, fixed_n, T_np1, T_n, t_np1, t_n);
+}
+
+void SumSlipSingleStrengthHardening::populate_fixed(History & fixed, double T) const
+{
+  for (auto model : models_)
+    model->populate_fixed(fixed, T);
+}
+
 bool SumSlipSingleStrengthHardening::use_nye() const
 {
   for (auto model : models_) {
@@ -11,6 +11,9 @@ namespace neml {
 PYBIND11_MODULE(slipharden, m) {
   m.doc() = "Crystal plasticity slip rate relations";
 
+  py::module::import("neml.math.matrix");
+  py::module::import("neml.cp.crystallography");
+
   py::class_<SlipHardening, NEMLObject, std::shared_ptr<SlipHardening>>(m, "SlipHardening")
       .def_property_readonly("varnames", &SlipHardening::varnames)
       .def("set_varnames", &SlipHardening::set_varnames)
@@ -22,6 +25,10 @@ PYBIND11_MODULE(slipharden, m) {
       .def("d_hist_d_s", &SlipHardening::d_hist_d_s)
       .def("d_hist_d_h", &SlipHardening::d_hist_d_h)
       .def("d_hist_d_h_ext", &SlipHardening::d_hist_d_h_ext)
+      .def("populate_decoupled", &SlipHardening::populate_decoupled)
+      .def("init_decoupled", &SlipHardening::init_decoupled)
+      .def("update_decoupled", &SlipHardening::update_decoupled)
+      .def("populate_fixed", &SlipHardening::populate_fixed)
       .def_property_readonly("use_nye", &SlipHardening::use_nye)
       ;
 
@@ -52,6 +59,19 @@ PYBIND11_MODULE(slipharden, m) {
                     }))
     ;
 
+  py::class_<SlipInteractionMatrix, SquareMatrix, std::shared_ptr<SlipInteractionMatrix>>(m, "SlipInteractionMatrix")
+      .def(py::init([](py::args args, py::kwargs kwargs)
+                    {
+                      return create_object_python<SlipInteractionMatrix>(
+                          args, kwargs, {"lattice", "coefficients"});
+                    }))
+      .def_static("classify", &SlipInteractionMatrix::classify)
+      .def("interaction_type", &SlipInteractionMatrix::interaction_type)
+      .def_property_readonly("coefficients", &SlipInteractionMatrix::coefficients)
+      .def_property_readonly("counts", &SlipInteractionMatrix::counts)
+      .def_property_readonly("npairs", &SlipInteractionMatrix::npairs)
+      ;
+
   py::class_<GeneralLinearHardening, SlipHardening, std::shared_ptr<GeneralLinearHardening>>(m, "GeneralLinearHardening")
       .def(py::init([](py::args args, py::kwargs kwargs)
                     {
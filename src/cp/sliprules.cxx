@@ -59,6 +59,29 @@ History SlipRule::d_sum_slip_d_hist(const Symmetric & stress,
   return res;
 }
 
+void SlipRule::populate_decoupled(History & history) const
+{
+
+}
+
+void SlipRule::init_decoupled(History & history) const
+{
+
+}
+
+void SlipRule::update_decoupled(History & fixed_np1,
+                                const History & fixed_n,
+                                double T_np1, double T_n,
+                                double t_np1, double t_n) const
+{
+
+}
+
+void SlipRule::populate_fixed(History & fixed, double T) const
+{
+
+}
+
 bool SlipRule::use_nye() const
 {
   return false;
@@ -244,6 +267,33 @@ History SlipMultiStrengthSlipRule::d_hist_rate_d_hist(const Symmetric & stress,
   }
 }
 
+void SlipMultiStrengthSlipRule::populate_decoupled(History & history) const
+{
+  for (auto strength : strengths_)
+    strength->populate_decoupled(history);
+}
+
+void SlipMultiStrengthSlipRule::init_decoupled(History & history) const
+{
+  for (auto strength : strengths_)
+    strength->init_decoupled(history);
+}
+
+void SlipMultiStrengthSlipRule::update_decoupled(History & fixed_np1,
+                                                 const History & fixed_n,
+                                                 double T_np1, double T_n,
+                                                 double t_np1, double t_n) const
+{
+  for (auto strength : strengths_)
+    strength->update_decoupled(fixed_np1, fixed_n, T_np1, T_n, t_np1, t_n);
+}
+
+void SlipMultiStrengthSlipRule::populate_fixed(History & fixed, double T) const
+{
+  for (auto strength : strengths_)
+    strength->populate_fixed(fixed, T);
+}
+
 bool SlipMultiStrengthSlipRule::use_nye() const
 {
   for (auto strength : strengths_) {
@@ -24,6 +24,10 @@ PYBIND11_MODULE(sliprules, m) {
       .def("sum_slip", &SlipRule::sum_slip)
       .def("d_sum_slip_d_stress", &SlipRule::d_sum_slip_d_stress)
       .def("d_sum_slip_d_hist", &SlipRule::d_sum_slip_d_hist)
+      .def("populate_decoupled", &SlipRule::populate_decoupled)
+      .def("init_decoupled", &SlipRule::init_decoupled)
+      .def("update_decoupled", &SlipRule::update_decoupled)
+      .def("populate_fixed", &SlipRule::populate_fixed)
       .def_property_readonly("use_nye", &SlipRule::use_nye)
       ;
 
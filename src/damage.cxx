@@ -78,7 +78,8 @@ void NEMLScalarDamagedModel_sd::update_sd(
   base_->update_sd(e_np1, e_n, T_np1, T_n,
                    t_np1, t_n, s_prime_np1, s_prime_n,
                    &h_np1[1], &h_n[1],
-                   A_prime_np1, u_np1, u_n, p_np1, p_n);
+                   (A_np1 == nullptr) ? nullptr : A_prime_np1,
+                   u_np1, u_n, p_np1, p_n);
 
 
   for (int i=0; i<6; i++) s_np1[i] = (1-x[6]) * s_prime_np1[i];
@@ -90,6 +91,7 @@ void NEMLScalarDamagedModel_sd::update_sd(
   }
   
   // Create the tangent
+  if (A_np1 == nullptr) return;
   tangent_(e_np1, e_n, s_np1, s_n,
                  T_np1, T_n, t_np1, t_n, 
                  x[6], h_n[0], A_prime_np1, A_np1);
@@ -251,9 +253,11 @@ void NEMLScalarDamagedModel_sd::ekill_update_(double T_np1,
 {
   std::copy(h_n, h_n + nhist(), h_np1);
   h_np1[0] = 1.0;
-  elastic_->C(T_np1, A_np1);
-  for (int i=0; i<36; i++) A_np1[i] /= sfact_;
-  mat_vec(A_np1, 6, e_np1, 6, s_np1);
+  double C[36];
+  elastic_->C(T_np1, C);
+  for (int i=0; i<36; i++) C[i] /= sfact_;
+  mat_vec(C, 6, e_np1, 6, s_np1);
+  if (A_np1 != nullptr) std::copy(C, C+36, A_np1);
   if (u_n > 0.0) {
     p_np1 = p_n + u_n;
     u_np1 = 0.0;
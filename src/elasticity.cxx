@@ -5,9 +5,42 @@
 
 #include <algorithm>
 #include <stdexcept>
+#include <cmath>
 
 namespace neml {
 
+// A tensor with cubic symmetry in the crystal frame -- a on the normal
+// diagonal, b off the normal diagonal, and c on the shear diagonal --
+// rotated into the sample frame.  Only the part coupling to the crystal
+// axes is anisotropic, so this is the isotropic part plus
+// (a - b - c) * sum_k v_k v_k^T with v_k the Mandel form of the rotated
+// axis dyad r_k r_k^T, rather than the general 6x6 rotation.
+static void rotated_cubic(double a, double b, double c, const Orientation & Q,
+                          double * const R)
+{
+  double M[9];
+  Q.to_matrix(M);
+
+  std::fill(R, R+36, 0.0);
+  for (size_t i = 0; i < 3; i++)
+    for (size_t j = 0; j < 3; j++)
+      R[CINDEX(i,j,6)] = b;
+  for (size_t i = 0; i < 6; i++)
+    R[CINDEX(i,i,6)] += c;
+
+  double d = a - b - c;
+  double sq_two = sqrt(2.0);
+  for (size_t k = 0; k < 3; k++) {
+    double x = M[k];
+    double y = M[3+k];
+    double z = M[6+k];
+    double v[6] = {x*x, y*y, z*z, sq_two*y*z, sq_two*x*z, sq_two*x*y};
+    for (size_t i = 0; i < 6; i++)
+      for (size_t j = 0; j < 6; j++)
+        R[CINDEX(i,j,6)] += d * v[i] * v[j];
+  }
+}
+
 LinearElasticModel::LinearElasticModel(ParameterSet & params) :
     NEMLObject(params)
 {
@@ -108,6 +141,20 @@ void IsotropicLinearElasticModel::S(double T, double * const Sv) const
   S_calc_(G, K, Sv);
 }
 
+SymSymR4 IsotropicLinearElasticModel::C(double T, const Orientation & Q) const
+{
+  SymSymR4 res;
+  C(T, res.s());
+  return res;
+}
+
+SymSymR4 IsotropicLinearElasticModel::S(double T, const Orientation & Q) const
+{
+  SymSymR4 res;
+  S(T, res.s());
+  return res;
+}
+
 double IsotropicLinearElasticModel::E(double T) const
 {
   double G, K;
@@ -300,8 +347,46 @@ void CubicLinearElasticModel::C(double T, double * const Cv) const
 
 void CubicLinearElasticModel::S(double T, double * const Sv) const
 {
-  C(T, Sv);
-  invert_mat(Sv, 6);
+  double S1, S2, S3;
+  get_compliance_components_(T, S1, S2, S3);
+
+  std::fill(Sv, Sv+36, 0.0);
+
+  Sv[0] = S1;
+  Sv[1] = S2;
+  Sv[2] = S2;
+
+  Sv[6] = S2;
+  Sv[7] = S1;
+  Sv[8] = S2;
+
+  Sv[12] = S2;
+  Sv[13] = S2;
+  Sv[14] = S1;
+
+  Sv[21] = S3;
+  Sv[28] = S3;
+  Sv[35] = S3;
+}
+
+SymSymR4 CubicLinearElasticModel::C(double T, const Orientation & Q) const
+{
+  double C1, C2, C3;
+  get_components_(T, C1, C2, C3);
+
+  SymSymR4 res;
+  rotated_cubic(C1, C2, C3, Q, res.s());
+  return res;
+}
+
+SymSymR4 CubicLinearElasticModel::S(double T, const Orientation & Q) const
+{
+  double S1, S2, S3;
+  get_compliance_components_(T, S1, S2, S3);
+
+  SymSymR4 res;
+  rotated_cubic(S1, S2, S3, Q, res.s());
+  return res;
 }
 
 void CubicLinearElasticModel::get_components_(double T, 
@@ -327,6 +412,21 @@ void CubicLinearElasticModel::get_components_(double T,
   }
 }
 
+void CubicLinearElasticModel::get_compliance_components_(double T,
+                                                         double & S1,
+                                                         double & S2,
+                                                         double & S3) const
+{
+  double C1, C2, C3;
+  get_components_(T, C1, C2, C3);
+
+  // The inverse keeps the cubic structure
+  double f = (C1 - C2) * (C1 + 2.0 * C2);
+  S1 = (C1 + C2) / f;
+  S2 = -C2 / f;
+  S3 = 1.0 / C3;
+}
+
 TransverseIsotropicLinearElasticModel::TransverseIsotropicLinearElasticModel(
       ParameterSet & params) :
     LinearElasticModel(params),    
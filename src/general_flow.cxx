@@ -14,6 +14,38 @@ GeneralFlowRule::GeneralFlowRule(ParameterSet & params) :
 {
 }
 
+void GeneralFlowRule::evaluate(const double * const s,
+                               const double * const alpha,
+                               const double * const edot, double T,
+                               double Tdot,
+                               double * const sdot, double * const d_sdot_ds,
+                               double * const d_sdot_da, double * const adot,
+                               double * const d_adot_ds,
+                               double * const d_adot_da,
+                               GeneralFlowEvaluation & ev)
+{
+  this->s(s, alpha, edot, T, Tdot, sdot);
+  ds_ds(s, alpha, edot, T, Tdot, d_sdot_ds);
+  ds_da(s, alpha, edot, T, Tdot, d_sdot_da);
+  a(s, alpha, edot, T, Tdot, adot);
+  da_ds(s, alpha, edot, T, Tdot, d_adot_ds);
+  da_da(s, alpha, edot, T, Tdot, d_adot_da);
+}
+
+void GeneralFlowRule::evaluate(const double * const s,
+                               const double * const alpha,
+                               const double * const edot, double T,
+                               double Tdot,
+                               double * const sdot, double * const d_sdot_ds,
+                               double * const d_sdot_da, double * const adot,
+                               double * const d_adot_ds,
+                               double * const d_adot_da)
+{
+  GeneralFlowEvaluation ev;
+  evaluate(s, alpha, edot, T, Tdot, sdot, d_sdot_ds, d_sdot_da, adot,
+           d_adot_ds, d_adot_da, ev);
+}
+
 void GeneralFlowRule::work_rate(const double * const s,
                                             const double * const alpha,
                                             const double * const edot, double T,
@@ -33,6 +65,42 @@ void GeneralFlowRule::override_guess(double * const x)
   return;
 }
 
+std::vector<size_t> GeneralFlowRule::history_blocks() const
+{
+  return std::vector<size_t>(1, nhist());
+}
+
+size_t GeneralFlowRule::history_rank() const
+{
+  return 0;
+}
+
+void GeneralFlowRule::da_da_coupling(const double * const s,
+                                     const double * const alpha,
+                                     const double * const edot, double T,
+                                     double Tdot,
+                                     const GeneralFlowEvaluation & ev,
+                                     double * const U, double * const V)
+{
+  return;
+}
+
+void GeneralFlowRule::da_da_coupling(const double * const s,
+                                     const double * const alpha,
+                                     const double * const edot, double T,
+                                     double Tdot,
+                                     double * const U, double * const V)
+{
+  size_t nh = nhist();
+  double sdot[6], d_sdot_ds[36];
+  std::vector<double> d_sdot_da(6*nh), adot(nh), d_adot_ds(nh*6),
+      d_adot_da(nh*nh);
+  GeneralFlowEvaluation ev;
+  evaluate(s, alpha, edot, T, Tdot, sdot, d_sdot_ds, &d_sdot_da[0], &adot[0],
+           &d_adot_ds[0], &d_adot_da[0], ev);
+  da_da_coupling(s, alpha, edot, T, Tdot, ev, U, V);
+}
+
 TVPFlowRule::TVPFlowRule(ParameterSet & params) :
     GeneralFlowRule(params),
     elastic_(params.get_object_parameter<LinearElasticModel>("elastic")),
@@ -298,6 +366,85 @@ void TVPFlowRule::da_de(const double * const s, const double * const alpha,
 
 }
 
+void TVPFlowRule::evaluate(const double * const s,
+                           const double * const alpha,
+                           const double * const edot, double T,
+                           double Tdot,
+                           double * const sdot, double * const d_sdot_ds,
+                           double * const d_sdot_da, double * const adot,
+                           double * const d_adot_ds,
+                           double * const d_adot_da,
+                           GeneralFlowEvaluation & gev)
+{
+  int nh = nhist();
+
+  ViscoPlasticEvaluation & ev = gev.flow;
+  flow_->evaluate(s, alpha, T, ev);
+  double yv = ev.y;
+  if (yv > NEML_STRAIN_RATE_LIMIT) 
+    throw NEMLError("Strain rate exceeds rate limit");
+
+  double C[36];
+  elastic_->C(T, C);
+
+  // Stress rate
+  double erate[6];
+  for (int i=0; i<6; i++) {
+    erate[i] = edot[i] - yv * ev.g[i] - Tdot * ev.g_temp[i] - ev.g_time[i];
+  }
+  mat_vec(C, 6, erate, 6, sdot);
+
+  // Partial wrt stress
+  double work[36];
+  for (int i=0; i<36; i++) {
+    work[i] = ev.dg_ds[i] * -yv;
+  }
+  outer_update_minus(ev.g, 6, ev.dy_ds, 6, work);
+  for (int i=0; i<36; i++) {
+    work[i] -= ev.dg_ds_temp[i] * Tdot;
+    work[i] -= ev.dg_ds_time[i];
+  }
+  mat_mat(6, 6, 6, C, work, d_sdot_ds);
+
+  // Partial wrt history
+  gev.work.resize(6*nh);
+  double * worka = &gev.work[0];
+  for (int i=0; i<6*nh; i++) {
+    worka[i] = ev.dg_da[i] * -yv;
+  }
+  outer_update_minus(ev.g, 6, &ev.dy_da[0], nh, worka);
+  for (int i=0; i<6*nh; i++) {
+    worka[i] -= ev.dg_da_temp[i] * Tdot;
+    worka[i] -= ev.dg_da_time[i];
+  }
+  mat_mat(6, nh, 6, C, worka, d_sdot_da);
+
+  // History rate
+  for (int i=0; i<nh; i++) {
+    adot[i] = ev.h[i] * yv + ev.h_temp[i] * Tdot + ev.h_time[i];
+  }
+
+  // Partial wrt stress
+  for (int i=0; i<nh*6; i++) {
+    d_adot_ds[i] = ev.dh_ds[i] * yv;
+  }
+  outer_update(&ev.h[0], nh, ev.dy_ds, 6, d_adot_ds);
+  for (int i=0; i<nh*6; i++) {
+    d_adot_ds[i] += ev.dh_ds_temp[i] * Tdot;
+    d_adot_ds[i] += ev.dh_ds_time[i];
+  }
+
+  // Partial wrt history
+  for (int i=0; i<nh*nh; i++) {
+    d_adot_da[i] = ev.dh_da[i] * yv;
+  }
+  outer_update(&ev.h[0], nh, &ev.dy_da[0], nh, d_adot_da);
+  for (int i=0; i<nh*nh; i++) {
+    d_adot_da[i] += ev.dh_da_temp[i] * Tdot;
+    d_adot_da[i] += ev.dh_da_time[i];
+  }
+}
+
 void TVPFlowRule::work_rate(const double * const s,
                                     const double * const alpha,
                                     const double * const edot, double T,
@@ -347,4 +494,53 @@ void TVPFlowRule::override_guess(double * const x)
   flow_->override_guess(x);
 }
 
+std::vector<size_t> TVPFlowRule::history_blocks() const
+{
+  return flow_->history_blocks();
+}
+
+size_t TVPFlowRule::history_rank() const
+{
+  return flow_->history_rank() + 1;
+}
+
+void TVPFlowRule::da_da_coupling(const double * const s,
+                                 const double * const alpha,
+                                 const double * const edot, double T,
+                                 double Tdot,
+                                 const GeneralFlowEvaluation & ev,
+                                 double * const U, double * const V)
+{
+  // da_da = y dh_da + h dy_da + the time and temperature terms, so the
+  // flow rule coupling is scaled by y and h dy_da adds one more column.
+  // y, h, and dy_da come from the evaluation, only the flow rule's own
+  // coupling is new.
+  size_t nh = nhist();
+  size_t rf = flow_->history_rank();
+  size_t r = rf + 1;
+  const ViscoPlasticEvaluation & fev = ev.flow;
+
+  std::vector<double> Uf(nh*rf), Vf(nh*rf);
+  if (rf > 0) flow_->dh_da_coupling(s, alpha, T, &Uf[0], &Vf[0]);
+
+  for (size_t i = 0; i < nh; i++) {
+    for (size_t k = 0; k < rf; k++) {
+      U[CINDEX(i,k,r)] = fev.y * Uf[CINDEX(i,k,rf)];
+      V[CINDEX(i,k,r)] = Vf[CINDEX(i,k,rf)];
+    }
+    U[CINDEX(i,rf,r)] = fev.h[i];
+    V[CINDEX(i,rf,r)] = fev.dy_da[i];
+  }
+}
+
+std::shared_ptr<const LinearElasticModel> TVPFlowRule::elastic() const
+{
+  return elastic_;
+}
+
+std::shared_ptr<const ViscoPlasticFlowRule> TVPFlowRule::flow() const
+{
+  return flow_;
+}
+
 } // namespace neml
@@ -101,6 +101,24 @@ PYBIND11_MODULE(general_flow, m) {
             return f;
            }, "History rate derivative with respect to strain.")
       
+      .def("evaluate",
+           [](GeneralFlowRule & m, py::array_t<double, py::array::c_style> s, py::array_t<double, py::array::c_style> alpha, py::array_t<double, py::array::c_style> edot, double T, double Tdot) -> std::tuple<py::array_t<double>, py::array_t<double>, py::array_t<double>, py::array_t<double>, py::array_t<double>, py::array_t<double>>
+           {
+            auto sdot = alloc_vec<double>(6);
+            auto d_sdot_ds = alloc_mat<double>(6,6);
+            auto d_sdot_da = alloc_mat<double>(6,m.nhist());
+            auto adot = alloc_vec<double>(m.nhist());
+            auto d_adot_ds = alloc_mat<double>(m.nhist(),6);
+            auto d_adot_da = alloc_mat<double>(m.nhist(),m.nhist());
+            m.evaluate(arr2ptr<double>(s), arr2ptr<double>(alpha), 
+                          arr2ptr<double>(edot), T, Tdot,
+                          arr2ptr<double>(sdot), arr2ptr<double>(d_sdot_ds),
+                          arr2ptr<double>(d_sdot_da), arr2ptr<double>(adot),
+                          arr2ptr<double>(d_adot_ds), arr2ptr<double>(d_adot_da));
+            return std::make_tuple(sdot, d_sdot_ds, d_sdot_da, adot, 
+                                   d_adot_ds, d_adot_da);
+           }, "Stress and history rates and their partials with respect to stress and history.")
+      
       .def("work_rate",
            [](GeneralFlowRule & m, py::array_t<double, py::array::c_style> s, py::array_t<double, py::array::c_style> alpha, py::array_t<double, py::array::c_style> edot, double T, double Tdot) -> double
            {
@@ -111,6 +129,20 @@ PYBIND11_MODULE(general_flow, m) {
             return pi;
            }, "Plastic work rate.")
       .def("set_elastic_model", &GeneralFlowRule::set_elastic_model)
+      .def("history_blocks", &GeneralFlowRule::history_blocks,
+           "Sizes of the groups of history variables that only interact through the low rank coupling.")
+      .def("history_rank", &GeneralFlowRule::history_rank,
+           "Rank of the coupling between the history blocks.")
+      .def("da_da_coupling",
+           [](GeneralFlowRule & m, py::array_t<double, py::array::c_style> s, py::array_t<double, py::array::c_style> alpha, py::array_t<double, py::array::c_style> edot, double T, double Tdot) -> std::tuple<py::array_t<double>, py::array_t<double>>
+           {
+            auto U = alloc_mat<double>(m.nhist(),m.history_rank());
+            auto V = alloc_mat<double>(m.nhist(),m.history_rank());
+            m.da_da_coupling(arr2ptr<double>(s), arr2ptr<double>(alpha), 
+                          arr2ptr<double>(edot), T, Tdot,
+                          arr2ptr<double>(U), arr2ptr<double>(V));
+            return std::make_tuple(U, V);
+           }, "Coupling between the history blocks in da_da, as U V^T.")
   ;
 
   py::class_<TVPFlowRule, GeneralFlowRule, std::shared_ptr<TVPFlowRule>>(m, "TVPFlowRule")
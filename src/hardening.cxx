@@ -440,6 +440,16 @@ void CombinedHardeningRule::dq_da(const double * const alpha, double T,
 
 }
 
+std::shared_ptr<const IsotropicHardeningRule> CombinedHardeningRule::iso() const
+{
+  return iso_;
+}
+
+std::shared_ptr<const KinematicHardeningRule> CombinedHardeningRule::kin() const
+{
+  return kin_;
+}
+
 NonAssociativeHardening::NonAssociativeHardening(ParameterSet & params) :
     NEMLObject(params)
 {
@@ -490,6 +500,49 @@ void NonAssociativeHardening::dh_da_temp(const double * const s,
   std::fill(dhv, dhv+nhist()*nhist(), 0.0);
 }
 
+void NonAssociativeHardening::evaluate(const double * const s,
+                                       const double * const alpha, double T,
+                                       double * const hv,
+                                       double * const dhv_ds,
+                                       double * const dhv_da,
+                                       double * const hv_time,
+                                       double * const dhv_ds_time,
+                                       double * const dhv_da_time,
+                                       double * const hv_temp,
+                                       double * const dhv_ds_temp,
+                                       double * const dhv_da_temp) const
+{
+  h(s, alpha, T, hv);
+  dh_ds(s, alpha, T, dhv_ds);
+  dh_da(s, alpha, T, dhv_da);
+
+  h_time(s, alpha, T, hv_time);
+  dh_ds_time(s, alpha, T, dhv_ds_time);
+  dh_da_time(s, alpha, T, dhv_da_time);
+
+  h_temp(s, alpha, T, hv_temp);
+  dh_ds_temp(s, alpha, T, dhv_ds_temp);
+  dh_da_temp(s, alpha, T, dhv_da_temp);
+}
+
+std::vector<size_t> NonAssociativeHardening::history_blocks() const
+{
+  return std::vector<size_t>(1, nhist());
+}
+
+size_t NonAssociativeHardening::history_rank() const
+{
+  return 0;
+}
+
+void NonAssociativeHardening::dh_da_coupling(const double * const s,
+                                             const double * const alpha,
+                                             double T, double * const U,
+                                             double * const V) const
+{
+  return;
+}
+
 // Begin non-associative hardening rules
 //
 // Gamma functions for Chaboche
@@ -594,6 +647,240 @@ double SatGamma::beta(double T) const {
   return beta_->value(T);
 }
 
+//
+// Kernels shared by the Chaboche-type models below.  These work on all the
+// backstresses at once, with the per-backstress constants evaluated up
+// front into one array per quantity.
+//
+
+// Unit direction of the effective stress, returning the norm before
+// normalization
+static double chaboche_direction(int nb, const double * const s,
+                                 const double * const alpha, double * const n)
+{
+  double X[6];
+  std::fill(X, X+6, 0.0);
+  for (int i=0; i<nb; i++) {
+    for (int j=0; j<6; j++) {
+      X[j] += alpha[1+i*6+j];
+    }
+  }
+
+  std::copy(s, s+6, n);
+  dev_vec(n);
+  add_vec(n, X, 6, n);
+  double nv = norm2_vec(n, 6);
+  normalize_vec(n, 6);
+
+  return nv;
+}
+
+// Backstress rates proportional to the inelastic strain rate and their
+// derivatives.  Outputs can be nullptr to skip them and the derivatives
+// must start out as zero.
+static void chaboche_strain_kernel(int nb, const double * const s,
+                                   const double * const alpha,
+                                   const double * const c,
+                                   const double * const g,
+                                   const double * const dg,
+                                   double * const hv, double * const dhv_ds,
+                                   double * const dhv_da)
+{
+  int nh = 1 + 6 * nb;
+
+  double n[6];
+  double nv = chaboche_direction(nb, s, alpha, n);
+
+  // Note the extra factor of sqrt(2.0/3.0) -- this is to make it equivalent
+  // to Chaboche's original definition
+  if (hv != nullptr) {
+    for (int i=0; i<nb; i++) {
+      double cb = -2.0 / 3.0 * c[i];
+      double gb = sqrt(2.0/3.0) * g[i];
+      for (int j=0; j<6; j++) {
+        hv[1+i*6+j] = cb * n[j] - gb * alpha[1+i*6+j];
+      }
+    }
+  }
+
+  if (dhv_ds != nullptr) {
+    double nn[36];
+    std::fill(nn, nn+36, 0.0);
+    for (int i=0; i<6; i++) {
+      nn[CINDEX(i,i,6)] += 1.0;
+    }
+
+    double iv[6];
+    double jv[6];
+    for (int i=0; i<3; i++) {
+      iv[i] = 1.0 / 3.0;
+      jv[i] = 1.0;
+    }
+    for (int i=3; i<6; i++) {
+      iv[i] = 0.0;
+      jv[i] = 0.0;
+    }
+
+    outer_update_minus(iv, 6, jv, 6, nn);
+    outer_update_minus(n, 6, n, 6, nn);
+    if (nv != 0.0) {
+      for (int i=0; i<36; i++) {
+        nn[i] /= nv;
+      }
+    }
+
+    for (int i=0; i<nb; i++) {
+      double cb = -2.0 / 3.0 * c[i];
+      for (int j=0; j<36; j++) {
+        dhv_ds[6+i*36+j] = cb * nn[j];
+      }
+    }
+  }
+
+  if (dhv_da != nullptr) {
+    double ss[36];
+    std::fill(ss, ss+36, 0.0);
+    for (int i=0; i<6; i++) {
+      ss[CINDEX(i,i,6)] += 1.0;
+    }
+
+    outer_update_minus(n, 6, n, 6, ss);
+    if (nv != 0.0) {
+      for (int i=0; i<36; i++) {
+        ss[i] /= nv;
+      }
+    }
+
+    // The direction couples each backstress to all the others through
+    // the same block, so only form it once per row of blocks
+    double blk[36];
+    for (int bi=0; bi<nb; bi++) {
+      double cb = 2.0 / 3.0 * c[bi];
+      for (int i=0; i<36; i++) {
+        blk[i] = cb * ss[i];
+      }
+      double gb = sqrt(2.0/3.0) * g[bi];
+      double dgb = -sqrt(2.0/3.0) * dg[bi];
+      for (int i=0; i<6; i++) {
+        int row = 1 + bi*6 + i;
+        double * const dr = &dhv_da[CINDEX(row,0,nh)];
+        dr[0] = dgb * alpha[row];
+        dr[row] -= gb;
+        for (int bj=0; bj<nb; bj++) {
+          for (int j=0; j<6; j++) {
+            dr[1+bj*6+j] -= blk[CINDEX(i,j,6)];
+          }
+        }
+      }
+    }
+  }
+}
+
+// The part of the strain rate history partial from the kernel above that
+// couples the history blocks, as U V^T.  The first column is the
+// dependence of every backstress on gamma(alpha[0]), the other six the
+// dependence of every backstress on the sum of the backstresses through
+// the flow direction.
+static void chaboche_coupling_kernel(int nb, const double * const s,
+                                     const double * const alpha,
+                                     const double * const c,
+                                     const double * const dg,
+                                     double * const U, double * const V)
+{
+  int nh = 1 + 6 * nb;
+  int r = 7;
+
+  std::fill(U, U+nh*r, 0.0);
+  std::fill(V, V+nh*r, 0.0);
+
+  double n[6];
+  double nv = chaboche_direction(nb, s, alpha, n);
+
+  double ss[36];
+  std::fill(ss, ss+36, 0.0);
+  for (int i=0; i<6; i++) {
+    ss[CINDEX(i,i,6)] += 1.0;
+  }
+  outer_update_minus(n, 6, n, 6, ss);
+  if (nv != 0.0) {
+    for (int i=0; i<36; i++) {
+      ss[i] /= nv;
+    }
+  }
+
+  V[CINDEX(0,0,r)] = 1.0;
+  for (int bi=0; bi<nb; bi++) {
+    double cb = 2.0 / 3.0 * c[bi];
+    double dgb = -sqrt(2.0/3.0) * dg[bi];
+    for (int i=0; i<6; i++) {
+      int row = 1 + bi*6 + i;
+      U[CINDEX(row,0,r)] = dgb * alpha[row];
+      for (int j=0; j<6; j++) {
+        U[CINDEX(row,(1+j),r)] = -cb * ss[CINDEX(i,j,6)];
+      }
+      V[CINDEX(row,(1+i),r)] = 1.0;
+    }
+  }
+}
+
+// Static recovery of the backstresses, where rate(i, norm(X_i)) gives the
+// scalar multiplying X_i.  Outputs can be nullptr to skip them and the
+// derivative must start out as zero.
+template <class F>
+static void chaboche_recovery_kernel(int nb, const double * const alpha,
+                                     const double * const a, F rate,
+                                     double * const hv, double * const dhv)
+{
+  int nh = 1 + 6 * nb;
+
+  double XX[36];
+  double Xi[6];
+  for (int i=0; i<nb; i++) {
+    std::copy(&alpha[1+i*6], &alpha[1+(i+1)*6], Xi);
+    double nXi = norm2_vec(Xi, 6);
+    double r = rate(i, nXi);
+
+    if (hv != nullptr) {
+      for (int j=0; j<6; j++) {
+        hv[1+i*6+j] = r * alpha[1+i*6+j];
+      }
+    }
+
+    if (dhv != nullptr) {
+      normalize_vec(Xi, 6);
+      outer_vec(Xi, 6, Xi, 6, XX);
+      for (int j=0; j<6; j++) {
+        int ia = 1 + i*6 + j;
+        for (int k=0; k<6; k++) {
+          int ib = 1 + i*6 + k;
+          double d = (j == k) ? 1.0 : 0.0;
+          dhv[CINDEX(ia,ib,nh)] = r * (d + (a[i] - 1.0) * XX[CINDEX(j,k,6)]);
+        }
+      }
+    }
+  }
+}
+
+// Backstress rates proportional to the temperature rate.  Outputs can be
+// nullptr to skip them and both must start out as zero.
+static void chaboche_temperature_kernel(int nb, const double * const alpha,
+                                        const double * const c,
+                                        const double * const dc,
+                                        double * const hv, double * const dhv)
+{
+  int nh = 1 + 6 * nb;
+
+  for (int i=0; i<nb; i++) {
+    if (c[i] == 0.0) continue;
+    double k = -sqrt(2.0/3.0) * dc[i] / c[i];
+    for (int j=0; j<6; j++) {
+      int ci = 1 + i*6 + j;
+      if (hv != nullptr) hv[ci] = k * alpha[ci];
+      if (dhv != nullptr) dhv[CINDEX(ci,ci,nh)] = k;
+    }
+  }
+}
+
 //
 // Chaboche
 //
@@ -686,24 +973,12 @@ void Chaboche::h(const double * const s, const double * const alpha, double T,
 {
   hv[0] = sqrt(2.0/3.0); // Isotropic part
 
-  double X[6], nv[6];
-  backstress_(alpha, X);
-  std::copy(s, s+6, nv);
-  dev_vec(nv);
-  add_vec(nv, X, 6, nv);
-  normalize_vec(nv, 6);
-  
-  // Note the extra factor of sqrt(2.0/3.0) -- this is to make it equivalent
-  // to Chaboche's original definition
-  
   std::vector<double> c = eval_vector(c_, T);
+  std::vector<double> g(n_), dg(n_);
+  gamma(alpha[0], T, g.data(), dg.data());
 
-  for (int i=0; i<n_; i++) {
-    for (int j=0; j<6; j++) {
-      hv[1+i*6+j] = - 2.0 / 3.0 * c[i] * nv[j] - sqrt(2.0/3.0) * gmodels_[i]->gamma(alpha[0], T) * alpha[1+i*6+j];
-    }
-  }
-
+  chaboche_strain_kernel(n_, s, alpha, c.data(), g.data(), dg.data(), hv,
+                         nullptr, nullptr);
 }
 
 void Chaboche::dh_ds(const double * const s, const double * const alpha, double T,
@@ -713,114 +988,23 @@ void Chaboche::dh_ds(const double * const s, const double * const alpha, double
 
   std::vector<double> c = eval_vector(c_, T);
 
-  double X[6];
-  backstress_(alpha, X);
-
-  double n[6];
-  std::copy(s, s+6, n);
-  dev_vec(n);
-  add_vec(n, X, 6, n);
-  double nv = norm2_vec(n, 6);
-  normalize_vec(n, 6);
-  
-  double nn[36];
-
-  std::fill(nn, nn+36, 0.0);
-  for (int i=0; i<6; i++) {
-    nn[CINDEX(i,i,6)] += 1.0;
-  }
-  
-  double iv[6];
-  double jv[6];
-  for (int i=0; i<3; i++) {
-    iv[i] = 1.0 / 3.0;
-    jv[i] = 1.0;
-  }
-  for (int i=3; i<6; i++) {
-    iv[i] = 0.0;
-    jv[i] = 0.0;
-  }
-
-  outer_update_minus(iv, 6, jv, 6, nn);
-
-  outer_update_minus(n, 6, n, 6, nn);
-  if (nv != 0.0) {
-    for (int i=0; i<36; i++) {
-      nn[i] /= nv;
-    }
-  }
-  
-  // Fill in...
-  for (int i=0; i<n_; i++) {
-    for (int j=0; j<6; j++) {
-      for (int k=0; k<6; k++) {
-        dhv[CINDEX((1+i*6+j),(k),6)] = -2.0 / 3.0 * c[i] * nn[CINDEX(j,k,6)];
-      }
-    }
-  }
-  
+  chaboche_strain_kernel(n_, s, alpha, c.data(), nullptr, nullptr, nullptr,
+                         dhv, nullptr);
 }
 
 void Chaboche::dh_da(const double * const s, const double * const alpha, double T,
               double * const dhv) const
 {
-  // Again, there should be no earthly reason the compiler can't do this
   int nh = nhist();
 
   std::fill(dhv, dhv + nh*nh, 0.0);
 
   std::vector<double> c = eval_vector(c_, T);
+  std::vector<double> g(n_), dg(n_);
+  gamma(alpha[0], T, g.data(), dg.data());
 
-  double X[6];
-  backstress_(alpha, X);
-
-  double ss[36];
-  double n[6];
-  std::copy(s, s+6, n);
-  dev_vec(n);
-  add_vec(n, X, 6, n);
-  double nv = norm2_vec(n, 6);
-  normalize_vec(n, 6);
-  
-  std::fill(ss, ss+36, 0.0);
-  for (int i=0; i<6; i++) {
-    ss[CINDEX(i,i,6)] += 1.0;
-  }
-  
-  outer_update_minus(n, 6, n, 6, ss);
-  if (nv != 0.0) {
-    for (int i=0; i<36; i++) {
-      ss[i] /= nv;
-    }
-  }
-  
-  // Fill in the gamma part
-  for (int i=0; i<n_; i++) {
-    for (int j=0; j<6; j++) {
-      dhv[CINDEX((1+i*6+j),(1+i*6+j),nh)] -= sqrt(2.0/3.0) * gmodels_[i]->gamma(alpha[0], T);
-    }
-  }
-
-  // Fill in the ss part
-  for (int bi=0; bi<n_; bi++) {
-    for (int i=0; i<6; i++) {
-      for (int bj=0; bj<n_; bj++) {
-        for (int j=0; j<6; j++) {
-          dhv[CINDEX((1+bi*6+i),(1+bj*6+j),nh)] -= 2.0 / 3.0 * c[bi]  * 
-              ss[CINDEX(i,j,6)];
-        }
-      }
-    }
-  }
-
-  // Fill in the alpha part
-  for (int i=0; i<n_; i++) {
-    for (int j=0; j<6; j++) {
-      dhv[CINDEX((1+i*6+j),0,nhist())] = -sqrt(2.0/3.0) * 
-          gmodels_[i]->dgamma(alpha[0], T) * alpha[1+i*6+j];
-    }
-  }
-
+  chaboche_strain_kernel(n_, s, alpha, c.data(), g.data(), dg.data(), nullptr,
+                         nullptr, dhv);
 }
 
 void Chaboche::h_time(const double * const s, const double * const alpha, 
@@ -831,17 +1015,12 @@ void Chaboche::h_time(const double * const s, const double * const alpha,
   std::vector<double> A = eval_vector(A_, T);
   std::vector<double> a = eval_vector(a_, T);
 
-  double Xi[6];
-  double nXi;
-  for (int i=0; i<n_; i++) {
-    std::copy(&alpha[1+i*6], &alpha[1+(i+1)*6], Xi);
-    nXi = norm2_vec(Xi, 6);
-    for (int j=0; j<6; j++) {
-      hv[1+i*6+j] = -A[i] * sqrt(3.0/2.0) * pow(nXi, a[i] - 1.0) *
-          alpha[1+i*6+j];
-    }
-  }
-
+  chaboche_recovery_kernel(n_, alpha, a.data(),
+                           [&](int i, double nX) -> double
+                           {
+                            return -A[i] * sqrt(3.0/2.0) * pow(nX, a[i] - 1.0);
+                           },
+                           hv, nullptr);
 }
 
 void Chaboche::dh_ds_time(const double * const s, const double * const alpha, 
@@ -861,35 +1040,12 @@ void Chaboche::dh_da_time(const double * const s, const double * const alpha,
   std::vector<double> A = eval_vector(A_, T);
   std::vector<double> a = eval_vector(a_, T);
 
-  int nh = nhist();
-  int n = n_;
-  
-  double XX[36];
-  double Xi[6];
-  double nXi;
-  int ia,ib;
-  double d;
-  for (int i=0; i<n; i++) {
-    std::copy(&alpha[1+i*6], &alpha[1+(i+1)*6], Xi);
-    nXi = norm2_vec(Xi, 6);
-    normalize_vec(Xi, 6);
-    outer_vec(Xi, 6, Xi, 6, XX);
-    for (int j=0; j<6; j++) {
-      ia = 1 + i*6 + j;
-      for (int k=0; k<6; k++) {
-        ib = 1 + i*6 + k;
-        if (j == k) {
-          d = 1.0;
-        }
-        else {
-          d = 0.0;
-        }
-        dhv[CINDEX(ia,ib,nh)] = -A[i] * sqrt(3.0/2.0) * pow(nXi, a[i]-1.0) * (
-            d + (a[i] - 1.0) * XX[CINDEX(j,k,6)]);
-      }
-    }
-  }
-
+  chaboche_recovery_kernel(n_, alpha, a.data(),
+                           [&](int i, double nX) -> double
+                           {
+                            return -A[i] * sqrt(3.0/2.0) * pow(nX, a[i] - 1.0);
+                           },
+                           nullptr, dhv);
 }
 
 void Chaboche::h_temp(const double * const s, const double * const alpha, double T,
@@ -900,12 +1056,7 @@ void Chaboche::h_temp(const double * const s, const double * const alpha, double
   std::vector<double> c = eval_vector(c_, T);
   std::vector<double> dc = eval_deriv_vector(c_, T);
 
-  for (int i=0; i<n_; i++) {
-    if (c[i] == 0.0) continue;
-    for (int j=0; j<6; j++) {
-      hv[1+i*6+j] = -sqrt(2.0/3.0) * dc[i] / c[i] * alpha[1+i*6+j];
-    }
-  }
+  chaboche_temperature_kernel(n_, alpha, c.data(), dc.data(), hv, nullptr);
 }
 
 void Chaboche::dh_ds_temp(const double * const s, const double * const alpha, double T,
@@ -922,14 +1073,74 @@ void Chaboche::dh_da_temp(const double * const s, const double * const alpha, do
   std::vector<double> c = eval_vector(c_, T);
   std::vector<double> dc = eval_deriv_vector(c_, T);
 
-  for (int i=0; i<n_; i++) {
-    if (c[i] == 0.0) continue;
-    for (int j=0; j<6; j++) {
-      int ci = 1 + i*6 + j;
-      dhv[CINDEX(ci,ci,nhist())] = - sqrt(2.0/3.0) * dc[i] / c[i];
-    }
-  }
+  chaboche_temperature_kernel(n_, alpha, c.data(), dc.data(), nullptr, dhv);
+}
 
+void Chaboche::evaluate(const double * const s, const double * const alpha,
+                        double T, double * const hv, double * const dhv_ds,
+                        double * const dhv_da, double * const hv_time,
+                        double * const dhv_ds_time, double * const dhv_da_time,
+                        double * const hv_temp, double * const dhv_ds_temp,
+                        double * const dhv_da_temp) const
+{
+  int nh = nhist();
+
+  std::fill(dhv_ds, dhv_ds+nh*6, 0.0);
+  std::fill(dhv_da, dhv_da+nh*nh, 0.0);
+  std::fill(hv_time, hv_time+nh, 0.0);
+  std::fill(dhv_ds_time, dhv_ds_time+nh*6, 0.0);
+  std::fill(dhv_da_time, dhv_da_time+nh*nh, 0.0);
+  std::fill(hv_temp, hv_temp+nh, 0.0);
+  std::fill(dhv_ds_temp, dhv_ds_temp+nh*6, 0.0);
+  std::fill(dhv_da_temp, dhv_da_temp+nh*nh, 0.0);
+
+  // All the per-backstress constants, once
+  std::vector<double> c = eval_vector(c_, T);
+  std::vector<double> dc = eval_deriv_vector(c_, T);
+  std::vector<double> g(n_), dg(n_);
+  gamma(alpha[0], T, g.data(), dg.data());
+  std::vector<double> A = eval_vector(A_, T);
+  std::vector<double> a = eval_vector(a_, T);
+
+  // Strain rate
+  hv[0] = sqrt(2.0/3.0);
+  chaboche_strain_kernel(n_, s, alpha, c.data(), g.data(), dg.data(), hv,
+                         dhv_ds, dhv_da);
+
+  // Time rate
+  chaboche_recovery_kernel(n_, alpha, a.data(),
+                           [&](int i, double nX) -> double
+                           {
+                            return -A[i] * sqrt(3.0/2.0) * pow(nX, a[i] - 1.0);
+                           },
+                           hv_time, dhv_da_time);
+
+  // Temperature rate
+  chaboche_temperature_kernel(n_, alpha, c.data(), dc.data(), hv_temp,
+                              dhv_da_temp);
+}
+
+std::vector<size_t> Chaboche::history_blocks() const
+{
+  std::vector<size_t> blocks(1 + n_, 6);
+  blocks[0] = 1;
+  return blocks;
+}
+
+size_t Chaboche::history_rank() const
+{
+  return 7;
+}
+
+void Chaboche::dh_da_coupling(const double * const s,
+                              const double * const alpha, double T,
+                              double * const U, double * const V) const
+{
+  std::vector<double> c = eval_vector(c_, T);
+  std::vector<double> g(n_), dg(n_);
+  gamma(alpha[0], T, g.data(), dg.data());
+
+  chaboche_coupling_kernel(n_, s, alpha, c.data(), dg.data(), U, V);
 }
 
 int Chaboche::n() const
@@ -942,16 +1153,39 @@ std::vector<double> Chaboche::c(double T) const
   return eval_vector(c_, T);
 }
 
-void Chaboche::backstress_(const double * const alpha, double * const X) const
+void Chaboche::gamma(double a0, double T, double * const g, 
+                     double * const dg) const
 {
-  std::fill(X, X+6, 0.0);
   for (int i=0; i<n_; i++) {
-    for (int j=0; j<6; j++) {
-      X[j] += alpha[1+i*6+j];
-    }
+    g[i] = gmodels_[i]->gamma(a0, T);
+    dg[i] = gmodels_[i]->dgamma(a0, T);
   }
 }
 
+bool Chaboche::static_recovery(double T) const
+{
+  for (int i=0; i<n_; i++) {
+    if (A_[i]->value(T) != 0.0) return true;
+  }
+  return false;
+}
+
+double Chaboche::iso_update(double a0_n, double dp, double T, double & d_dp,
+                            double & d_a0n) const
+{
+  d_dp = sqrt(2.0/3.0);
+  d_a0n = 1.0;
+  return a0_n + sqrt(2.0/3.0) * dp;
+}
+
+double Chaboche::iso_q(double a0, double T, double & dq) const
+{
+  double qv;
+  iso_->q(&a0, T, &qv);
+  iso_->dq_da(&a0, T, &dq);
+  return qv;
+}
+
 //
 // ChabocheVoceRecovery with fancy, hard-coded Voce isotropic hardening
 //
@@ -1060,24 +1294,12 @@ void ChabocheVoceRecovery::h(const double * const s, const double * const alpha,
   hv[0] = theta0_->value(T) * (1 - alpha[0]/Rmax_->value(T)) *
       std::sqrt(2.0/3.0);
 
-  double X[6], nv[6];
-  backstress_(alpha, X);
-  std::copy(s, s+6, nv);
-  dev_vec(nv);
-  add_vec(nv, X, 6, nv);
-  normalize_vec(nv, 6);
-  
-  // Note the extra factor of sqrt(2.0/3.0) -- this is to make it equivalent
-  // to Chaboche's original definition
-  
   std::vector<double> c = eval_vector(c_, T);
+  std::vector<double> g(n_), dg(n_);
+  gamma(alpha[0], T, g.data(), dg.data());
 
-  for (int i=0; i<n_; i++) {
-    for (int j=0; j<6; j++) {
-      hv[1+i*6+j] = - 2.0 / 3.0 * c[i] * nv[j] - sqrt(2.0/3.0) * gmodels_[i]->gamma(alpha[0], T) * alpha[1+i*6+j];
-    }
-  }
-
+  chaboche_strain_kernel(n_, s, alpha, c.data(), g.data(), dg.data(), hv,
+                         nullptr, nullptr);
 }
 
 void ChabocheVoceRecovery::dh_ds(const double * const s, const double * const alpha, double T,
@@ -1087,116 +1309,26 @@ void ChabocheVoceRecovery::dh_ds(const double * const s, const double * const al
 
   std::vector<double> c = eval_vector(c_, T);
 
-  double X[6];
-  backstress_(alpha, X);
-
-  double n[6];
-  std::copy(s, s+6, n);
-  dev_vec(n);
-  add_vec(n, X, 6, n);
-  double nv = norm2_vec(n, 6);
-  normalize_vec(n, 6);
-  
-  double nn[36];
-
-  std::fill(nn, nn+36, 0.0);
-  for (int i=0; i<6; i++) {
-    nn[CINDEX(i,i,6)] += 1.0;
-  }
-  
-  double iv[6];
-  double jv[6];
-  for (int i=0; i<3; i++) {
-    iv[i] = 1.0 / 3.0;
-    jv[i] = 1.0;
-  }
-  for (int i=3; i<6; i++) {
-    iv[i] = 0.0;
-    jv[i] = 0.0;
-  }
-
-  outer_update_minus(iv, 6, jv, 6, nn);
-
-  outer_update_minus(n, 6, n, 6, nn);
-  if (nv != 0.0) {
-    for (int i=0; i<36; i++) {
-      nn[i] /= nv;
-    }
-  }
-  
-  // Fill in...
-  for (int i=0; i<n_; i++) {
-    for (int j=0; j<6; j++) {
-      for (int k=0; k<6; k++) {
-        dhv[CINDEX((1+i*6+j),(k),6)] = -2.0 / 3.0 * c[i] * nn[CINDEX(j,k,6)];
-      }
-    }
-  }
-  
+  chaboche_strain_kernel(n_, s, alpha, c.data(), nullptr, nullptr, nullptr,
+                         dhv, nullptr);
 }
 
 void ChabocheVoceRecovery::dh_da(const double * const s, const double * const alpha, double T,
               double * const dhv) const
 {
-  // Again, there should be no earthly reason the compiler can't do this
   int nh = nhist();
 
   std::fill(dhv, dhv + nh*nh, 0.0);
 
   // Isotropic contribution
   dhv[0] = -theta0_->value(T) / Rmax_->value(T) * std::sqrt(2.0/3.0);
-  std::vector<double> c = eval_vector(c_, T);
 
-  double X[6];
-  backstress_(alpha, X);
-
-  double ss[36];
-  double n[6];
-  std::copy(s, s+6, n);
-  dev_vec(n);
-  add_vec(n, X, 6, n);
-  double nv = norm2_vec(n, 6);
-  normalize_vec(n, 6);
-  
-  std::fill(ss, ss+36, 0.0);
-  for (int i=0; i<6; i++) {
-    ss[CINDEX(i,i,6)] += 1.0;
-  }
-  
-  outer_update_minus(n, 6, n, 6, ss);
-  if (nv != 0.0) {
-    for (int i=0; i<36; i++) {
-      ss[i] /= nv;
-    }
-  }
-  
-  // Fill in the gamma part
-  for (int i=0; i<n_; i++) {
-    for (int j=0; j<6; j++) {
-      dhv[CINDEX((1+i*6+j),(1+i*6+j),nh)] -= sqrt(2.0/3.0) * gmodels_[i]->gamma(alpha[0], T);
-    }
-  }
-
-  // Fill in the ss part
-  for (int bi=0; bi<n_; bi++) {
-    for (int i=0; i<6; i++) {
-      for (int bj=0; bj<n_; bj++) {
-        for (int j=0; j<6; j++) {
-          dhv[CINDEX((1+bi*6+i),(1+bj*6+j),nh)] -= 2.0 / 3.0 * c[bi]  * 
-              ss[CINDEX(i,j,6)];
-        }
-      }
-    }
-  }
-
-  // Fill in the alpha part
-  for (int i=0; i<n_; i++) {
-    for (int j=0; j<6; j++) {
-      dhv[CINDEX((1+i*6+j),0,nhist())] = -sqrt(2.0/3.0) * 
-          gmodels_[i]->dgamma(alpha[0], T) * alpha[1+i*6+j];
-    }
-  }
+  std::vector<double> c = eval_vector(c_, T);
+  std::vector<double> g(n_), dg(n_);
+  gamma(alpha[0], T, g.data(), dg.data());
 
+  chaboche_strain_kernel(n_, s, alpha, c.data(), g.data(), dg.data(), nullptr,
+                         nullptr, dhv);
 }
 
 void ChabocheVoceRecovery::h_time(const double * const s, const double * const alpha, 
@@ -1212,17 +1344,12 @@ void ChabocheVoceRecovery::h_time(const double * const s, const double * const a
   std::vector<double> A = eval_vector(A_, T);
   std::vector<double> a = eval_vector(a_, T);
 
-  double Xi[6];
-  double nXi;
-  for (int i=0; i<n_; i++) {
-    std::copy(&alpha[1+i*6], &alpha[1+(i+1)*6], Xi);
-    nXi = norm2_vec(Xi, 6);
-    for (int j=0; j<6; j++) {
-      hv[1+i*6+j] = -A[i] * pow(sqrt(3.0/2.0) * nXi, a[i] - 1.0) *
-          alpha[1+i*6+j];
-    }
-  }
-
+  chaboche_recovery_kernel(n_, alpha, a.data(),
+                           [&](int i, double nX) -> double
+                           {
+                            return -A[i] * pow(sqrt(3.0/2.0) * nX, a[i] - 1.0);
+                           },
+                           hv, nullptr);
 }
 
 void ChabocheVoceRecovery::dh_ds_time(const double * const s, const double * const alpha, 
@@ -1246,35 +1373,12 @@ void ChabocheVoceRecovery::dh_da_time(const double * const s, const double * con
   std::vector<double> A = eval_vector(A_, T);
   std::vector<double> a = eval_vector(a_, T);
 
-  int nh = nhist();
-  int n = n_;
-  
-  double XX[36];
-  double Xi[6];
-  double nXi;
-  int ia,ib;
-  double d;
-  for (int i=0; i<n; i++) {
-    std::copy(&alpha[1+i*6], &alpha[1+(i+1)*6], Xi);
-    nXi = norm2_vec(Xi, 6);
-    normalize_vec(Xi, 6);
-    outer_vec(Xi, 6, Xi, 6, XX);
-    for (int j=0; j<6; j++) {
-      ia = 1 + i*6 + j;
-      for (int k=0; k<6; k++) {
-        ib = 1 + i*6 + k;
-        if (j == k) {
-          d = 1.0;
-        }
-        else {
-          d = 0.0;
-        }
-        dhv[CINDEX(ia,ib,nh)] = -A[i] * pow( sqrt(3.0/2.0) * nXi, a[i]-1.0) * (
-            d + (a[i] - 1.0) * XX[CINDEX(j,k,6)]);
-      }
-    }
-  }
-
+  chaboche_recovery_kernel(n_, alpha, a.data(),
+                           [&](int i, double nX) -> double
+                           {
+                            return -A[i] * pow(sqrt(3.0/2.0) * nX, a[i] - 1.0);
+                           },
+                           nullptr, dhv);
 }
 
 void ChabocheVoceRecovery::h_temp(const double * const s, const double * const alpha, double T,
@@ -1285,12 +1389,7 @@ void ChabocheVoceRecovery::h_temp(const double * const s, const double * const a
   std::vector<double> c = eval_vector(c_, T);
   std::vector<double> dc = eval_deriv_vector(c_, T);
 
-  for (int i=0; i<n_; i++) {
-    if (c[i] == 0.0) continue;
-    for (int j=0; j<6; j++) {
-      hv[1+i*6+j] = -sqrt(2.0/3.0) * dc[i] / c[i] * alpha[1+i*6+j];
-    }
-  }
+  chaboche_temperature_kernel(n_, alpha, c.data(), dc.data(), hv, nullptr);
 }
 
 void ChabocheVoceRecovery::dh_ds_temp(const double * const s, const double * const alpha, double T,
@@ -1307,13 +1406,88 @@ void ChabocheVoceRecovery::dh_da_temp(const double * const s, const double * con
   std::vector<double> c = eval_vector(c_, T);
   std::vector<double> dc = eval_deriv_vector(c_, T);
 
-  for (int i=0; i<n_; i++) {
-    if (c[i] == 0.0) continue;
-    for (int j=0; j<6; j++) {
-      int ci = 1 + i*6 + j;
-      dhv[CINDEX(ci,ci,nhist())] = - sqrt(2.0/3.0) * dc[i] / c[i];
-    }
-  }
+  chaboche_temperature_kernel(n_, alpha, c.data(), dc.data(), nullptr, dhv);
+}
+
+void ChabocheVoceRecovery::evaluate(const double * const s,
+                                    const double * const alpha, double T,
+                                    double * const hv, double * const dhv_ds,
+                                    double * const dhv_da,
+                                    double * const hv_time,
+                                    double * const dhv_ds_time,
+                                    double * const dhv_da_time,
+                                    double * const hv_temp,
+                                    double * const dhv_ds_temp,
+                                    double * const dhv_da_temp) const
+{
+  int nh = nhist();
+
+  std::fill(dhv_ds, dhv_ds+nh*6, 0.0);
+  std::fill(dhv_da, dhv_da+nh*nh, 0.0);
+  std::fill(hv_time, hv_time+nh, 0.0);
+  std::fill(dhv_ds_time, dhv_ds_time+nh*6, 0.0);
+  std::fill(dhv_da_time, dhv_da_time+nh*nh, 0.0);
+  std::fill(hv_temp, hv_temp+nh, 0.0);
+  std::fill(dhv_ds_temp, dhv_ds_temp+nh*6, 0.0);
+  std::fill(dhv_da_temp, dhv_da_temp+nh*nh, 0.0);
+
+  // All the constants, once
+  double theta0 = theta0_->value(T);
+  double Rmax = Rmax_->value(T);
+  double Rmin = Rmin_->value(T);
+  double r1 = r1_->value(T);
+  double r2 = r2_->value(T);
+  std::vector<double> c = eval_vector(c_, T);
+  std::vector<double> dc = eval_deriv_vector(c_, T);
+  std::vector<double> g(n_), dg(n_);
+  gamma(alpha[0], T, g.data(), dg.data());
+  std::vector<double> A = eval_vector(A_, T);
+  std::vector<double> a = eval_vector(a_, T);
+
+  // Strain rate
+  hv[0] = theta0 * (1 - alpha[0]/Rmax) * std::sqrt(2.0/3.0);
+  dhv_da[0] = -theta0 / Rmax * std::sqrt(2.0/3.0);
+  chaboche_strain_kernel(n_, s, alpha, c.data(), g.data(), dg.data(), hv,
+                         dhv_ds, dhv_da);
+
+  // Time rate
+  hv_time[0] = r1 * (Rmin - alpha[0]) * std::pow(std::fabs(Rmin - alpha[0]),
+                                                 r2 - 1.0);
+  dhv_da_time[0] = std::copysign(r1 * r2 * std::pow(std::fabs(Rmin - alpha[0]),
+                                                    r2 - 1.0), Rmin - alpha[0]);
+  chaboche_recovery_kernel(n_, alpha, a.data(),
+                           [&](int i, double nX) -> double
+                           {
+                            return -A[i] * pow(sqrt(3.0/2.0) * nX, a[i] - 1.0);
+                           },
+                           hv_time, dhv_da_time);
+
+  // Temperature rate
+  chaboche_temperature_kernel(n_, alpha, c.data(), dc.data(), hv_temp,
+                              dhv_da_temp);
+}
+
+std::vector<size_t> ChabocheVoceRecovery::history_blocks() const
+{
+  std::vector<size_t> blocks(1 + n_, 6);
+  blocks[0] = 1;
+  return blocks;
+}
+
+size_t ChabocheVoceRecovery::history_rank() const
+{
+  return 7;
+}
+
+void ChabocheVoceRecovery::dh_da_coupling(const double * const s,
+                                          const double * const alpha, double T,
+                                          double * const U, double * const V) const
+{
+  std::vector<double> c = eval_vector(c_, T);
+  std::vector<double> g(n_), dg(n_);
+  gamma(alpha[0], T, g.data(), dg.data());
+
+  chaboche_coupling_kernel(n_, s, alpha, c.data(), dg.data(), U, V);
 }
 
 int ChabocheVoceRecovery::n() const
@@ -1321,14 +1495,46 @@ int ChabocheVoceRecovery::n() const
   return n_;
 }
 
-void ChabocheVoceRecovery::backstress_(const double * const alpha, double * const X) const
+std::vector<double> ChabocheVoceRecovery::c(double T) const
+{
+  return eval_vector(c_, T);
+}
+
+void ChabocheVoceRecovery::gamma(double a0, double T, double * const g, 
+                                 double * const dg) const
 {
-  std::fill(X, X+6, 0.0);
   for (int i=0; i<n_; i++) {
-    for (int j=0; j<6; j++) {
-      X[j] += alpha[1+i*6+j];
-    }
+    g[i] = gmodels_[i]->gamma(a0, T);
+    dg[i] = gmodels_[i]->dgamma(a0, T);
+  }
+}
+
+bool ChabocheVoceRecovery::static_recovery(double T) const
+{
+  if (r1_->value(T) != 0.0) return true;
+  for (int i=0; i<n_; i++) {
+    if (A_[i]->value(T) != 0.0) return true;
   }
+  return false;
+}
+
+double ChabocheVoceRecovery::iso_update(double a0_n, double dp, double T,
+                                        double & d_dp, double & d_a0n) const
+{
+  // a0 = a0_n + sqrt(2/3) * theta0 * (1 - a0 / Rmax) * dp, solved for a0
+  double c = sqrt(2.0/3.0) * theta0_->value(T);
+  double Rmax = Rmax_->value(T);
+  double den = 1.0 + c * dp / Rmax;
+  double a0 = (a0_n + c * dp) / den;
+  d_dp = c * (1.0 - a0 / Rmax) / den;
+  d_a0n = 1.0 / den;
+  return a0;
+}
+
+double ChabocheVoceRecovery::iso_q(double a0, double T, double & dq) const
+{
+  dq = -1.0;
+  return -(s0_->value(T) + a0);
 }
 
 } // namespace neml
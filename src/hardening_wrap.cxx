@@ -220,6 +220,27 @@ PYBIND11_MODULE(hardening, m) {
             m.dh_da_temp(arr2ptr<double>(s), arr2ptr<double>(alpha), T, arr2ptr<double>(f));
             return f;
            }, "Hardening rule (temperature) derivative with respect to history.")
+      .def("evaluate",
+           [](NonAssociativeHardening & m, py::array_t<double, py::array::c_style> s, py::array_t<double, py::array::c_style> alpha, double T) -> std::tuple<py::array_t<double>, py::array_t<double>, py::array_t<double>, py::array_t<double>, py::array_t<double>, py::array_t<double>, py::array_t<double>, py::array_t<double>, py::array_t<double>>
+           {
+            auto h = alloc_vec<double>(m.nhist());
+            auto dh_ds = alloc_mat<double>(m.nhist(),6);
+            auto dh_da = alloc_mat<double>(m.nhist(),m.nhist());
+            auto h_time = alloc_vec<double>(m.nhist());
+            auto dh_ds_time = alloc_mat<double>(m.nhist(),6);
+            auto dh_da_time = alloc_mat<double>(m.nhist(),m.nhist());
+            auto h_temp = alloc_vec<double>(m.nhist());
+            auto dh_ds_temp = alloc_mat<double>(m.nhist(),6);
+            auto dh_da_temp = alloc_mat<double>(m.nhist(),m.nhist());
+            m.evaluate(arr2ptr<double>(s), arr2ptr<double>(alpha), T,
+                       arr2ptr<double>(h), arr2ptr<double>(dh_ds),
+                       arr2ptr<double>(dh_da), arr2ptr<double>(h_time),
+                       arr2ptr<double>(dh_ds_time), arr2ptr<double>(dh_da_time),
+                       arr2ptr<double>(h_temp), arr2ptr<double>(dh_ds_temp),
+                       arr2ptr<double>(dh_da_temp));
+            return std::make_tuple(h, dh_ds, dh_da, h_time, dh_ds_time,
+                                   dh_da_time, h_temp, dh_ds_temp, dh_da_temp);
+           }, "All the hardening rates and their derivatives at once.")
       ;
 
   py::class_<GammaModel, NEMLObject, std::shared_ptr<GammaModel>>(m, "GammaModel")
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <sstream>
+#include <utility>
 
 namespace neml {
 
@@ -34,17 +35,16 @@ History::History(const History & other) :
   copy_maps(other);
 }
 
-History::History(const History && other) :
-    size_(other.size()), storesize_(other.size()), store_(other.store())
+History::History(History && other) :
+    size_(other.size_), storesize_(other.storesize_), store_(other.store_),
+    storage_(other.storage_), loc_(std::move(other.loc_)),
+    type_(std::move(other.type_)), order_(std::move(other.order_))
 {
-  if (store_) {
-    storage_ = new double[storesize_];
-    std::copy(other.rawptr(), other.rawptr() + size_, storage_);
-  }
-  else {
-    storage_ = const_cast<double*>(other.rawptr());
-  }
-  copy_maps(other);
+  // Leave other as an empty view so it doesn't free what we now own
+  other.size_ = 0;
+  other.storesize_ = 0;
+  other.store_ = false;
+  other.storage_ = nullptr;
 }
 
 History::History(double * data) :
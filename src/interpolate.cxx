@@ -25,6 +25,110 @@ bool Interpolate::valid() const
   return valid_;
 }
 
+void Interpolate::value_and_derivative(double x, double & v, double & dv) const
+{
+  v = value(x);
+  dv = derivative(x);
+}
+
+void Interpolate::value(const double * const x, double * const y,
+                        size_t n) const
+{
+  for (size_t i = 0; i < n; i++) {
+    y[i] = value(x[i]);
+  }
+}
+
+void Interpolate::derivative(const double * const x, double * const dy,
+                             size_t n) const
+{
+  for (size_t i = 0; i < n; i++) {
+    dy[i] = derivative(x[i]);
+  }
+}
+
+IntervalLookup::IntervalLookup(const std::vector<double> & points) :
+    uniform_(false), x0_(0.0), dx_(0.0), last_(1)
+{
+  size_t n = points.size();
+  if (n < 2) return;
+
+  x0_ = points.front();
+  dx_ = (points.back() - points.front()) / ((double) (n - 1));
+  if (not (dx_ > 0.0)) return;
+
+  // Tolerate roundoff in tables generated with a fixed step
+  double tol = 1.0e-10 * (points.back() - points.front());
+  uniform_ = true;
+  for (size_t i = 0; i < n; i++) {
+    if (std::fabs(points[i] - (x0_ + dx_ * i)) > tol) {
+      uniform_ = false;
+      break;
+    }
+  }
+}
+
+IntervalLookup::IntervalLookup(const IntervalLookup & other) :
+    uniform_(other.uniform_), x0_(other.x0_), dx_(other.dx_),
+    last_(other.last_.load(std::memory_order_relaxed))
+{
+
+}
+
+IntervalLookup & IntervalLookup::operator=(const IntervalLookup & other)
+{
+  uniform_ = other.uniform_;
+  x0_ = other.x0_;
+  dx_ = other.dx_;
+  last_.store(other.last_.load(std::memory_order_relaxed),
+              std::memory_order_relaxed);
+  return *this;
+}
+
+size_t IntervalLookup::find(const std::vector<double> & points, double x) const
+{
+  size_t last = last_.load(std::memory_order_relaxed);
+  size_t ind = find(points, x, last);
+  if (ind != last) {
+    last_.store(ind, std::memory_order_relaxed);
+  }
+  return ind;
+}
+
+size_t IntervalLookup::find(const std::vector<double> & points, double x,
+                            size_t hint) const
+{
+  size_t n = points.size();
+
+  // Same interval as the hint?
+  size_t ind = hint;
+  if ((ind > 0) && (ind < n) && (points[ind-1] < x) && (x <= points[ind])) {
+    return ind;
+  }
+
+  if (uniform_) {
+    double r = std::ceil((x - x0_) / dx_);
+    if (not (r > 1.0)) ind = 1;
+    else if (r >= (double) (n - 1)) ind = n - 1;
+    else ind = (size_t) r;
+    // Fix up roundoff in the index calculation
+    while ((ind > 1) && (x <= points[ind-1])) ind--;
+    while ((ind < n - 1) && (x > points[ind])) ind++;
+  }
+  else {
+    ind = std::distance(points.begin(), 
+                        std::lower_bound(points.begin(), points.end(), x));
+    ind = std::min(std::max(ind, (size_t) 1), n - 1);
+  }
+
+  return ind;
+}
+
+bool IntervalLookup::uniform() const
+{
+  return uniform_;
+}
+
 PolynomialInterpolate::PolynomialInterpolate(ParameterSet & params) :
     Interpolate(params), 
     coefs_(params.get_parameter<std::vector<double>>("coefs"))
@@ -61,11 +165,40 @@ double PolynomialInterpolate::derivative(double x) const
   return polyval(deriv_, x);
 }
 
+void PolynomialInterpolate::value(const double * const x, double * const y,
+                                  size_t n) const
+{
+  polyval_batch_(coefs_, x, y, n);
+}
+
+void PolynomialInterpolate::derivative(const double * const x, 
+                                       double * const dy, size_t n) const
+{
+  polyval_batch_(deriv_, x, dy, n);
+}
+
+void PolynomialInterpolate::polyval_batch_(const std::vector<double> & poly,
+                                           const double * const x,
+                                           double * const y, size_t n) const
+{
+  // Horner's method with the points as the inner loop, so it vectorizes
+  std::fill(y, y + n, 0.0);
+  for (auto c : poly) {
+#ifdef USE_OMP
+#pragma omp simd
+#endif
+    for (size_t i = 0; i < n; i++) {
+      y[i] = y[i] * x[i] + c;
+    }
+  }
+}
+
 
 PiecewiseLinearInterpolate::PiecewiseLinearInterpolate(ParameterSet & params) :
       Interpolate(params),
       points_(params.get_parameter<std::vector<double>>("points")), 
-      values_(params.get_parameter<std::vector<double>>("values"))
+      values_(params.get_parameter<std::vector<double>>("values")),
+      lookup_(points_)
 {
   // Check if sorted
   if (not std::is_sorted(points_.begin(), points_.end())) {
@@ -106,11 +239,7 @@ double PiecewiseLinearInterpolate::value(double x) const
     return values_.back();
   }
   else {
-    auto it = points_.begin();
-    for (; it != points_.end(); ++it) {
-      if (x <= *it) break;
-    }
-    size_t ind = std::distance(points_.begin(), it);
+    size_t ind = lookup_.find(points_, x);
     double x1 = points_[ind-1];
     double x2 = points_[ind];
     double y1 = values_[ind-1];
@@ -129,11 +258,7 @@ double PiecewiseLinearInterpolate::derivative(double x) const
     return 0.0;
   }
   else {
-    auto it = points_.begin();
-    for (; it != points_.end(); ++it) {
-      if (x <= *it) break;
-    }
-    size_t ind = std::distance(points_.begin(), it);
+    size_t ind = lookup_.find(points_, x);
     double x1 = points_[ind-1];
     double x2 = points_[ind];
     double y1 = values_[ind-1];
@@ -143,10 +268,69 @@ double PiecewiseLinearInterpolate::derivative(double x) const
   }
 }
 
+void PiecewiseLinearInterpolate::value(const double * const x, 
+                                       double * const y, size_t n) const
+{
+  // Carry the interval from point to point rather than sharing the hint
+  size_t ind = 1;
+  for (size_t i = 0; i < n; i++) {
+    if (x[i] <= points_.front()) {
+      y[i] = values_.front();
+    }
+    else if (x[i] >= points_.back()) {
+      y[i] = values_.back();
+    }
+    else {
+      ind = lookup_.find(points_, x[i], ind);
+      y[i] = (values_[ind] - values_[ind-1]) / (points_[ind] - points_[ind-1])
+          * (x[i] - points_[ind-1]) + values_[ind-1];
+    }
+  }
+}
+
+void PiecewiseLinearInterpolate::derivative(const double * const x, 
+                                            double * const dy, size_t n) const
+{
+  size_t ind = 1;
+  for (size_t i = 0; i < n; i++) {
+    if ((x[i] <= points_.front()) || (x[i] >= points_.back())) {
+      dy[i] = 0.0;
+    }
+    else {
+      ind = lookup_.find(points_, x[i], ind);
+      dy[i] = (values_[ind] - values_[ind-1]) / (points_[ind] - points_[ind-1]);
+    }
+  }
+}
+
+void PiecewiseLinearInterpolate::value_and_derivative(double x, double & v,
+                                                      double & dv) const
+{
+  if (x <= points_.front()) {
+    v = values_.front();
+    dv = 0.0;
+  }
+  else if (x >= points_.back()) {
+    v = values_.back();
+    dv = 0.0;
+  }
+  else {
+    size_t ind = lookup_.find(points_, x);
+    double x1 = points_[ind-1];
+    double x2 = points_[ind];
+    double y1 = values_[ind-1];
+    double y2 = values_[ind];
+
+    dv = (y2-y1)/(x2-x1);
+    v = dv * (x - x1) + y1;
+  }
+}
+
 GenericPiecewiseInterpolate::GenericPiecewiseInterpolate(ParameterSet & params) :
       Interpolate(params),
       points_(params.get_parameter<std::vector<double>>("points")), 
-      functions_(params.get_object_parameter_vector<Interpolate>("functions"))
+      functions_(params.get_object_parameter_vector<Interpolate>("functions")),
+      lookup_(points_)
 {
   // Check if sorted
   if (not std::is_sorted(points_.begin(), points_.end())) {
@@ -187,11 +371,7 @@ double GenericPiecewiseInterpolate::value(double x) const
     return functions_.back()->value(x);
   }
   else {
-    auto it = points_.begin();
-    for (; it != points_.end(); ++it) {
-      if (x <= *it) break;
-    }
-    size_t ind = std::distance(points_.begin(), it);
+    size_t ind = lookup_.find(points_, x);
 
     return functions_[ind]->value(x);
   }
@@ -206,21 +386,34 @@ double GenericPiecewiseInterpolate::derivative(double x) const
     return functions_.back()->derivative(x);
   }
   else {
-    auto it = points_.begin();
-    for (; it != points_.end(); ++it) {
-      if (x <= *it) break;
-    }
-    size_t ind = std::distance(points_.begin(), it);
+    size_t ind = lookup_.find(points_, x);
 
     return functions_[ind]->derivative(x);
   }
 }
 
+void GenericPiecewiseInterpolate::value_and_derivative(double x, double & v,
+                                                       double & dv) const
+{
+  if (x <= points_.front()) {
+    functions_[0]->value_and_derivative(x, v, dv);
+  }
+  else if (x >= points_.back()) {
+    functions_.back()->value_and_derivative(x, v, dv);
+  }
+  else {
+    size_t ind = lookup_.find(points_, x);
+
+    functions_[ind]->value_and_derivative(x, v, dv);
+  }
+}
+
 PiecewiseLogLinearInterpolate::PiecewiseLogLinearInterpolate(
     ParameterSet & params) :
       Interpolate(params),
       points_(params.get_parameter<std::vector<double>>("points")),
-      values_(params.get_parameter<std::vector<double>>("values"))
+      values_(params.get_parameter<std::vector<double>>("values")),
+      lookup_(points_)
 {
   // Check if sorted
   if (not std::is_sorted(points_.begin(), points_.end())) {
@@ -266,11 +459,7 @@ double PiecewiseLogLinearInterpolate::value(double x) const
     return exp(values_.back());
   }
   else {
-    auto it = points_.begin();
-    for (; it != points_.end(); ++it) {
-      if (x <= *it) break;
-    }
-    size_t ind = std::distance(points_.begin(), it);
+    size_t ind = lookup_.find(points_, x);
     double x1 = points_[ind-1];
     double x2 = points_[ind];
     double y1 = values_[ind-1];
@@ -289,11 +478,7 @@ double PiecewiseLogLinearInterpolate::derivative(double x) const
     return 0.0;
   }
   else {
-    auto it = points_.begin();
-    for (; it != points_.end(); ++it) {
-      if (x <= *it) break;
-    }
-    size_t ind = std::distance(points_.begin(), it);
+    size_t ind = lookup_.find(points_, x);
     double x1 = points_[ind-1];
     double x2 = points_[ind];
     double y1 = values_[ind-1];
@@ -303,11 +488,36 @@ double PiecewiseLogLinearInterpolate::derivative(double x) const
   }
 }
 
+void PiecewiseLogLinearInterpolate::value_and_derivative(double x, double & v,
+                                                         double & dv) const
+{
+  if (x <= points_.front()) {
+    v = exp(values_.front());
+    dv = 0.0;
+  }
+  else if (x >= points_.back()) {
+    v = exp(values_.back());
+    dv = 0.0;
+  }
+  else {
+    size_t ind = lookup_.find(points_, x);
+    double x1 = points_[ind-1];
+    double x2 = points_[ind];
+    double y1 = values_[ind-1];
+    double y2 = values_[ind];
+
+    double slope = (y2-y1)/(x2-x1);
+    v = exp(slope * (x - x1) + y1);
+    dv = v * slope;
+  }
+}
+
 PiecewiseSemiLogXLinearInterpolate::PiecewiseSemiLogXLinearInterpolate(
     ParameterSet & params) :
       Interpolate(params), 
       points_(params.get_parameter<std::vector<double>>("points")), 
-      values_(params.get_parameter<std::vector<double>>("values"))
+      values_(params.get_parameter<std::vector<double>>("values")),
+      lookup_(points_)
 {
   // Check if sorted
   if (not std::is_sorted(points_.begin(), points_.end())) {
@@ -354,11 +564,7 @@ double PiecewiseSemiLogXLinearInterpolate::value(double x) const
     return values_.back();
   }
   else {
-    auto it = points_.begin();
-    for (; it != points_.end(); ++it) {
-      if (x <= *it) break;
-    }
-    size_t ind = std::distance(points_.begin(), it);
+    size_t ind = lookup_.find(points_, x);
     double x1 = points_[ind-1];
     double x2 = points_[ind];
     double y1 = values_[ind-1];
@@ -377,11 +583,7 @@ double PiecewiseSemiLogXLinearInterpolate::derivative(double x) const
     return 0.0;
   }
   else {
-    auto it = points_.begin();
-    for (; it != points_.end(); ++it) {
-      if (x <= *it) break;
-    }
-    size_t ind = std::distance(points_.begin(), it);
+    size_t ind = lookup_.find(points_, x);
     double x1 = points_[ind-1];
     double x2 = points_[ind];
     double y1 = values_[ind-1];
@@ -391,6 +593,30 @@ double PiecewiseSemiLogXLinearInterpolate::derivative(double x) const
   }
 }
 
+void PiecewiseSemiLogXLinearInterpolate::value_and_derivative(
+    double x, double & v, double & dv) const
+{
+  if (x <= points_.front()) {
+    v = values_.front();
+    dv = 0.0;
+  }
+  else if (x >= points_.back()) {
+    v = values_.back();
+    dv = 0.0;
+  }
+  else {
+    size_t ind = lookup_.find(points_, x);
+    double x1 = points_[ind-1];
+    double x2 = points_[ind];
+    double y1 = values_[ind-1];
+    double y2 = values_[ind];
+
+    double slope = (y2-y1)/(std::log10(x2)-std::log10(x1));
+    v = slope * (std::log10(x) - std::log10(x1)) + y1;
+    dv = slope / (x * std::log(10));
+  }
+}
+
 ConstantInterpolate::ConstantInterpolate(ParameterSet & params) :
     Interpolate(params),
     v_(params.get_parameter<double>("v"))
@@ -465,6 +691,29 @@ double ExpInterpolate::derivative(double x) const
   return -A_ * B_ * exp(B_ / x) / (x*x);
 }
 
+void ExpInterpolate::value(const double * const x, double * const y,
+                           size_t n) const
+{
+#ifdef USE_OMP
+#pragma omp simd
+#endif
+  for (size_t i = 0; i < n; i++) {
+    y[i] = A_ * exp(B_ / x[i]);
+  }
+}
+
+void ExpInterpolate::derivative(const double * const x, double * const dy,
+                                size_t n) const
+{
+#ifdef USE_OMP
+#pragma omp simd
+#endif
+  for (size_t i = 0; i < n; i++) {
+    double xi = 1.0 / x[i];
+    dy[i] = -A_ * B_ * exp(B_ * xi) * xi * xi;
+  }
+}
+
 PowerLawInterpolate::PowerLawInterpolate(ParameterSet & params) :
     Interpolate(params),
     A_(params.get_parameter<double>("A")),
@@ -503,6 +752,30 @@ double PowerLawInterpolate::derivative(double x) const
   return A_ * B_ * std::pow(x, B_-1.0);
 }
 
+void PowerLawInterpolate::value(const double * const x, double * const y,
+                                size_t n) const
+{
+#ifdef USE_OMP
+#pragma omp simd
+#endif
+  for (size_t i = 0; i < n; i++) {
+    y[i] = A_ * std::pow(x[i], B_);
+  }
+}
+
+void PowerLawInterpolate::derivative(const double * const x, 
+                                     double * const dy, size_t n) const
+{
+  double C = A_ * B_;
+  double Bm1 = B_ - 1.0;
+#ifdef USE_OMP
+#pragma omp simd
+#endif
+  for (size_t i = 0; i < n; i++) {
+    dy[i] = C * std::pow(x[i], Bm1);
+  }
+}
+
 MTSShearInterpolate::MTSShearInterpolate(ParameterSet & params) :
     Interpolate(params),
     V0_(params.get_parameter<double>("V0")), 
@@ -543,6 +816,31 @@ double MTSShearInterpolate::derivative(double x) const
   return -D_ * T0_ / (4.0 * pow(x * sinh(T0_ / (2 * x)),2));
 }
 
+void MTSShearInterpolate::value(const double * const x, double * const y,
+                                size_t n) const
+{
+#ifdef USE_OMP
+#pragma omp simd
+#endif
+  for (size_t i = 0; i < n; i++) {
+    y[i] = V0_ - D_ / (exp(T0_ / x[i]) - 1.0);
+  }
+}
+
+void MTSShearInterpolate::derivative(const double * const x, 
+                                     double * const dy, size_t n) const
+{
+  // Uses 4 (x sinh(T0/2x))^2 = x^2 (e^(T0/x) - 2 + e^(-T0/x)) to 
+  // avoid the separate sinh evaluation
+#ifdef USE_OMP
+#pragma omp simd
+#endif
+  for (size_t i = 0; i < n; i++) {
+    double e = exp(T0_ / x[i]);
+    dy[i] = -D_ * T0_ * e / (x[i] * x[i] * (e - 1.0) * (e - 1.0));
+  }
+}
+
 
 MTSInterpolate::MTSInterpolate(ParameterSet & params) :
     Interpolate(params),
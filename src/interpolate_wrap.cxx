@@ -16,8 +16,32 @@ PYBIND11_MODULE(interpolate, m) {
   m.doc() = "Interpolation schemes used to define model parameters.";
   
   py::class_<Interpolate, NEMLObject, std::shared_ptr<Interpolate>>(m, "Interpolate")
-      .def("value", &Interpolate::value, "Interpolate to x")
-      .def("derivative", &Interpolate::derivative, "Derivative at x")
+      .def("value", (double (Interpolate::*)(double) const) &Interpolate::value,
+           "Interpolate to x")
+      .def("value",
+           [](Interpolate & m, py::array_t<double, py::array::c_style> x) -> py::array_t<double>
+           {
+            auto y = alloc_vec<double>(x.size());
+            m.value(arr2ptr<double>(x), arr2ptr<double>(y), x.size());
+            return y;
+           }, "Interpolate to an array of points")
+      .def("derivative", 
+           (double (Interpolate::*)(double) const) &Interpolate::derivative,
+           "Derivative at x")
+      .def("derivative",
+           [](Interpolate & m, py::array_t<double, py::array::c_style> x) -> py::array_t<double>
+           {
+            auto dy = alloc_vec<double>(x.size());
+            m.derivative(arr2ptr<double>(x), arr2ptr<double>(dy), x.size());
+            return dy;
+           }, "Derivative at an array of points")
+      .def("value_and_derivative",
+           [](Interpolate & m, double x) -> std::tuple<double, double>
+           {
+            double v, dv;
+            m.value_and_derivative(x, v, dv);
+            return std::make_tuple(v, dv);
+           }, "Value and derivative at x")
       .def("__call__", 
            [](Interpolate & m, double x) -> double
            {
@@ -118,6 +118,13 @@ SquareMatrix::SquareMatrix(ParameterSet & params) :
   }
 }
 
+SquareMatrix::SquareMatrix(ParameterSet & params, size_t m) :
+    NEMLObject(params),
+    Matrix(m, m)
+{
+  std::fill(data_, data_+size(), 0.0);
+}
+
 std::string SquareMatrix::type()
 {
   return "SquareMatrix";
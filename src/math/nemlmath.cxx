@@ -923,6 +923,34 @@ void solve_mat(const double * const A, int n, double * const x)
   if (info > 0) throw LinalgError("Matrix could not be inverted!");
 }
 
+void solve_mat_multiple(const double * const A, int n, double * const B,
+                        int m)
+{
+  // Row major A is the column major transpose, so factor it as is and
+  // do the transposed back substitution
+  int info;
+  std::vector<int> ipiv(n);
+  std::vector<double> LU(A, A+n*n);
+
+  dgetrf_(n, n, &LU[0], n, &ipiv[0], info);
+  if (info > 0) throw LinalgError("Matrix could not be inverted!");
+
+  std::vector<double> X(n*m);
+  for (int i=0; i<n; i++) {
+    for (int j=0; j<m; j++) {
+      X[CINDEX(j,i,n)] = B[CINDEX(i,j,m)];
+    }
+  }
+
+  dgetrs_("T", n, m, &LU[0], n, &ipiv[0], &X[0], n, info);
+
+  for (int i=0; i<n; i++) {
+    for (int j=0; j<m; j++) {
+      B[CINDEX(i,j,m)] = X[CINDEX(j,i,n)];
+    }
+  }
+}
+
 /*
  *  No error checking in this function, as it is assumed to be non-critical
  */
@@ -1124,6 +1152,86 @@ void rotate_matrix(int m, int n, const double * const A,
   delete [] temp;
 }
 
+void mandel_rotation(const double * const M, double * const R)
+{
+  const double f = sqrt(2.0);
+
+  // Rows and columns in Mandel order: 00, 11, 22, 12, 02, 01
+  const size_t a[6] = {0, 1, 2, 1, 0, 0};
+  const size_t b[6] = {0, 1, 2, 2, 2, 1};
+
+  for (size_t i = 0; i < 6; i++) {
+    const double * Mi = &M[3*a[i]];
+    const double * Mj = &M[3*b[i]];
+    for (size_t k = 0; k < 6; k++) {
+      double v;
+      if (i < 3 && k < 3) v = Mi[a[k]] * Mi[a[k]];
+      else if (i < 3) v = f * Mi[a[k]] * Mi[b[k]];
+      else if (k < 3) v = f * Mi[a[k]] * Mj[a[k]];
+      else v = Mi[a[k]] * Mj[b[k]] + Mi[b[k]] * Mj[a[k]];
+      R[CINDEX(i,k,6)] = v;
+    }
+  }
+}
+
+void rotate_mandel(const double * const R, const double * const A,
+                   double * const C)
+{
+  // Fixed trip counts so the compiler can unroll both products
+  double temp[36];
+
+  for (size_t i = 0; i < 6; i++) {
+    for (size_t j = 0; j < 6; j++) {
+      double v = 0.0;
+      for (size_t k = 0; k < 6; k++)
+        v += A[CINDEX(i,k,6)] * R[CINDEX(j,k,6)];
+      temp[CINDEX(i,j,6)] = v;
+    }
+  }
+
+  for (size_t i = 0; i < 6; i++) {
+    for (size_t j = 0; j < 6; j++) {
+      double v = 0.0;
+      for (size_t k = 0; k < 6; k++)
+        v += R[CINDEX(i,k,6)] * temp[CINDEX(k,j,6)];
+      C[CINDEX(i,j,6)] = v;
+    }
+  }
+}
+
+void rotate_fourth(const double * const M, const double * const A,
+                   double * const C)
+{
+  // One index at a time, 4 * 3^5 products instead of 3^8
+  double T1[81], T2[81];
+
+  // T1_mnol = A_mnop M_lp
+  for (size_t mno = 0; mno < 27; mno++)
+    for (size_t l = 0; l < 3; l++)
+      T1[mno*3+l] = A[mno*3+0] * M[3*l+0] + A[mno*3+1] * M[3*l+1] 
+          + A[mno*3+2] * M[3*l+2];
+
+  // T2_mnkl = M_ko T1_mnol
+  for (size_t mn = 0; mn < 9; mn++)
+    for (size_t k = 0; k < 3; k++)
+      for (size_t l = 0; l < 3; l++)
+        T2[mn*9+k*3+l] = M[3*k+0] * T1[mn*9+0*3+l] 
+            + M[3*k+1] * T1[mn*9+1*3+l] + M[3*k+2] * T1[mn*9+2*3+l];
+
+  // T1_mjkl = M_jn T2_mnkl
+  for (size_t m = 0; m < 3; m++)
+    for (size_t j = 0; j < 3; j++)
+      for (size_t kl = 0; kl < 9; kl++)
+        T1[m*27+j*9+kl] = M[3*j+0] * T2[m*27+0*9+kl]
+            + M[3*j+1] * T2[m*27+1*9+kl] + M[3*j+2] * T2[m*27+2*9+kl];
+
+  // C_ijkl = M_im T1_mjkl
+  for (size_t i = 0; i < 3; i++)
+    for (size_t jkl = 0; jkl < 27; jkl++)
+      C[i*27+jkl] = M[3*i+0] * T1[0*27+jkl] + M[3*i+1] * T1[1*27+jkl]
+          + M[3*i+2] * T1[2*27+jkl];
+}
+
 int fact(int n)
 {
   return (n == 1 || n == 0) ? 1 : fact(n - 1) * n;
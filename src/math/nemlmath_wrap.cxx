@@ -554,6 +554,28 @@ PYBIND11_MODULE(nemlmath, m) {
           return b;
         }, "Solve Ax=b.");
 
+   m.def("solve_mat_multiple",
+        [](py::array_t<double, py::array::c_style> A, py::array_t<double, py::array::c_style> B) -> py::array_t<double>
+        {
+          if (A.request().ndim != 2) {
+            throw LinalgError("A is not a matrix!");
+          }
+          if (A.request().shape[0] != A.request().shape[1]) {
+            throw LinalgError("A is not square!");
+          }
+          if (B.request().ndim != 2) {
+            throw LinalgError("B is not a matrix!");
+          }
+          if (A.request().shape[0] != B.request().shape[0]) {
+            throw LinalgError("A and B are not conformable!");
+          }
+
+          solve_mat_multiple(arr2ptr<double>(A), A.request().shape[0],
+                             arr2ptr<double>(B), B.request().shape[1]);
+
+          return B;
+        }, "Solve AX=B for several right hand sides.");
+
    m.def("condition",
         [](py::array_t<double, py::array::c_style> A) -> double
         {
@@ -638,23 +638,36 @@ void Orientation::to_axis_angle(double * const n, double & a,
   }
 }
 
-void Orientation::to_matrix(double * const M) const
+// Rotation matrix of a unit quaternion, shared with the batch kernels
+static void quat_to_matrix(const double * const q, double * const M)
 {
-  double v1s = quat_[1] * quat_[1];
-  double v2s = quat_[2] * quat_[2];
-  double v3s = quat_[3] * quat_[3];
+  double v1s = q[1] * q[1];
+  double v2s = q[2] * q[2];
+  double v3s = q[3] * q[3];
 
   M[0] = 1-2*v2s - 2*v3s;
-  M[1] = 2*(quat_[1]*quat_[2] - quat_[3]*quat_[0]);
-  M[2] = 2*(quat_[1]*quat_[3] + quat_[2]*quat_[0]);
-  M[3] = 2*(quat_[1]*quat_[2] + quat_[3]*quat_[0]);
+  M[1] = 2*(q[1]*q[2] - q[3]*q[0]);
+  M[2] = 2*(q[1]*q[3] + q[2]*q[0]);
+  M[3] = 2*(q[1]*q[2] + q[3]*q[0]);
   M[4] = 1-2*v1s - 2*v3s;
-  M[5] = 2*(quat_[2]*quat_[3] - quat_[1]*quat_[0]);
-  M[6] = 2*(quat_[1]*quat_[3] - quat_[2]*quat_[0]);
-  M[7] = 2*(quat_[2]*quat_[3] + quat_[1]*quat_[0]);
+  M[5] = 2*(q[2]*q[3] - q[1]*q[0]);
+  M[6] = 2*(q[1]*q[3] - q[2]*q[0]);
+  M[7] = 2*(q[2]*q[3] + q[1]*q[0]);
   M[8] = 1-2*v1s-2*v2s;
 }
 
+void Orientation::to_matrix(double * const M) const
+{
+  quat_to_matrix(quat_, M);
+}
+
+void Orientation::to_mandel(double * const R) const
+{
+  double M[9];
+  to_matrix(M);
+  mandel_rotation(M, R);
+}
+
 RankTwo Orientation::to_tensor() const
 {
   RankTwo res;
@@ -923,42 +936,22 @@ Skew Orientation::apply(const Skew & a) const
 
 RankFour Orientation::apply(const RankFour & a) const
 {
-  RankTwo Q = to_tensor();
+  double M[9];
+  to_matrix(M);
 
   RankFour res;
-  for (size_t i = 0; i<3; i++) {
-    for (size_t j = 0; j<3; j++) {
-      for (size_t k = 0; k<3; k++) {
-        for (size_t l = 0; l<3; l++) {
-          for (size_t m = 0; m<3; m++) {
-            for (size_t n = 0; n<3; n++) {
-              for (size_t o = 0; o<3; o++) {
-                for (size_t p = 0; p<3; p++) {
-                  res(i,j,k,l) += Q(i,m) * Q(j,n) * Q(k,o) * Q(l,p) * a(m,n,o,p);
-                }
-              }
-            }
-          }
-        }
-      }
-    }
-  }
+  rotate_fourth(M, a.data(), res.s());
+
   return res;
 }
 
 SymSymR4 Orientation::apply(const SymSymR4 & a) const
 {
-  SymSymR4 res;
+  double R[36];
+  to_mandel(R);
 
-  double M[9];
-  to_matrix(M);
-
-  const double f1 = 1.0;
-  const double f2 = sqrt(2.0);
-  const double f3 = sqrt(2.0);
-  double R[36] = {f1*M[0]*M[0],f1*M[1]*M[1],f1*M[2]*M[2],f3*M[1]*M[2],f3*M[2]*M[0],f3*M[0]*M[1],f1*M[3]*M[3],f1*M[4]*M[4],f1*M[5]*M[5],f3*M[4]*M[5],f3*M[5]*M[3],f3*M[3]*M[4],f1*M[6]*M[6],f1*M[7]*M[7],f1*M[8]*M[8],f3*M[7]*M[8],f3*M[8]*M[6],f3*M[6]*M[7],f2*M[3]*M[6],f2*M[4]*M[7],f2*M[5]*M[8],(M[4]*M[8]+M[5]*M[7]),(M[5]*M[6]+M[3]*M[8]),(M[3]*M[7]+M[4]*M[6]),f2*M[6]*M[0],f2*M[7]*M[1],f2*M[8]*M[2],(M[7]*M[2]+M[8]*M[1]),(M[8]*M[0]+M[6]*M[2]),(M[6]*M[1]+M[7]*M[0]),f2*M[0]*M[3],f2*M[1]*M[4],f2*M[2]*M[5],(M[1]*M[5]+M[2]*M[4]),(M[2]*M[3]+M[0]*M[5]),(M[0]*M[4]+M[1]*M[3])};
-
-  rotate_matrix(6, 6, R, a.data(), res.s());
+  SymSymR4 res;
+  rotate_mandel(R, a.data(), res.s());
 
   return res;
 }
@@ -972,25 +965,14 @@ double Orientation::distance(const Orientation & other) const
 
 std::vector<CrystalOrientation> random_orientations(int n)
 {
-  double u[3];
-  double w, x, y, z;
-  std::vector<CrystalOrientation> result;
-
-  std::random_device rdev{};
-  std::default_random_engine generator{rdev()};
-  std::uniform_real_distribution<double> distribution(0.0,1.0);
+  std::vector<double> q(4*n);
+  random_orientations_batch(n, &q[0]);
 
+  std::vector<CrystalOrientation> result;
+  result.reserve(n);
   for (int i=0; i<n; i++) {
-    for (int j=0; j<3; j++) {
-      u[j] = distribution(generator);
-    }
-
-    w = sqrt(1.0-u[0]) * sin(2.0 * M_PI * u[1]);
-    x = sqrt(1.0-u[0]) * cos(2.0 * M_PI * u[1]);
-    y = sqrt(u[0]) * sin(2.0 * M_PI * u[2]);
-    z = sqrt(u[0]) * cos(2.0 * M_PI * u[2]);
-
-    result.emplace_back(make_crystal_orientation(Orientation({w,x,y,z})));
+    result.emplace_back(make_crystal_orientation(
+            Orientation(std::vector<double>(&q[4*i], &q[4*i]+4))));
   }
 
   return result;
@@ -1000,8 +982,9 @@ Orientation wexp(const Skew & w)
 {
   const double * wv = w.data();
   double x = norm2_vec(wv, 3);
+  // The identity, which is not the default Orientation
   if (x == 0.0) {
-    return Orientation();
+    return Orientation({1.0, 0.0, 0.0, 0.0});
   }
   double f = sin(x/2.0)/x;
   return Orientation({cos(x/2.0), f * wv[0], f * wv[1], f * wv[2]});
@@ -1099,4 +1082,242 @@ CrystalOrientation make_crystal_orientation(const Orientation & o)
   return CrystalOrientation(params);
 }
 
+void random_orientations_batch(size_t n, double * const q)
+{
+  std::random_device rdev{};
+  std::default_random_engine generator{rdev()};
+  std::uniform_real_distribution<double> distribution(0.0,1.0);
+
+  std::vector<double> u(3*n);
+  for (size_t i = 0; i < 3*n; i++) {
+    u[i] = distribution(generator);
+  }
+
+#ifdef USE_OMP
+#pragma omp simd
+#endif
+  for (size_t i = 0; i < n; i++) {
+    double a = sqrt(1.0-u[3*i]);
+    double b = sqrt(u[3*i]);
+    q[4*i+0] = a * sin(2.0 * M_PI * u[3*i+1]);
+    q[4*i+1] = a * cos(2.0 * M_PI * u[3*i+1]);
+    q[4*i+2] = b * sin(2.0 * M_PI * u[3*i+2]);
+    q[4*i+3] = b * cos(2.0 * M_PI * u[3*i+2]);
+  }
+}
+
+void quat_multiply_batch(size_t n, const double * const a,
+                         const double * const b, double * const c)
+{
+#ifdef USE_OMP
+#pragma omp simd
+#endif
+  for (size_t i = 0; i < n; i++) {
+    const double * x = &a[4*i];
+    const double * y = &b[4*i];
+    double c0 = x[0]*y[0] - (x[1]*y[1] + x[2]*y[2] + x[3]*y[3]);
+    double c1 = x[0]*y[1] + x[1]*y[0] + x[2]*y[3] - x[3]*y[2];
+    double c2 = x[0]*y[2] + x[2]*y[0] + x[3]*y[1] - x[1]*y[3];
+    double c3 = x[0]*y[3] + x[3]*y[0] + x[1]*y[2] - x[2]*y[1];
+    c[4*i+0] = c0;
+    c[4*i+1] = c1;
+    c[4*i+2] = c2;
+    c[4*i+3] = c3;
+  }
+}
+
+void quat_conj_batch(size_t n, const double * const a, double * const c)
+{
+#ifdef USE_OMP
+#pragma omp simd
+#endif
+  for (size_t i = 0; i < n; i++) {
+    double c0 = a[4*i+0];
+    double c1 = -a[4*i+1];
+    double c2 = -a[4*i+2];
+    double c3 = -a[4*i+3];
+    c[4*i+0] = c0;
+    c[4*i+1] = c1;
+    c[4*i+2] = c2;
+    c[4*i+3] = c3;
+  }
+}
+
+void quat_inverse_batch(size_t n, const double * const a, double * const c)
+{
+#ifdef USE_OMP
+#pragma omp simd
+#endif
+  for (size_t i = 0; i < n; i++) {
+    const double * x = &a[4*i];
+    double ns = sqrt(x[0]*x[0] + x[1]*x[1] + x[2]*x[2] + x[3]*x[3]);
+    ns *= ns;
+    double c0 = x[0] / ns;
+    double c1 = -x[1] / ns;
+    double c2 = -x[2] / ns;
+    double c3 = -x[3] / ns;
+    c[4*i+0] = c0;
+    c[4*i+1] = c1;
+    c[4*i+2] = c2;
+    c[4*i+3] = c3;
+  }
+}
+
+void quat_exp_batch(size_t n, const double * const a, double * const c)
+{
+#ifdef USE_OMP
+#pragma omp simd
+#endif
+  for (size_t i = 0; i < n; i++) {
+    const double * x = &a[4*i];
+    double nv = sqrt(x[1]*x[1] + x[2]*x[2] + x[3]*x[3]);
+    double sf = sin(nv) / nv;
+    double c1 = x[1] * sf;
+    double c2 = x[2] * sf;
+    double c3 = x[3] * sf;
+    c[4*i+0] = cos(nv);
+    c[4*i+1] = c1;
+    c[4*i+2] = c2;
+    c[4*i+3] = c3;
+  }
+}
+
+void quat_log_batch(size_t n, const double * const a, double * const c)
+{
+#ifdef USE_OMP
+#pragma omp simd
+#endif
+  for (size_t i = 0; i < n; i++) {
+    const double * x = &a[4*i];
+    double nq = sqrt(x[0]*x[0] + x[1]*x[1] + x[2]*x[2] + x[3]*x[3]);
+    double nv = sqrt(x[1]*x[1] + x[2]*x[2] + x[3]*x[3]);
+    double sf = acos(x[0] / nq);
+    double c0 = ::log(nq);
+    double c1 = x[1] / nv * sf;
+    double c2 = x[2] / nv * sf;
+    double c3 = x[3] / nv * sf;
+    c[4*i+0] = c0;
+    c[4*i+1] = c1;
+    c[4*i+2] = c2;
+    c[4*i+3] = c3;
+  }
+}
+
+void quat_apply_vector_batch(size_t n, const double * const q,
+                             const double * const v, double * const res)
+{
+  // v + 2 u x (u x v + s v), the expanded form of q (0,v) q^*
+#ifdef USE_OMP
+#pragma omp simd
+#endif
+  for (size_t i = 0; i < n; i++) {
+    const double * x = &q[4*i];
+    const double * y = &v[3*i];
+    double t0 = x[2]*y[2] - x[3]*y[1] + x[0]*y[0];
+    double t1 = x[3]*y[0] - x[1]*y[2] + x[0]*y[1];
+    double t2 = x[1]*y[1] - x[2]*y[0] + x[0]*y[2];
+    double r0 = y[0] + 2.0 * (x[2]*t2 - x[3]*t1);
+    double r1 = y[1] + 2.0 * (x[3]*t0 - x[1]*t2);
+    double r2 = y[2] + 2.0 * (x[1]*t1 - x[2]*t0);
+    res[3*i+0] = r0;
+    res[3*i+1] = r1;
+    res[3*i+2] = r2;
+  }
+}
+
+void quat_apply_symmetric_batch(size_t n, const double * const q,
+                                const double * const s, double * const res)
+{
+  double M[9];
+  double R[36];
+  for (size_t i = 0; i < n; i++) {
+    quat_to_matrix(&q[4*i], M);
+    mandel_rotation(M, R);
+    for (size_t j = 0; j < 6; j++) {
+      double v = 0.0;
+      for (size_t k = 0; k < 6; k++)
+        v += R[CINDEX(j,k,6)] * s[6*i+k];
+      res[6*i+j] = v;
+    }
+  }
+}
+
+void wexp_batch(size_t n, const double * const w, double * const q)
+{
+  for (size_t i = 0; i < n; i++) {
+    const double * wv = &w[3*i];
+    double * qv = &q[4*i];
+    double x = norm2_vec(wv, 3);
+    // The identity, as in wexp
+    if (x == 0.0) {
+      qv[0] = 1.0;
+      qv[1] = 0.0;
+      qv[2] = 0.0;
+      qv[3] = 0.0;
+      continue;
+    }
+    double f = sin(x/2.0)/x;
+    qv[0] = cos(x/2.0);
+    qv[1] = f * wv[0];
+    qv[2] = f * wv[1];
+    qv[3] = f * wv[2];
+    // Same normalization as the Orientation constructor
+    double nv = sqrt(qv[0]*qv[0] + qv[1]*qv[1] + qv[2]*qv[2] + qv[3]*qv[3]);
+    for (size_t j = 0; j < 4; j++) qv[j] /= nv;
+  }
+}
+
+void wlog_batch(size_t n, const double * const q, double * const w)
+{
+#ifdef USE_OMP
+#pragma omp simd
+#endif
+  for (size_t i = 0; i < n; i++) {
+    const double * x = &q[4*i];
+    double nq = sqrt(x[0]*x[0] + x[1]*x[1] + x[2]*x[2] + x[3]*x[3]);
+    double nv = sqrt(x[1]*x[1] + x[2]*x[2] + x[3]*x[3]);
+    double f = 2.0 * acos(x[0] / nq) / nv;
+    w[3*i+0] = f * x[1];
+    w[3*i+1] = f * x[2];
+    w[3*i+2] = f * x[3];
+  }
+}
+
+void distance_batch(size_t n, const double * const a, const double * const b,
+                    double * const d)
+{
+#ifdef USE_OMP
+#pragma omp simd
+#endif
+  for (size_t i = 0; i < n; i++) {
+    const double * x = &a[4*i];
+    const double * y = &b[4*i];
+    double v = fabs(x[0]*y[0] + x[1]*y[1] + x[2]*y[2] + x[3]*y[3]);
+    if (v > 1.0) v = 1.0;
+    d[i] = acos(v);
+  }
+}
+
+void rotate_symsym_batch(size_t n, const double * const q,
+                         const double * const A, double * const C)
+{
+  double M[9];
+  double R[36];
+  for (size_t i = 0; i < n; i++) {
+    quat_to_matrix(&q[4*i], M);
+    mandel_rotation(M, R);
+    rotate_mandel(R, A, &C[36*i]);
+  }
+}
+
+void rotate_fourth_batch(size_t n, const double * const q,
+                         const double * const A, double * const C)
+{
+  double M[9];
+  for (size_t i = 0; i < n; i++) {
+    quat_to_matrix(&q[4*i], M);
+    rotate_fourth(M, A, &C[81*i]);
+  }
+}
+
 } // namespace neml
@@ -12,6 +12,25 @@ PYBIND11_DECLARE_HOLDER_TYPE(T, std::shared_ptr<T>)
 
 namespace neml {
 
+// Number of quaternions in an n x 4 array
+static size_t nquats(py::array_t<double, py::array::c_style> q)
+{
+  if ((q.request().ndim != 2) || (q.request().shape[1] != 4)) {
+    throw std::invalid_argument("Quaternions must be an n x 4 array");
+  }
+  return q.request().shape[0];
+}
+
+// Check an array holds n entries of size m
+static void check_batch(py::array_t<double, py::array::c_style> a, size_t n,
+                        size_t m)
+{
+  if ((a.request().ndim != 2) || ((size_t) a.request().shape[0] != n) ||
+      ((size_t) a.request().shape[1] != m)) {
+    throw std::invalid_argument("Batch input does not match the quaternions");
+  }
+}
+
 PYBIND11_MODULE(rotations, m) {
   py::module::import("neml.objects");
 
@@ -160,6 +179,13 @@ PYBIND11_MODULE(rotations, m) {
             std::copy(M, M+9, p);
             return Mn;
            }, "Convert to a rotation matrix")
+      .def("to_mandel",
+           [](Orientation & me) -> py::array_t<double>
+           {
+            auto R = alloc_mat<double>(6,6);
+            me.to_mandel(arr2ptr<double>(R));
+            return R;
+           }, "Convert to the rotation matrix for Mandel vectors")
       .def("to_tensor", &Orientation::to_tensor)
       .def("to_rodrigues",
            [](Orientation & me) -> py::array_t<double>
@@ -257,6 +283,136 @@ PYBIND11_MODULE(rotations, m) {
   m.def("distance", &distance);
   m.def("rotate_to", &rotate_to);
   m.def("rotate_to_family", &rotate_to_family);
+  m.def("random_orientations_batch",
+        [](size_t n) -> py::array_t<double>
+        {
+          auto q = alloc_mat<double>(n, 4);
+          random_orientations_batch(n, arr2ptr<double>(q));
+          return q;
+        }, "Random orientations as an n x 4 array");
+  m.def("quat_multiply_batch",
+        [](py::array_t<double, py::array::c_style> a,
+           py::array_t<double, py::array::c_style> b) -> py::array_t<double>
+        {
+          size_t n = nquats(a);
+          check_batch(b, n, 4);
+          auto c = alloc_mat<double>(n, 4);
+          quat_multiply_batch(n, arr2ptr<double>(a), arr2ptr<double>(b),
+                              arr2ptr<double>(c));
+          return c;
+        }, "Entrywise quaternion product");
+  m.def("quat_conj_batch",
+        [](py::array_t<double, py::array::c_style> a) -> py::array_t<double>
+        {
+          size_t n = nquats(a);
+          auto c = alloc_mat<double>(n, 4);
+          quat_conj_batch(n, arr2ptr<double>(a), arr2ptr<double>(c));
+          return c;
+        }, "Entrywise quaternion conjugate");
+  m.def("quat_inverse_batch",
+        [](py::array_t<double, py::array::c_style> a) -> py::array_t<double>
+        {
+          size_t n = nquats(a);
+          auto c = alloc_mat<double>(n, 4);
+          quat_inverse_batch(n, arr2ptr<double>(a), arr2ptr<double>(c));
+          return c;
+        }, "Entrywise quaternion inverse");
+  m.def("quat_exp_batch",
+        [](py::array_t<double, py::array::c_style> a) -> py::array_t<double>
+        {
+          size_t n = nquats(a);
+          auto c = alloc_mat<double>(n, 4);
+          quat_exp_batch(n, arr2ptr<double>(a), arr2ptr<double>(c));
+          return c;
+        }, "Entrywise quaternion exponential");
+  m.def("quat_log_batch",
+        [](py::array_t<double, py::array::c_style> a) -> py::array_t<double>
+        {
+          size_t n = nquats(a);
+          auto c = alloc_mat<double>(n, 4);
+          quat_log_batch(n, arr2ptr<double>(a), arr2ptr<double>(c));
+          return c;
+        }, "Entrywise quaternion logarithm");
+  m.def("quat_apply_vector_batch",
+        [](py::array_t<double, py::array::c_style> q,
+           py::array_t<double, py::array::c_style> v) -> py::array_t<double>
+        {
+          size_t n = nquats(q);
+          check_batch(v, n, 3);
+          auto res = alloc_mat<double>(n, 3);
+          quat_apply_vector_batch(n, arr2ptr<double>(q), arr2ptr<double>(v),
+                                  arr2ptr<double>(res));
+          return res;
+        }, "Rotate an n x 3 array of vectors");
+  m.def("quat_apply_symmetric_batch",
+        [](py::array_t<double, py::array::c_style> q,
+           py::array_t<double, py::array::c_style> s) -> py::array_t<double>
+        {
+          size_t n = nquats(q);
+          check_batch(s, n, 6);
+          auto res = alloc_mat<double>(n, 6);
+          quat_apply_symmetric_batch(n, arr2ptr<double>(q),
+                                     arr2ptr<double>(s),
+                                     arr2ptr<double>(res));
+          return res;
+        }, "Rotate an n x 6 array of Mandel symmetric tensors");
+  m.def("wexp_batch",
+        [](py::array_t<double, py::array::c_style> w) -> py::array_t<double>
+        {
+          if ((w.request().ndim != 2) || (w.request().shape[1] != 3)) {
+            throw std::invalid_argument("Spins must be an n x 3 array");
+          }
+          size_t n = w.request().shape[0];
+          auto q = alloc_mat<double>(n, 4);
+          wexp_batch(n, arr2ptr<double>(w), arr2ptr<double>(q));
+          return q;
+        }, "Exponential map of an n x 3 array of skew tensors");
+  m.def("wlog_batch",
+        [](py::array_t<double, py::array::c_style> q) -> py::array_t<double>
+        {
+          size_t n = nquats(q);
+          auto w = alloc_mat<double>(n, 3);
+          wlog_batch(n, arr2ptr<double>(q), arr2ptr<double>(w));
+          return w;
+        }, "Inverse exponential map to an n x 3 array of skew tensors");
+  m.def("distance_batch",
+        [](py::array_t<double, py::array::c_style> a,
+           py::array_t<double, py::array::c_style> b) -> py::array_t<double>
+        {
+          size_t n = nquats(a);
+          check_batch(b, n, 4);
+          auto d = alloc_vec<double>(n);
+          distance_batch(n, arr2ptr<double>(a), arr2ptr<double>(b),
+                         arr2ptr<double>(d));
+          return d;
+        }, "Entrywise geodesic distance");
+  m.def("rotate_symsym_batch",
+        [](py::array_t<double, py::array::c_style> q,
+           py::array_t<double, py::array::c_style> A) -> py::array_t<double>
+        {
+          size_t n = nquats(q);
+          if ((A.request().ndim != 2) || (A.request().shape[0] != 6) ||
+              (A.request().shape[1] != 6)) {
+            throw std::invalid_argument("A must be a 6x6 Mandel matrix");
+          }
+          auto C = alloc_3d<double>(n, 6, 6);
+          rotate_symsym_batch(n, arr2ptr<double>(q), arr2ptr<double>(A),
+                              arr2ptr<double>(C));
+          return C;
+        }, "Rotate a 6x6 Mandel matrix by an array of quaternions");
+  m.def("rotate_fourth_batch",
+        [](py::array_t<double, py::array::c_style> q,
+           py::array_t<double, py::array::c_style> A) -> py::array_t<double>
+        {
+          size_t n = nquats(q);
+          if ((A.request().ndim != 4) || (A.request().size != 81)) {
+            throw std::invalid_argument("A must be a 3x3x3x3 tensor");
+          }
+          auto C = alloc_tensor<double>({n, 3, 3, 3, 3});
+          rotate_fourth_batch(n, arr2ptr<double>(q), arr2ptr<double>(A),
+                              arr2ptr<double>(C));
+          return C;
+        }, "Rotate a full fourth order tensor by an array of quaternions");
 } // PYBIND11_MODULE(cpfmwk, m)
 
 } // namespace cpfmwk
@@ -25,6 +25,14 @@ void NEMLModel::save(std::string file_name, std::string model_name)
   outfile.close();
 }
 
+void NEMLModel::alpha(const double * const T, double * const a,
+                      size_t n) const
+{
+  for (size_t i = 0; i < n; i++) {
+    a[i] = alpha(T[i]);
+  }
+}
+
 // NEMLModel_sd implementation
 NEMLModel_sd::NEMLModel_sd(ParameterSet & params) :
       NEMLModel(params), 
@@ -60,14 +68,18 @@ void NEMLModel_sd::update_ld_inc(
     std::fill(D, D+6, 0.0);
   }
   
+  bool tangent = (A_np1 != nullptr);
+
   update_sd(d_np1, d_n, T_np1, T_n, t_np1, t_n, &h_np1[nhist()], &h_n[nhist()],
-                   &h_np1[0], &h_n[0], base_A_np1, u_np1, u_n, p_np1, p_n);
+                   &h_np1[0], &h_n[0], tangent ? base_A_np1 : nullptr,
+                   u_np1, u_n, p_np1, p_n);
 
   sub_vec(&h_np1[nhist()], &h_n[nhist()], 6, dS);  
  
   truesdell_update_sym(D, W, s_n, dS, s_np1);
 
-  calc_tangent_(D, W, base_A_np1, s_np1, A_np1, B_np1);
+  if (tangent)
+    calc_tangent_(D, W, base_A_np1, s_np1, A_np1, B_np1);
 
 }
 
@@ -87,6 +99,12 @@ double NEMLModel_sd::alpha(double T) const
   return alpha_->value(T);
 }
 
+void NEMLModel_sd::alpha(const double * const T, double * const a,
+                         size_t n) const
+{
+  alpha_->value(T, a, n);
+}
+
 const std::shared_ptr<const LinearElasticModel> NEMLModel_sd::elastic() const
 {
   return elastic_;
@@ -165,7 +183,8 @@ void NEMLModel_ldi::update_sd(
   double W[3] = {0,0,0};
   double B[18];
   update_ld_inc(e_np1, e_n, W, W, T_np1, T_n, t_np1, t_n,
-                       s_np1, s_n, h_np1, h_n, A_np1, B, u_np1, u_n,
+                       s_np1, s_n, h_np1, h_n, A_np1,
+                       (A_np1 == nullptr) ? nullptr : B, u_np1, u_n,
                        p_np1, p_n);
 }
 
@@ -231,13 +250,19 @@ void SubstepModel_sd::update_sd(
   double T_next;
   double t_next;
   
-  // Storage for the local A matrix
-  double * A_inc = new double[nparams() * nparams()];
-  double * A_old = new double[nparams() * 6];
-  double * A_new = new double[nparams() * 6];
-  double * E_inc = new double[nparams() * 6];
-
-  std::fill(A_old, A_old+(nparams()*6), 0.0);
+  // Storage for the local A matrix, only if the caller wants the tangent
+  bool tangent = (A_np1 != nullptr);
+  double * A_inc = nullptr;
+  double * A_old = nullptr;
+  double * A_new = nullptr;
+  double * E_inc = nullptr;
+  if (tangent) {
+    A_inc = new double[nparams() * nparams()];
+    A_old = new double[nparams() * 6];
+    A_new = new double[nparams() * 6];
+    E_inc = new double[nparams() * 6];
+    std::fill(A_old, A_old+(nparams()*6), 0.0);
+  }
 
   while (cs < tf) {
     // targets
@@ -271,17 +296,19 @@ void SubstepModel_sd::update_sd(
     }
 
     // Tangent
-    for (size_t i = 0; i < nparams()*6; i++) {
-      A_old[i] += E_inc[i] * sf;
+    if (tangent) {
+      for (size_t i = 0; i < nparams()*6; i++) {
+        A_old[i] += E_inc[i] * sf;
+      }
+      mat_mat(nparams(), 6, nparams(), A_inc, A_old, A_new);
+      std::copy(A_new, A_new+(nparams()*6), A_old);
     }
-    mat_mat(nparams(), 6, nparams(), A_inc, A_old, A_new);
    
     // Succeeded: advance subincrement
     cs += cm;
     std::copy(e_next, e_next+6, e_past);
     std::copy(s_np1, s_np1+6, s_past);
     std::copy(h_np1, h_np1+nhist(), h_past);
-    std::copy(A_new, A_new+(nparams()*6), A_old);
 
     T_past = T_next;
     t_past = t_next;
@@ -290,9 +317,11 @@ void SubstepModel_sd::update_sd(
   }
 
   // Extract the leading 6x6 part of the A matrix
-  for (size_t i = 0; i < 6; i++) {
-    for (size_t j = 0; j < 6; j++) {
-      A_np1[CINDEX(i,j,6)] = A_new[CINDEX(i,j,6)];
+  if (tangent) {
+    for (size_t i = 0; i < 6; i++) {
+      for (size_t j = 0; j < 6; j++) {
+        A_np1[CINDEX(i,j,6)] = A_new[CINDEX(i,j,6)];
+      }
     }
   }
 
@@ -330,19 +359,21 @@ void SubstepModel_sd::update_step(
     // History
     std::copy(h_n, h_n+nhist(), h_np1);
     // Jacobian for substepping
-    std::fill(A, A+(nparams()*nparams()), 0.0);
-    for (size_t i = 0; i < 6; i++) A[CINDEX(i,i,nparams())] = 1.0;
-
-    std::fill(E, E+(nparams()*6), 0.0);
-    for (size_t i = 0; i < 6; i++) {
-      for (size_t j = 0; j < 6; j++) {
-        E[CINDEX(i,j,6)] = C[CINDEX(i,j,6)];
+    if (A != nullptr) {
+      std::fill(A, A+(nparams()*nparams()), 0.0);
+      for (size_t i = 0; i < 6; i++) A[CINDEX(i,i,nparams())] = 1.0;
+
+      std::fill(E, E+(nparams()*6), 0.0);
+      for (size_t i = 0; i < 6; i++) {
+        for (size_t j = 0; j < 6; j++) {
+          E[CINDEX(i,j,6)] = C[CINDEX(i,j,6)];
+        }
       }
     }
 
     // Energy and work
     work_and_energy(ts, e_np1, e_n, T_np1, T_n, t_np1, t_n, s_np1, s_n,
-                    h_np1, h_n, u_np1, u_n, p_np1, p_n); 
+                    h_np1, h_n, u_np1, u_n, p_np1, p_n);
     delete ts;
 
     return;
@@ -355,14 +386,15 @@ void SubstepModel_sd::update_step(
                     nullptr, A); // Keep jacobian
 
     // Invert the Jacobian (or idk, could go in the tangent calc)
-    invert_mat(A, nparams());
+    if (A != nullptr) invert_jacobian(A, ts);
 
     // Interpret the x vector as the updated state
     update_internal(x, e_np1, e_n, T_np1, T_n, t_np1, t_n,
                           s_np1, s_n, h_np1, h_n);
 
     // Get the dE matrix
-    strain_partial(ts, e_np1, e_n, T_np1, T_n, t_np1, t_n, s_np1, s_n, h_np1, h_n, E);
+    if (E != nullptr)
+      strain_partial(ts, e_np1, e_n, T_np1, T_n, t_np1, t_n, s_np1, s_n, h_np1, h_n, E);
 
     // Update the work and energy
     work_and_energy(ts, e_np1, e_n, T_np1, T_n, t_np1, t_n, 
@@ -379,6 +411,11 @@ void SubstepModel_sd::update_step(
   delete ts;
 }
 
+void SubstepModel_sd::invert_jacobian(double * const A, TrialState * ts)
+{
+  invert_mat(A, nparams());
+}
+
 // Implementation of small strain elasticity
 SmallStrainElasticity::SmallStrainElasticity(ParameterSet & params) :
     NEMLModel_sd(params)
@@ -428,8 +465,10 @@ void SmallStrainElasticity::update_sd(
        double & u_np1, double u_n,
        double & p_np1, double p_n)
 {
-  elastic_->C(T_np1, A_np1);
-  mat_vec(A_np1, 6, e_np1, 6, s_np1);
+  double C[36];
+  elastic_->C(T_np1, C);
+  mat_vec(C, 6, e_np1, 6, s_np1);
+  if (A_np1 != nullptr) std::copy(C, C+36, A_np1);
 
   // Energy calculation (trapezoid rule)
   double de[6];
@@ -682,9 +721,11 @@ void SmallStrainPerfectPlasticity::make_trial_state(
 SmallStrainRateIndependentPlasticity::SmallStrainRateIndependentPlasticity(
     ParameterSet & params) : 
       SubstepModel_sd(params),
-      flow_(params.get_object_parameter<RateIndependentFlowRule>("flow"))
+      flow_(params.get_object_parameter<RateIndependentFlowRule>("flow")),
+      use_radial_return_(params.get_parameter<bool>("radial_return")),
+      radial_return_(false)
 {
-
+  setup_radial_return_();
 }
 
 std::string SmallStrainRateIndependentPlasticity::type()
@@ -712,6 +753,7 @@ ParameterSet SmallStrainRateIndependentPlasticity::parameters()
   pset.add_optional_parameter<int>("max_divide", 4);
   pset.add_optional_parameter<bool>("force_divide", false);
 
+  pset.add_optional_parameter<bool>("radial_return", true);
 
   return pset;
 }
@@ -731,6 +773,27 @@ void SmallStrainRateIndependentPlasticity::init_hist(double * const hist) const
   flow_->init_hist(hist);
 }
 
+void SmallStrainRateIndependentPlasticity::update_step(
+    const double * const e_np1, const double * const e_n,
+    double T_np1, double T_n,
+    double t_np1, double t_n,
+    double * const s_np1, const double * const s_n,
+    double * const h_np1, const double * const h_n,
+    double * const A, double * const E,
+    double & u_np1, double u_n,
+    double & p_np1, double p_n)
+{
+  if (radial_return_) {
+    radial_return_step_(e_np1, e_n, T_np1, T_n, t_np1, t_n, s_np1, s_n,
+                        h_np1, h_n, A, E, u_np1, u_n, p_np1, p_n);
+  }
+  else {
+    SubstepModel_sd::update_step(e_np1, e_n, T_np1, T_n, t_np1, t_n, s_np1,
+                                 s_n, h_np1, h_n, A, E, u_np1, u_n, p_np1,
+                                 p_n);
+  }
+}
+
 TrialState * SmallStrainRateIndependentPlasticity::setup(
     const double * const e_np1, const double * const e_n,
     double T_np1, double T_n,
@@ -993,6 +1056,222 @@ void SmallStrainRateIndependentPlasticity::make_trial_state(
   ts.T = T_np1;
 }
 
+void SmallStrainRateIndependentPlasticity::set_elastic_model(
+    std::shared_ptr<LinearElasticModel> emodel)
+{
+  NEMLModel_sd::set_elastic_model(emodel);
+  setup_radial_return_();
+}
+
+bool SmallStrainRateIndependentPlasticity::radial_return() const
+{
+  return radial_return_;
+}
+
+void SmallStrainRateIndependentPlasticity::setup_radial_return_()
+{
+  radial_return_ = false;
+  linear_iso_ = nullptr;
+  voce_iso_ = nullptr;
+  linear_kin_ = nullptr;
+
+  if (not use_radial_return_) return;
+
+  // Radial return needs C n = 2 G n for any deviatoric n
+  if (not std::dynamic_pointer_cast<IsotropicLinearElasticModel>(elastic_))
+    return;
+
+  auto flow = std::dynamic_pointer_cast<RateIndependentAssociativeFlow>(flow_);
+  if (not flow) return;
+
+  // Unpack the hardening into the isotropic and kinematic parts
+  std::shared_ptr<const HardeningRule> iso;
+  if (std::dynamic_pointer_cast<const IsoJ2>(flow->surface())) {
+    iso = flow->hardening();
+  }
+  else if (std::dynamic_pointer_cast<const IsoKinJ2>(flow->surface())) {
+    auto comb = std::dynamic_pointer_cast<const CombinedHardeningRule>(
+        flow->hardening());
+    if (not comb) return;
+    iso = comb->iso();
+    linear_kin_ = std::dynamic_pointer_cast<const LinearKinematicHardeningRule>(
+        comb->kin());
+    if (not linear_kin_) return;
+  }
+  else {
+    return;
+  }
+
+  linear_iso_ = std::dynamic_pointer_cast<const LinearIsotropicHardeningRule>(
+      iso);
+  voce_iso_ = std::dynamic_pointer_cast<const VoceIsotropicHardeningRule>(iso);
+
+  radial_return_ = linear_iso_ || voce_iso_;
+}
+
+void SmallStrainRateIndependentPlasticity::radial_return_step_(
+    const double * const e_np1, const double * const e_n,
+    double T_np1, double T_n,
+    double t_np1, double t_n,
+    double * const s_np1, const double * const s_n,
+    double * const h_np1, const double * const h_n,
+    double * const A, double * const E,
+    double & u_np1, double u_n,
+    double & p_np1, double p_n)
+{
+  SSRIPTrialState ts;
+  make_trial_state(e_np1, e_n, T_np1, T_n, t_np1, t_n, s_n, h_n, ts);
+
+  size_t n = nparams();
+  bool kin = (bool) linear_kin_;
+  double G2 = ts.C[CINDEX(3,3,6)]; // 2 * mu in Mandel notation
+  double H = kin ? linear_kin_->H(T_np1) : 0.0;
+  double r23 = sqrt(2.0/3.0);
+
+  // Trial relative stress dev(s) - X
+  double nv[6];
+  std::copy(ts.s_tr, ts.s_tr+6, nv);
+  dev_vec(nv);
+  if (kin) {
+    for (size_t i = 0; i < 6; i++) nv[i] -= H * h_n[i+1];
+  }
+  double r_tr = norm2_vec(nv, 6);
+
+  double dsy;
+  double f_tr = r_tr - r23 * flow_stress_(h_n[0], T_np1, dsy);
+
+  bool tangent = (A != nullptr);
+  if (tangent) {
+    std::fill(A, A+(n*n), 0.0);
+    std::fill(E, E+(n*6), 0.0);
+    for (size_t i = 0; i < 6; i++) {
+      for (size_t j = 0; j < 6; j++) {
+        E[CINDEX(i,j,6)] = ts.C[CINDEX(i,j,6)];
+      }
+    }
+  }
+
+  // Elastic step, matching the generic update
+  if (f_tr <= 0.0) {
+    double de[6];
+    sub_vec(e_np1, e_n, 6, de);
+    mat_vec(ts.C, 6, de, 6, s_np1);
+    for (size_t i = 0; i < 6; i++) s_np1[i] += s_n[i];
+    std::copy(h_n, h_n+nhist(), h_np1);
+    if (tangent) {
+      for (size_t i = 0; i < 6; i++) A[CINDEX(i,i,n)] = 1.0;
+    }
+
+    work_and_energy(&ts, e_np1, e_n, T_np1, T_n, t_np1, t_n, s_np1, s_n,
+                    h_np1, h_n, u_np1, u_n, p_np1, p_n);
+    return;
+  }
+
+  for (size_t i = 0; i < 6; i++) nv[i] /= r_tr;
+
+  // Scalar consistency equation
+  //  r_tr - (2G + H) dg - sqrt(2/3) sy(a_n + sqrt(2/3) dg) = 0
+  // which is exact after one iteration for linear hardening
+  double dg = 0.0;
+  double R = f_tr;
+  double beta = G2 + H + 2.0/3.0 * dsy;
+  int iter = 0;
+  while ((std::fabs(R) > rtol_ * f_tr) && (std::fabs(R) > atol_)) {
+    if (iter >= miter_) {
+      throw NonlinearSolverError("Radial return exceeded maximum allowed iterations!");
+    }
+    dg += R / beta;
+    R = r_tr - (G2 + H) * dg - r23 * flow_stress_(h_n[0] + r23 * dg, T_np1, 
+                                                  dsy);
+    beta = G2 + H + 2.0/3.0 * dsy;
+    iter++;
+  }
+
+  if (dg < 0.0) {
+    throw NonlinearSolverError("Radial return gave a negative consistency parameter");
+  }
+
+  // Updated state
+  for (size_t i = 0; i < 6; i++) s_np1[i] = ts.s_tr[i] - G2 * dg * nv[i];
+  h_np1[0] = h_n[0] + r23 * dg;
+  if (kin) {
+    for (size_t i = 0; i < 6; i++) h_np1[i+1] = h_n[i+1] + dg * nv[i];
+  }
+
+  work_and_energy(&ts, e_np1, e_n, T_np1, T_n, t_np1, t_n, s_np1, s_n,
+                  h_np1, h_n, u_np1, u_n, p_np1, p_n);
+
+  if (not tangent) return;
+
+  // Sensitivity of [s, a, dg] to the trial stress and the previous history,
+  // with the same meaning as the inverse jacobian in the generic update
+  //  P = c1 n x n + c2 (I_dev - n x n) 
+  //  Q = c1 n x n + c2 (I - n x n)
+  double c1 = 1.0 / beta;
+  double c2 = dg / r_tr;
+  double P[36];
+  double Q[36];
+  for (size_t i = 0; i < 6; i++) {
+    for (size_t j = 0; j < 6; j++) {
+      double nn = nv[i] * nv[j];
+      P[CINDEX(i,j,6)] = c1 * nn - c2 * nn;
+      Q[CINDEX(i,j,6)] = c1 * nn - c2 * nn;
+    }
+    Q[CINDEX(i,i,6)] += c2;
+    P[CINDEX(i,i,6)] += c2;
+  }
+  for (size_t i = 0; i < 3; i++) {
+    for (size_t j = 0; j < 3; j++) {
+      P[CINDEX(i,j,6)] -= c2 / 3.0;
+    }
+  }
+
+  size_t ia = 6;
+  size_t ig = n - 1;
+  for (size_t i = 0; i < 6; i++) {
+    for (size_t j = 0; j < 6; j++) {
+      A[CINDEX(i,j,n)] = -G2 * P[CINDEX(i,j,6)];
+    }
+    A[CINDEX(i,i,n)] += 1.0;
+    A[CINDEX(i,ia,n)] = G2 * r23 * dsy * c1 * nv[i];
+    A[CINDEX(ia,i,n)] = r23 * c1 * nv[i];
+    A[CINDEX(ig,i,n)] = c1 * nv[i];
+  }
+  A[CINDEX(ia,ia,n)] = 1.0 - 2.0/3.0 * dsy * c1;
+  A[CINDEX(ig,ia,n)] = -r23 * dsy * c1;
+
+  if (kin) {
+    size_t ik = 7;
+    for (size_t i = 0; i < 6; i++) {
+      for (size_t j = 0; j < 6; j++) {
+        A[CINDEX(i,(j+ik),n)] = G2 * H * Q[CINDEX(i,j,6)];
+        A[CINDEX((i+ik),j,n)] = P[CINDEX(i,j,6)];
+        A[CINDEX((i+ik),(j+ik),n)] = -H * Q[CINDEX(i,j,6)];
+      }
+      A[CINDEX((i+ik),(i+ik),n)] += 1.0;
+      A[CINDEX((i+ik),ia,n)] = -r23 * dsy * c1 * nv[i];
+      A[CINDEX(ia,(i+ik),n)] = -r23 * H * c1 * nv[i];
+      A[CINDEX(ig,(i+ik),n)] = -H * c1 * nv[i];
+    }
+  }
+}
+
+double SmallStrainRateIndependentPlasticity::flow_stress_(double a, double T,
+                                                          double & dsy) const
+{
+  if (linear_iso_) {
+    dsy = linear_iso_->K(T);
+    return linear_iso_->s0(T) + dsy * a;
+  }
+  else {
+    double R = voce_iso_->R(T);
+    double d = voce_iso_->d(T);
+    double ex = exp(-d * a);
+    dsy = R * d * ex;
+    return voce_iso_->s0(T) + R * (1.0 - ex);
+  }
+}
+
 // Implement creep + plasticity
 // Implementation of small strain rate independent plasticity
 //
@@ -1078,11 +1357,12 @@ void SmallStrainCreepPlasticity::update_sd(
   std::copy(x, x+6, h_np1);
 
   // Do the plastic update to get the new history and stress
+  bool tangent = (A_np1 != nullptr);
   double A[36];
   plastic_->update_sd(x, ts.ep_strain, T_np1, T_n,
                              t_np1, t_n, s_np1, s_n,
                              &h_np1[6], &h_n[6],
-                             A, u_np1, u_n, p_np1, p_n);
+                             tangent ? A : nullptr, u_np1, u_n, p_np1, p_n);
 
   // Do the creep update to get a tangent component
   double creep_old[6];
@@ -1095,7 +1375,7 @@ void SmallStrainCreepPlasticity::update_sd(
                  t_np1, t_n, B);
 
   // Form the relatively simple tangent
-  form_tangent_(A, B, A_np1);
+  if (tangent) form_tangent_(A, B, A_np1);
 
   // Energy calculation (trapezoid rule)
   double de[6];
@@ -1236,9 +1516,12 @@ void SmallStrainCreepPlasticity::set_elastic_model(std::shared_ptr<LinearElastic
 GeneralIntegrator::GeneralIntegrator(ParameterSet & params) :
     SubstepModel_sd(params),
     rule_(params.get_object_parameter<GeneralFlowRule>("rule")),
-    skip_first_(params.get_parameter<bool>("skip_first_step"))
+    skip_first_(params.get_parameter<bool>("skip_first_step")),
+    use_reduced_(params.get_parameter<bool>("reduced_integration")),
+    reduced_(false)
 {
-
+  setup_blocks_();
+  setup_reduced_();
 }
 
 std::string GeneralIntegrator::type()
@@ -1266,6 +1549,8 @@ ParameterSet GeneralIntegrator::parameters()
   pset.add_optional_parameter<bool>("force_divide", false);
   pset.add_optional_parameter<bool>("skip_first_step", false);
 
+  pset.add_optional_parameter<bool>("reduced_integration", false);
+
   return pset;
 }
 
@@ -1307,6 +1592,35 @@ bool GeneralIntegrator::elastic_step(
   return false;
 }
 
+void GeneralIntegrator::update_step(
+    const double * const e_np1, const double * const e_n,
+    double T_np1, double T_n,
+    double t_np1, double t_n,
+    double * const s_np1, const double * const s_n,
+    double * const h_np1, const double * const h_n,
+    double * const A, double * const E,
+    double & u_np1, double u_n,
+    double & p_np1, double p_n)
+{
+  // The reduced system only holds for isothermal, inelastic steps
+  if (reduced_ && (T_np1 == T_n) && 
+      ((t_np1 - t_n) >= std::numeric_limits<double>::epsilon())) {
+    if (chaboche_ && not chaboche_->static_recovery(T_np1)) {
+      if (reduced_step_(*chaboche_, e_np1, e_n, T_np1, T_n, t_np1, t_n,
+                        s_np1, s_n, h_np1, h_n, A, E, u_np1, u_n, p_np1,
+                        p_n)) return;
+    }
+    else if (chaboche_voce_ && not chaboche_voce_->static_recovery(T_np1)) {
+      if (reduced_step_(*chaboche_voce_, e_np1, e_n, T_np1, T_n, t_np1, t_n,
+                        s_np1, s_n, h_np1, h_n, A, E, u_np1, u_n, p_np1,
+                        p_n)) return;
+    }
+  }
+
+  SubstepModel_sd::update_step(e_np1, e_n, T_np1, T_n, t_np1, t_n, s_np1,
+                               s_n, h_np1, h_n, A, E, u_np1, u_n, p_np1, p_n);
+}
+
 void GeneralIntegrator::update_internal(
     const double * const x,
     const double * const e_np1, const double * const e_n,
@@ -1424,19 +1738,34 @@ void GeneralIntegrator::RJ(const double * const x, TrialState * ts,
   int nhist = this->nhist();
   int nparams = this->nparams();
 
+  // Rates and their partials, all at once
+  double J11[36];
+  std::vector<double> J12v(6*nhist);
+  double * J12 = &J12v[0];
+  std::vector<double> J21v(nhist*6);
+  double * J21 = &J21v[0];
+  std::vector<double> J22v(nhist*nhist);
+  double * J22 = &J22v[0];
+  rule_->evaluate(s_np1, h_np1, tss->e_dot, tss->T, tss->Tdot, 
+                  R, J11, J12, &R[6], J21, J22, tss->ev);
+
+  // Coupling between the history blocks, for the condensed linear solve
+  if ((blocks_.size() > 2) && (rank_ > 0)) {
+    tss->U.resize(nhist*rank_);
+    tss->V.resize(nhist*rank_);
+    rule_->da_da_coupling(s_np1, h_np1, tss->e_dot, tss->T, tss->Tdot,
+                          tss->ev, &tss->U[0], &tss->V[0]);
+  }
+
   // Residual calculation
-  rule_->s(s_np1, h_np1, tss->e_dot, tss->T, tss->Tdot, R);
   for (int i=0; i<6; i++) {
     R[i] = s_np1[i] - tss->s_n[i] - R[i] * tss->dt;
   }
-  rule_->a(s_np1, h_np1, tss->e_dot, tss->T, tss->Tdot, &R[6]);
   for (int i=0; i<nhist; i++) {
     R[i+6] = h_np1[i] - tss->h_n[i] - R[i+6] * tss->dt;
   }
 
   // Jacobian calculation
-  double J11[36];
-  rule_->ds_ds(s_np1, h_np1, tss->e_dot, tss->T, tss->Tdot, J11);
   for (int i=0; i<36; i++) J11[i] *= tss->dt;
   for (int i=0; i<6; i++) J11[CINDEX(i,i,6)] -= 1.0;
   for (int i=0; i<6; i++) {
@@ -1445,28 +1774,18 @@ void GeneralIntegrator::RJ(const double * const x, TrialState * ts,
     }
   }
   
-  std::vector<double> J12v(6*nhist);
-  double * J12 = &J12v[0];
-  rule_->ds_da(s_np1, h_np1, tss->e_dot, tss->T, tss->Tdot, J12);
   for (int i=0; i<6; i++) {
     for (int j=0; j<nhist; j++) {
       J[CINDEX(i,(j+6),nparams)] = -J12[CINDEX(i,j,nhist)] * tss->dt;
     }
   }
   
-  std::vector<double> J21v(nhist*6);
-  double * J21 = &J21v[0];
-  rule_->da_ds(s_np1, h_np1, tss->e_dot, tss->T, tss->Tdot, J21);
   for (int i=0; i<nhist; i++) {
     for (int j=0; j<6; j++) {
       J[CINDEX((i+6),j,nparams)] = -J21[CINDEX(i,j,6)] * tss->dt;
     }
   }
   
-  std::vector<double> J22v(nhist*nhist);
-  double * J22 = &J22v[0];
-  rule_->da_da(s_np1, h_np1, tss->e_dot, tss->T, tss->Tdot, J22);
-
   // More vectorization
   double dt = tss->dt;
   for (int i=0; i<nhist*nhist; i++) J22[i] *= dt;
@@ -1479,6 +1798,260 @@ void GeneralIntegrator::RJ(const double * const x, TrialState * ts,
   }
 }
 
+void GeneralIntegrator::linear_solve(const double * const J,
+                                     TrialState * ts, double * const R)
+{
+  // Nothing to gain for a single dense block
+  if (blocks_.size() <= 2) {
+    SubstepModel_sd::linear_solve(J, ts, R);
+    return;
+  }
+
+  GITrialState * tss = static_cast<GITrialState*>(ts);
+
+  size_t n = nparams();
+  size_t nh = nhist();
+
+  HistoryFactor f;
+  std::vector<double> DiC;
+  double S[36];
+  condense_(J, *tss, f, DiC, S);
+
+  // Eliminate the history unknowns: y = D^-1 R_h
+  std::vector<double> y(&R[6], &R[6]+nh);
+  apply_history_inverse_(f, *tss, &y[0], 1);
+
+  // Stress update from the Schur complement
+  double rs[6];
+  for (size_t i = 0; i < 6; i++) {
+    rs[i] = R[i];
+    for (size_t k = 0; k < nh; k++) {
+      rs[i] -= J[CINDEX(i,(6+k),n)] * y[k];
+    }
+  }
+  solve_mat(S, 6, rs);
+
+  // Back substitute for the history
+  std::copy(rs, rs+6, R);
+  for (size_t i = 0; i < nh; i++) {
+    R[6+i] = y[i];
+    for (size_t j = 0; j < 6; j++) {
+      R[6+i] -= DiC[CINDEX(i,j,6)] * rs[j];
+    }
+  }
+}
+
+void GeneralIntegrator::invert_jacobian(double * const A, TrialState * ts)
+{
+  if (blocks_.size() <= 2) {
+    SubstepModel_sd::invert_jacobian(A, ts);
+    return;
+  }
+
+  GITrialState * tss = static_cast<GITrialState*>(ts);
+
+  size_t n = nparams();
+  size_t nh = nhist();
+
+  HistoryFactor f;
+  std::vector<double> DiC;
+  double S[36];
+  condense_(A, *tss, f, DiC, S);
+  invert_mat(S, 6);
+
+  // Dense D^-1 from the factorization, then B D^-1
+  std::vector<double> Dinv(nh*nh, 0.0);
+  for (size_t i = 0; i < nh; i++) Dinv[CINDEX(i,i,nh)] = 1.0;
+  apply_history_inverse_(f, *tss, &Dinv[0], nh);
+
+  std::vector<double> B(6*nh);
+  for (size_t i = 0; i < 6; i++) {
+    for (size_t j = 0; j < nh; j++) {
+      B[CINDEX(i,j,nh)] = A[CINDEX(i,(6+j),n)];
+    }
+  }
+  std::vector<double> BDi(6*nh);
+  mat_mat(6, nh, nh, &B[0], &Dinv[0], &BDi[0]);
+
+  // S^-1 B D^-1 and D^-1 C S^-1
+  std::vector<double> SBDi(6*nh);
+  mat_mat(6, nh, 6, S, &BDi[0], &SBDi[0]);
+  std::vector<double> DiCS(nh*6);
+  mat_mat(nh, 6, 6, &DiC[0], S, &DiCS[0]);
+
+  // Assemble the inverse
+  for (size_t i = 0; i < 6; i++) {
+    for (size_t j = 0; j < 6; j++) {
+      A[CINDEX(i,j,n)] = S[CINDEX(i,j,6)];
+    }
+    for (size_t j = 0; j < nh; j++) {
+      A[CINDEX(i,(6+j),n)] = -SBDi[CINDEX(i,j,nh)];
+    }
+  }
+  for (size_t i = 0; i < nh; i++) {
+    for (size_t j = 0; j < 6; j++) {
+      A[CINDEX((6+i),j,n)] = -DiCS[CINDEX(i,j,6)];
+    }
+    for (size_t j = 0; j < nh; j++) {
+      double v = Dinv[CINDEX(i,j,nh)];
+      for (size_t k = 0; k < 6; k++) {
+        v += DiC[CINDEX(i,k,6)] * SBDi[CINDEX(k,j,nh)];
+      }
+      A[CINDEX((6+i),(6+j),n)] = v;
+    }
+  }
+}
+
+void GeneralIntegrator::setup_blocks_()
+{
+  std::vector<size_t> sizes = rule_->history_blocks();
+
+  blocks_.assign(1, 0);
+  for (auto sz : sizes) {
+    blocks_.push_back(blocks_.back() + sz);
+  }
+
+  if (blocks_.back() != nhist()) {
+    throw NEMLError("Flow rule history blocks do not match the number of "
+                    "history variables");
+  }
+
+  rank_ = rule_->history_rank();
+}
+
+void GeneralIntegrator::condense_(const double * const J,
+                                  const GITrialState & ts,
+                                  HistoryFactor & f,
+                                  std::vector<double> & DiC,
+                                  double * const S) const
+{
+  // Statically condense the history out of the jacobian
+  //   [ A  B ]
+  //   [ C  D ]
+  // The flow rule declares D = I - dt da_da as block diagonal plus the
+  // low rank term -dt U V^T, so D^-1 follows from the inverse of the
+  // blocks and the Woodbury identity
+  size_t n = nparams();
+  size_t nh = nhist();
+  size_t r = rank_;
+
+  f.Binv.assign(nh*nh, 0.0);
+  for (size_t b = 0; b < blocks_.size() - 1; b++) {
+    size_t o = blocks_[b];
+    size_t m = blocks_[b+1] - o;
+
+    // Invert the diagonal block, without its share of the coupling
+    std::vector<double> Db(m*m);
+    for (size_t i = 0; i < m; i++) {
+      for (size_t j = 0; j < m; j++) {
+        double v = J[CINDEX((6+o+i),(6+o+j),n)];
+        for (size_t k = 0; k < r; k++) {
+          v += ts.dt * ts.U[CINDEX((o+i),k,r)] * ts.V[CINDEX((o+j),k,r)];
+        }
+        Db[CINDEX(i,j,m)] = v;
+      }
+    }
+    invert_mat(&Db[0], m);
+    for (size_t i = 0; i < m; i++) {
+      for (size_t j = 0; j < m; j++) {
+        f.Binv[CINDEX((o+i),(o+j),nh)] = Db[CINDEX(i,j,m)];
+      }
+    }
+  }
+
+  // Woodbury: P = B^-1 (-dt U) and K = I + V^T P
+  if (r > 0) {
+    f.P.assign(nh*r, 0.0);
+    for (size_t b = 0; b < blocks_.size() - 1; b++) {
+      for (size_t i = blocks_[b]; i < blocks_[b+1]; i++) {
+        for (size_t k = blocks_[b]; k < blocks_[b+1]; k++) {
+          double d = -ts.dt * f.Binv[CINDEX(i,k,nh)];
+          for (size_t j = 0; j < r; j++) {
+            f.P[CINDEX(i,j,r)] += d * ts.U[CINDEX(k,j,r)];
+          }
+        }
+      }
+    }
+
+    f.Kinv.assign(r*r, 0.0);
+    for (size_t i = 0; i < r; i++) {
+      f.Kinv[CINDEX(i,i,r)] = 1.0;
+      for (size_t j = 0; j < r; j++) {
+        for (size_t k = 0; k < nh; k++) {
+          f.Kinv[CINDEX(i,j,r)] += ts.V[CINDEX(k,i,r)] * f.P[CINDEX(k,j,r)];
+        }
+      }
+    }
+    invert_mat(&f.Kinv[0], r);
+  }
+
+  // D^-1 C
+  DiC.resize(nh*6);
+  for (size_t i = 0; i < nh; i++) {
+    for (size_t j = 0; j < 6; j++) {
+      DiC[CINDEX(i,j,6)] = J[CINDEX((6+i),j,n)];
+    }
+  }
+  apply_history_inverse_(f, ts, &DiC[0], 6);
+
+  // Schur complement on the stress: A - B D^-1 C
+  for (size_t i = 0; i < 6; i++) {
+    for (size_t j = 0; j < 6; j++) {
+      double v = J[CINDEX(i,j,n)];
+      for (size_t k = 0; k < nh; k++) {
+        v -= J[CINDEX(i,(6+k),n)] * DiC[CINDEX(k,j,6)];
+      }
+      S[CINDEX(i,j,6)] = v;
+    }
+  }
+}
+
+void GeneralIntegrator::apply_history_inverse_(const HistoryFactor & f,
+                                               const GITrialState & ts,
+                                               double * const X,
+                                               size_t m) const
+{
+  // Overwrite the nhist x m matrix X with D^-1 X, where
+  //   D^-1 = B^-1 - P K^-1 V^T B^-1
+  size_t nh = nhist();
+  size_t r = rank_;
+
+  std::vector<double> Y(nh*m, 0.0);
+  for (size_t b = 0; b < blocks_.size() - 1; b++) {
+    for (size_t i = blocks_[b]; i < blocks_[b+1]; i++) {
+      for (size_t k = blocks_[b]; k < blocks_[b+1]; k++) {
+        double d = f.Binv[CINDEX(i,k,nh)];
+        for (size_t j = 0; j < m; j++) {
+          Y[CINDEX(i,j,m)] += d * X[CINDEX(k,j,m)];
+        }
+      }
+    }
+  }
+
+  if (r > 0) {
+    std::vector<double> Z(r*m, 0.0);
+    for (size_t k = 0; k < nh; k++) {
+      for (size_t i = 0; i < r; i++) {
+        double v = ts.V[CINDEX(k,i,r)];
+        for (size_t j = 0; j < m; j++) {
+          Z[CINDEX(i,j,m)] += v * Y[CINDEX(k,j,m)];
+        }
+      }
+    }
+    std::vector<double> W(r*m);
+    mat_mat(r, m, r, &f.Kinv[0], &Z[0], &W[0]);
+    for (size_t i = 0; i < nh; i++) {
+      for (size_t k = 0; k < r; k++) {
+        double p = f.P[CINDEX(i,k,r)];
+        for (size_t j = 0; j < m; j++) {
+          Y[CINDEX(i,j,m)] -= p * W[CINDEX(k,j,m)];
+        }
+      }
+    }
+  }
+
+  std::copy(Y.begin(), Y.end(), X);
+}
 
 void GeneralIntegrator::make_trial_state(
     const double * const e_np1, const double * const e_n,
@@ -1527,7 +2100,310 @@ void GeneralIntegrator::set_elastic_model(std::shared_ptr<LinearElasticModel> em
 {
   elastic_ = emodel;
   rule_->set_elastic_model(emodel);
+  setup_reduced_();
+}
+
+bool GeneralIntegrator::reduced_integration() const
+{
+  return reduced_;
+}
+
+void GeneralIntegrator::setup_reduced_()
+{
+  reduced_ = false;
+  reduced_elastic_ = nullptr;
+  chaboche_flow_ = nullptr;
+  chaboche_ = nullptr;
+  chaboche_voce_ = nullptr;
+
+  if (not use_reduced_) return;
+
+  auto rule = std::dynamic_pointer_cast<TVPFlowRule>(rule_);
+  if (not rule) return;
+
+  // The residual uses the flow rule's elastic model
+  reduced_elastic_ = rule->elastic();
+  if (not std::dynamic_pointer_cast<const IsotropicLinearElasticModel>(
+          reduced_elastic_)) return;
+
+  chaboche_flow_ = std::dynamic_pointer_cast<const ChabocheFlowRule>(
+      rule->flow());
+  if (not chaboche_flow_) return;
+  if (not std::dynamic_pointer_cast<const IsoKinJ2>(chaboche_flow_->surface())) 
+    return;
+
+  chaboche_ = std::dynamic_pointer_cast<const Chaboche>(
+      chaboche_flow_->hardening());
+  chaboche_voce_ = std::dynamic_pointer_cast<const ChabocheVoceRecovery>(
+      chaboche_flow_->hardening());
+
+  reduced_ = chaboche_ || chaboche_voce_;
+}
+
+// With isotropic elasticity, an IsoKinJ2 surface, and no recovery the 
+// backward Euler equations for the stress and each backstress are linear
+// in the flow direction, which is fixed by the trial state:
+//  s = s_tr - 2 G dp n
+//  X_i = (X_i_n - 2/3 C_i dp n) / D_i,  D_i = 1 + sqrt(2/3) gamma_i dp
+//  n = xi_tr / |xi_tr|,  xi_tr = dev(s_tr) + sum_i X_i_n / D_i
+// so the whole update is a scalar equation for the increment dp
+//  f(dp) - eta (dp / k)^(1/m) = 0
+template <class H>
+bool GeneralIntegrator::reduced_step_(
+    const H & hardening,
+    const double * const e_np1, const double * const e_n,
+    double T_np1, double T_n,
+    double t_np1, double t_n,
+    double * const s_np1, const double * const s_n,
+    double * const h_np1, const double * const h_n,
+    double * const A, double * const E,
+    double & u_np1, double u_n,
+    double & p_np1, double p_n)
+{
+  GITrialState ts;
+  make_trial_state(e_np1, e_n, T_np1, T_n, t_np1, t_n, s_n, h_n, ts);
+
+  size_t n = nparams();
+  size_t nb = hardening.n();
+  double T = T_np1;
+  double r23 = sqrt(2.0/3.0);
+
+  // Trial stress
+  double C[36];
+  reduced_elastic_->C(T, C);
+  double G2 = C[CINDEX(3,3,6)]; // 2 * mu in Mandel notation
+  double de[6];
+  sub_vec(e_np1, e_n, 6, de);
+  double s_tr[6];
+  mat_vec(C, 6, de, 6, s_tr);
+  add_vec(s_tr, s_n, 6, s_tr);
+  double sd_tr[6];
+  std::copy(s_tr, s_tr+6, sd_tr);
+  dev_vec(sd_tr);
+
+  std::vector<double> c = hardening.c(T);
+  double m = chaboche_flow_->n(T);
+  double k = sqrt(3.0/2.0) * chaboche_flow_->prefactor(T) * ts.dt;
+  auto fluidity = chaboche_flow_->fluidity();
+  const double * const an = &h_n[1];
+
+  std::vector<double> work(5*nb);
+  double * g = &work[0];
+  double * dg = &work[nb];
+  double * D = &work[2*nb];
+  double * Dd = &work[3*nb];
+  double * w = &work[4*nb];
+
+  // Everything as a function of the increment dp
+  double xi[6];
+  double a0, da_dp, da_a0n, rho, f, q0, dq0, zm, phi, dphi;
+  auto evaluate = [&](double dp)
+  {
+    a0 = hardening.iso_update(h_n[0], dp, T, da_dp, da_a0n);
+    hardening.gamma(a0, T, g, dg);
+
+    std::copy(sd_tr, sd_tr+6, xi);
+    double B = G2 * dp;
+    double dB = G2;
+    for (size_t i = 0; i < nb; i++) {
+      D[i] = 1.0 + r23 * g[i] * dp;
+      Dd[i] = r23 * g[i] + r23 * dg[i] * dp * da_dp;
+      for (size_t j = 0; j < 6; j++) xi[j] += an[i*6+j] / D[i];
+      B += 2.0/3.0 * c[i] * dp / D[i];
+      dB += 2.0/3.0 * c[i] / D[i];
+    }
+    rho = norm2_vec(xi, 6);
+    q0 = hardening.iso_q(a0, T, dq0);
+    f = rho - B + r23 * q0;
+
+    double eta = r23 * fluidity->eta(a0, T);
+    double deta = r23 * fluidity->deta(a0, T);
+    double z = dp / k;
+    zm = pow(z, 1.0 / m);
+    phi = f - eta * zm;
+
+    dphi = -dB + (r23 * dq0 - deta * zm) * da_dp;
+    for (size_t i = 0; i < nb; i++) {
+      w[i] = (2.0/3.0 * c[i] * dp - dot_vec(xi, &an[i*6], 6) / rho) / 
+          (D[i] * D[i]);
+      dphi += w[i] * Dd[i];
+    }
+    if (dp > 0.0) dphi -= eta / (m * k) * pow(z, 1.0 / m - 1.0);
+    else dphi = -std::numeric_limits<double>::infinity();
+  };
+
+  double dp = 0.0;
+  evaluate(dp);
+  double f_tr = phi;
+
+  if (f_tr > 0.0) {
+    // Bracket the root, starting from the explicit rate estimate capped
+    // by the rate independent limit, and then use a safeguarded Newton 
+    // iteration
+    double lo = 0.0;
+    double hi = std::min(
+        k * pow(f_tr / (r23 * fluidity->eta(h_n[0], T)), m), f_tr / G2);
+    if (not (hi > 0.0)) hi = f_tr / G2;
+    evaluate(hi);
+    int iter = 0;
+    while (phi > 0.0) {
+      if (iter >= miter_) {
+        throw NonlinearSolverError("Could not bracket the reduced Chaboche update");
+      }
+      lo = hi;
+      hi *= 2.0;
+      evaluate(hi);
+      iter++;
+    }
+
+    dp = hi;
+    iter = 0;
+    while ((std::fabs(phi) > rtol_ * f_tr) && (std::fabs(phi) > atol_)) {
+      if (iter >= miter_) {
+        throw NonlinearSolverError("Reduced Chaboche update exceeded maximum allowed iterations!");
+      }
+      if (phi > 0.0) lo = dp;
+      else hi = dp;
+      double dp_new = dp - phi / dphi;
+      if ((dp_new <= lo) || (dp_new >= hi)) dp_new = (lo + hi) / 2.0;
+      dp = dp_new;
+      evaluate(dp);
+      iter++;
+    }
+
+    if (dp / ts.dt > NEML_STRAIN_RATE_LIMIT) 
+      throw NEMLError("Strain rate exceeds rate limit");
+
+    // The reduction assumes the relative stress keeps the trial direction
+    if (f - r23 * q0 < 0.0) return false;
+  }
+
+  // Flow direction and the updated state
+  double nv[6];
+  std::copy(xi, xi+6, nv);
+  if (rho > 0.0) {
+    for (size_t i = 0; i < 6; i++) nv[i] /= rho;
+  }
+
+  for (size_t i = 0; i < 6; i++) s_np1[i] = s_tr[i] - G2 * dp * nv[i];
+  h_np1[0] = a0;
+  for (size_t i = 0; i < nb; i++) {
+    for (size_t j = 0; j < 6; j++) {
+      h_np1[1+i*6+j] = (an[i*6+j] - 2.0/3.0 * c[i] * dp * nv[j]) / D[i];
+    }
+  }
+
+  work_and_energy(&ts, e_np1, e_n, T_np1, T_n, t_np1, t_n, s_np1, s_n,
+                  h_np1, h_n, u_np1, u_n, p_np1, p_n);
+
+  if (A == nullptr) return true;
+
+  std::fill(E, E+(n*6), 0.0);
+  for (size_t i = 0; i < 6; i++) {
+    for (size_t j = 0; j < 6; j++) {
+      E[CINDEX(i,j,6)] = C[CINDEX(i,j,6)];
+    }
+  }
+
+  std::fill(A, A+(n*n), 0.0);
+  if (dp == 0.0) {
+    for (size_t i = 0; i < n; i++) A[CINDEX(i,i,n)] = 1.0;
+  }
+  else {
+    // Sensitivity of the updated state to the previous state, matching
+    // the inverse jacobian of the full system
+    size_t ia = 6;
+    double Da = 0.0;
+
+    // d(dp) / d(s_n, h_n)
+    std::vector<double> gradv(n);
+    double * grad = &gradv[0];
+    double da0n = (r23 * dq0 - r23 * fluidity->deta(a0, T) * zm) * da_a0n;
+    for (size_t i = 0; i < nb; i++) {
+      Da = r23 * dg[i] * dp * da_a0n;
+      da0n += w[i] * Da;
+    }
+    for (size_t i = 0; i < 6; i++) grad[i] = -nv[i] / dphi;
+    grad[ia] = -da0n / dphi;
+    for (size_t i = 0; i < nb; i++) {
+      for (size_t j = 0; j < 6; j++) {
+        grad[7+i*6+j] = -nv[j] / D[i] / dphi;
+      }
+    }
+
+    // d(D_i) / d(s_n, h_n)
+    std::vector<double> dDv(nb*n);
+    double * dD = &dDv[0];
+    for (size_t i = 0; i < nb; i++) {
+      for (size_t j = 0; j < n; j++) {
+        dD[CINDEX(i,j,n)] = Dd[i] * grad[j];
+      }
+      dD[CINDEX(i,ia,n)] += r23 * dg[i] * dp * da_a0n;
+    }
+
+    // d(xi_tr) / d(s_n, h_n)
+    std::vector<double> dxiv(6*n, 0.0);
+    double * dxi = &dxiv[0];
+    for (size_t i = 0; i < 6; i++) {
+      dxi[CINDEX(i,i,n)] = 1.0;
+    }
+    for (size_t i = 0; i < 3; i++) {
+      for (size_t j = 0; j < 3; j++) {
+        dxi[CINDEX(i,j,n)] -= 1.0 / 3.0;
+      }
+    }
+    for (size_t b = 0; b < nb; b++) {
+      for (size_t i = 0; i < 6; i++) {
+        dxi[CINDEX(i,(7+b*6+i),n)] += 1.0 / D[b];
+        for (size_t j = 0; j < n; j++) {
+          dxi[CINDEX(i,j,n)] -= an[b*6+i] * dD[CINDEX(b,j,n)] / (D[b] * D[b]);
+        }
+      }
+    }
+
+    // n x d(dp) + dp * d(n)
+    double M[36];
+    std::fill(M, M+36, 0.0);
+    for (size_t i = 0; i < 6; i++) M[CINDEX(i,i,6)] = 1.0;
+    outer_update_minus(nv, 6, nv, 6, M);
+    for (size_t i = 0; i < 36; i++) M[i] *= dp / rho;
+    std::vector<double> dnv(6*n);
+    double * dn = &dnv[0];
+    mat_mat(6, n, 6, M, dxi, dn);
+    for (size_t i = 0; i < 6; i++) {
+      for (size_t j = 0; j < n; j++) {
+        dn[CINDEX(i,j,n)] += nv[i] * grad[j];
+      }
+    }
+
+    // Stress
+    for (size_t i = 0; i < 6; i++) {
+      for (size_t j = 0; j < n; j++) {
+        A[CINDEX(i,j,n)] = -G2 * dn[CINDEX(i,j,n)];
+      }
+      A[CINDEX(i,i,n)] += 1.0;
+    }
+
+    // Isotropic variable
+    for (size_t j = 0; j < n; j++) {
+      A[CINDEX(ia,j,n)] = da_dp * grad[j];
+    }
+    A[CINDEX(ia,ia,n)] += da_a0n;
+
+    // Backstresses
+    for (size_t b = 0; b < nb; b++) {
+      for (size_t i = 0; i < 6; i++) {
+        size_t ii = 7 + b*6 + i;
+        for (size_t j = 0; j < n; j++) {
+          A[CINDEX(ii,j,n)] = (-2.0/3.0 * c[b] * dn[CINDEX(i,j,n)] -
+                                h_np1[ii-6] * dD[CINDEX(b,j,n)]) / D[b];
+        }
+        A[CINDEX(ii,ii,n)] += 1.0 / D[b];
+      }
+    }
+  }
 
+  return true;
 }
 
 // Start KMRegimeModel
@@ -64,7 +64,15 @@ PYBIND11_MODULE(models, m) {
 
            }, "Large deformation incremental update.")
 
-      .def("alpha", &NEMLModel::alpha)
+      .def("alpha", (double (NEMLModel::*)(double) const) &NEMLModel::alpha,
+           "Instantaneous CTE at T")
+      .def("alpha",
+           [](NEMLModel & m, py::array_t<double, py::array::c_style> T) -> py::array_t<double>
+           {
+            auto a = alloc_vec<double>(T.size());
+            m.alpha(arr2ptr<double>(T), arr2ptr<double>(a), T.size());
+            return a;
+           }, "Instantaneous CTE at an array of temperatures")
       .def("elastic_strains",
            [](NEMLModel & m, py::array_t<double, py::array::c_style> s_np1, double T_np1, py::array_t<double, py::array::c_style> h_np1) -> py::array_t<double>
            {
@@ -159,6 +167,9 @@ PYBIND11_MODULE(models, m) {
                                           *ts);
               return ts;
            }, "Setup trial state for solve.")
+      .def_property_readonly("radial_return",
+                             &SmallStrainRateIndependentPlasticity::radial_return,
+                             "Whether the closed form radial return is used.")
       ;
 
   py::class_<SmallStrainCreepPlasticity, NEMLModel_sd, Solvable, std::shared_ptr<SmallStrainCreepPlasticity>>(m, "SmallStrainCreepPlasticity")
@@ -208,6 +219,9 @@ PYBIND11_MODULE(models, m) {
                                           *ts);
               return ts;
            }, "Setup trial state for solve.")
+      .def_property_readonly("reduced_integration",
+                             &GeneralIntegrator::reduced_integration,
+                             "Whether the reduced Chaboche integration is used.")
       ;
 
   py::class_<KMRegimeModel, NEMLModel_sd, std::shared_ptr<KMRegimeModel>>(m, "KMRegimeModel")
@@ -0,0 +1,62 @@
+#include "parallel.h"
+
+#include <exception>
+
+#ifdef USE_OMP
+#include <omp.h>
+#endif
+
+namespace neml {
+
+#ifdef USE_OMP
+// f is a pointer so the tasks capture it by value without copying the
+// std::function into each one
+static void task_loop_(size_t n, const std::function<void(size_t)> * f,
+                       std::exception_ptr & error)
+{
+#pragma omp taskloop shared(error)
+  for (size_t i = 0; i < n; i++) {
+    try {
+      (*f)(i);
+    }
+    catch (...) {
+#pragma omp critical(neml_parallel_for)
+      {
+        if (!error) error = std::current_exception();
+      }
+    }
+  }
+}
+#endif
+
+void parallel_for(size_t n, int nthreads,
+                  const std::function<void(size_t)> & f)
+{
+#ifdef USE_OMP
+  if (omp_in_parallel() || (nthreads > 1 && n > 1)) {
+    std::exception_ptr error = nullptr;
+    if (omp_in_parallel()) {
+      task_loop_(n, &f, error);
+    }
+    else {
+#pragma omp parallel num_threads(nthreads) proc_bind(spread)
+#pragma omp single
+      task_loop_(n, &f, error);
+    }
+    if (error) std::rethrow_exception(error);
+    return;
+  }
+#endif
+  for (size_t i = 0; i < n; i++) f(i);
+}
+
+int default_threads()
+{
+#ifdef USE_OMP
+  return omp_get_max_threads();
+#else
+  return 1;
+#endif
+}
+
+} // namespace neml
@@ -178,7 +178,15 @@ void RateIndependentAssociativeFlow::dh_da(const double * const s,
   mat_mat(nhist(), nhist(), nhist(), dd, jac, dhv);
 }
 
+std::shared_ptr<const YieldSurface> RateIndependentAssociativeFlow::surface() const
+{
+  return surface_;
+}
 
+std::shared_ptr<const HardeningRule> RateIndependentAssociativeFlow::hardening() const
+{
+  return hardening_;
+}
 
 RateIndependentNonAssociativeHardening::RateIndependentNonAssociativeHardening(
     ParameterSet & params) :
@@ -11,6 +11,12 @@
 
 namespace neml {
 
+void Solvable::linear_solve(const double * const J, TrialState * ts,
+                            double * const R)
+{
+  solve_mat(J, nparams(), R);
+}
+
 // This function is configured by the build
 void solve(Solvable * system, double * x, TrialState * ts,
           SolverParameters p, double * R, double * J)
@@ -70,7 +76,7 @@ void newton(Solvable * system, double * x, TrialState * ts, SolverParameters p,
   {
     if ((nR < p.atol) || ((nR / nR0) < p.rtol)) break;
 
-    solve_mat(J, n, R);
+    system->linear_solve(J, ts, R);
 
     if (p.linesearch) {
       int nsearch = 0;
@@ -364,4 +370,69 @@ void TestPower::RJ(const double * const x, TrialState * ts, double * const R,
 }
 
 
+AndersonMixing::AndersonMixing(size_t n, size_t depth) :
+    n_(n), depth_(depth)
+{
+
+}
+
+void AndersonMixing::update(double * const x, const double * const f)
+{
+  if (x_prev_.size() > 0) {
+    std::vector<double> dx(n_), df(n_);
+    for (size_t j = 0; j < n_; j++) {
+      dx[j] = x[j] - x_prev_[j];
+      df[j] = f[j] - f_prev_[j];
+    }
+    dX_.push_back(dx);
+    dF_.push_back(df);
+    if (dX_.size() > depth_) {
+      dX_.erase(dX_.begin());
+      dF_.erase(dF_.begin());
+    }
+  }
+  x_prev_.assign(x, x+n_);
+  f_prev_.assign(f, f+n_);
+
+  // Least squares min |f - dF gamma| through the normal equations, lightly
+  // regularized
+  size_t m = dF_.size();
+  std::vector<double> gamma(m);
+  if (m > 0) {
+    std::vector<double> N(m * m);
+    double scale = 0.0;
+    for (size_t a = 0; a < m; a++) {
+      for (size_t b = 0; b < m; b++)
+        N[CINDEX(a,b,m)] = dot_vec(&dF_[a][0], &dF_[b][0], n_);
+      gamma[a] = dot_vec(&dF_[a][0], f, n_);
+      scale += N[CINDEX(a,a,m)];
+    }
+    for (size_t a = 0; a < m; a++) N[CINDEX(a,a,m)] += 1.0e-12 * scale;
+    try {
+      solve_mat(&N[0], m, &gamma[0]);
+    }
+    catch (const LinalgError & e) {
+      // The differences are no longer independent, start over from the
+      // current point
+      dX_.clear();
+      dF_.clear();
+      m = 0;
+    }
+  }
+
+  for (size_t j = 0; j < n_; j++) {
+    x[j] += f[j];
+    for (size_t a = 0; a < m; a++)
+      x[j] -= gamma[a] * (dX_[a][j] + dF_[a][j]);
+  }
+}
+
+void AndersonMixing::reset()
+{
+  dX_.clear();
+  dF_.clear();
+  x_prev_.clear();
+  f_prev_.clear();
+}
+
 } // namespace neml
@@ -63,6 +63,19 @@ PYBIND11_MODULE(solvers, m) {
         py::arg("miter") = 50,
         py::arg("verbose") = false, py::arg("linesearch") = false);
 
+  py::class_<AndersonMixing, std::shared_ptr<AndersonMixing>>(m, "AndersonMixing")
+      .def(py::init<size_t, size_t>(), py::arg("n"), py::arg("depth"))
+      .def("update",
+           [](AndersonMixing & m, py::array_t<double, py::array::c_style> x,
+              py::array_t<double, py::array::c_style> f)
+           {
+            if (x.request().size != f.request().size)
+              throw std::runtime_error("x and f do not have the same size");
+            m.update(arr2ptr<double>(x), arr2ptr<double>(f));
+           }, "Given the residual f at x, overwrite x with the next iterate")
+      .def("reset", &AndersonMixing::reset, "Forget the stored differences")
+      ;
+
   py::class_<TestPower, Solvable, std::shared_ptr<TestPower>>(m, "TestPower")
       .def(py::init<double, double, double, double>())
       ;
@@ -7,6 +7,24 @@
 
 namespace neml {
 
+void ViscoPlasticEvaluation::resize(size_t nhist)
+{
+  dy_da.resize(nhist);
+  dg_da.resize(6*nhist);
+  dg_da_time.resize(6*nhist);
+  dg_da_temp.resize(6*nhist);
+
+  h.resize(nhist);
+  dh_ds.resize(nhist*6);
+  dh_da.resize(nhist*nhist);
+  h_time.resize(nhist);
+  dh_ds_time.resize(nhist*6);
+  dh_da_time.resize(nhist*nhist);
+  h_temp.resize(nhist);
+  dh_ds_temp.resize(nhist*6);
+  dh_da_temp.resize(nhist*nhist);
+}
+
 ViscoPlasticFlowRule::ViscoPlasticFlowRule(ParameterSet & params) :
     NEMLObject(params)
 {
@@ -101,11 +119,80 @@ void ViscoPlasticFlowRule::dh_da_temp(const double * const s,
   std::fill(dhv, dhv+nhist()*nhist(), 0.0);
 }
 
+// Default fused evaluation, just calls everything
+void ViscoPlasticFlowRule::evaluate(const double * const s,
+                                    const double * const alpha, double T,
+                                    ViscoPlasticEvaluation & res) const
+{
+  res.resize(nhist());
+
+  y(s, alpha, T, res.y);
+  dy_ds(s, alpha, T, res.dy_ds);
+  dy_da(s, alpha, T, &res.dy_da[0]);
+
+  g(s, alpha, T, res.g);
+  dg_ds(s, alpha, T, res.dg_ds);
+  dg_da(s, alpha, T, &res.dg_da[0]);
+  
+  h(s, alpha, T, &res.h[0]);
+  dh_ds(s, alpha, T, &res.dh_ds[0]);
+  dh_da(s, alpha, T, &res.dh_da[0]);
+
+  evaluate_g_rates_(s, alpha, T, res);
+  evaluate_h_rates_(s, alpha, T, res);
+}
+
+void ViscoPlasticFlowRule::evaluate_g_rates_(const double * const s,
+                                             const double * const alpha,
+                                             double T,
+                                             ViscoPlasticEvaluation & res) const
+{
+  g_time(s, alpha, T, res.g_time);
+  dg_ds_time(s, alpha, T, res.dg_ds_time);
+  dg_da_time(s, alpha, T, &res.dg_da_time[0]);
+
+  g_temp(s, alpha, T, res.g_temp);
+  dg_ds_temp(s, alpha, T, res.dg_ds_temp);
+  dg_da_temp(s, alpha, T, &res.dg_da_temp[0]);
+}
+
+void ViscoPlasticFlowRule::evaluate_h_rates_(const double * const s,
+                                             const double * const alpha,
+                                             double T,
+                                             ViscoPlasticEvaluation & res) const
+{
+  h_time(s, alpha, T, &res.h_time[0]);
+  dh_ds_time(s, alpha, T, &res.dh_ds_time[0]);
+  dh_da_time(s, alpha, T, &res.dh_da_time[0]);
+
+  h_temp(s, alpha, T, &res.h_temp[0]);
+  dh_ds_temp(s, alpha, T, &res.dh_ds_temp[0]);
+  dh_da_temp(s, alpha, T, &res.dh_da_temp[0]);
+}
+
 void ViscoPlasticFlowRule::override_guess(double * const guess)
 {
   return;
 }
 
+std::vector<size_t> ViscoPlasticFlowRule::history_blocks() const
+{
+  return std::vector<size_t>(1, nhist());
+}
+
+size_t ViscoPlasticFlowRule::history_rank() const
+{
+  return 0;
+}
+
+void ViscoPlasticFlowRule::dh_da_coupling(const double * const s,
+                                          const double * const alpha,
+                                          double T, double * const U,
+                                          double * const V) const
+{
+  return;
+}
+
 GFlow::GFlow(ParameterSet & params) :
     NEMLObject(params)
 {
@@ -359,6 +446,64 @@ void PerzynaFlowRule::dh_da(const double * const s, const double * const alpha,
   mat_mat(nhist(), nhist(), nhist(), dd, jac, dhv);
 }
 
+void PerzynaFlowRule::evaluate(const double * const s,
+                               const double * const alpha, double T,
+                               ViscoPlasticEvaluation & res) const
+{
+  size_t nh = nhist();
+  res.resize(nh);
+
+  std::vector<double> qv(nh);
+  double * q = &qv[0];
+  hardening_->q(alpha, T, q);
+
+  std::vector<double> jacv(nh * nh);
+  double * jac = &jacv[0];
+  hardening_->dq_da(alpha, T, jac);
+
+  double fv;
+  surface_->f(s, q, T, fv);
+
+  // The flow direction and the hardening rule are the surface gradients
+  surface_->df_ds(s, q, T, res.g);
+  surface_->df_dq(s, q, T, &res.h[0]);
+
+  // Rate
+  std::fill(res.dy_ds, res.dy_ds+6, 0.0);
+  std::fill(res.dy_da.begin(), res.dy_da.end(), 0.0);
+  if (fv > 0.0) {
+    res.y = g_->g(fabs(fv), T);
+    double dgv = g_->dg(fabs(fv), T);
+    for (int i=0; i<6; i++) {
+      res.dy_ds[i] = res.g[i] * dgv;
+    }
+    mat_vec_trans(jac, nh, &res.h[0], nh, &res.dy_da[0]);
+    for (size_t i=0; i<nh; i++) {
+      res.dy_da[i] *= dgv;
+    }
+  }
+  else {
+    res.y = 0.0;
+  }
+
+  // Flow rule
+  surface_->df_dsds(s, q, T, res.dg_ds);
+  std::vector<double> ddv(6*nh);
+  double * dd = &ddv[0];
+  surface_->df_dsdq(s, q, T, dd);
+  mat_mat(6, nh, nh, dd, jac, &res.dg_da[0]);
+
+  // Hardening rule
+  surface_->df_dqds(s, q, T, &res.dh_ds[0]);
+  std::vector<double> hhv(nh*nh);
+  double * hh = &hhv[0];
+  surface_->df_dqdq(s, q, T, hh);
+  mat_mat(nh, nh, nh, hh, jac, &res.dh_da[0]);
+
+  evaluate_g_rates_(s, alpha, T, res);
+  evaluate_h_rates_(s, alpha, T, res);
+}
+
 FluidityModel::FluidityModel(ParameterSet & params) :
     NEMLObject(params)
 {
@@ -676,6 +821,113 @@ void ChabocheFlowRule::dh_da_temp(const double * const s, const double * const a
   hardening_->dh_da_temp(s, alpha, T, dhv);
 }
 
+void ChabocheFlowRule::evaluate(const double * const s,
+                                const double * const alpha, double T,
+                                ViscoPlasticEvaluation & res) const
+{
+  size_t nh = nhist();
+  size_t ni = hardening_->ninter();
+  res.resize(nh);
+
+  std::vector<double> qv(ni);
+  double * q = &qv[0];
+  hardening_->q(alpha, T, q);
+
+  std::vector<double> jacv(ni * nh);
+  double * jac = &jacv[0];
+  hardening_->dq_da(alpha, T, jac);
+
+  double fv;
+  surface_->f(s, q, T, fv);
+
+  // Flow rule
+  surface_->df_ds(s, q, T, res.g);
+  surface_->df_dsds(s, q, T, res.dg_ds);
+  std::vector<double> ddv(6 * ni);
+  double * dd = &ddv[0];
+  surface_->df_dsdq(s, q, T, dd);
+  mat_mat(6, nh, ni, dd, jac, &res.dg_da[0]);
+
+  // Rate
+  std::fill(res.dy_ds, res.dy_ds+6, 0.0);
+  std::fill(res.dy_da.begin(), res.dy_da.end(), 0.0);
+  if (fv > 0.0) {
+    double eta = sqrt(2.0 / 3.0) * fluidity_->eta(alpha[0], T);
+    double nv = n_->value(T);
+    double pv = prefactor_->value(T);
+    double pw = pow(fv / eta, nv - 1.0);
+
+    res.y = sqrt(3.0 / 2.0) * pow(fv / eta, nv) * pv;
+
+    double mv = sqrt(3.0 / 2.0) * pw * nv / eta * pv;
+    for (int i = 0; i < 6; i++)
+      res.dy_ds[i] = res.g[i] * mv;
+
+    std::vector<double> dqv(ni);
+    double * dq = &dqv[0];
+    surface_->df_dq(s, q, T, dq);
+    mat_vec_trans(jac, nh, dq, ni, &res.dy_da[0]);
+    for (size_t i = 0; i < nh; i++)
+      res.dy_da[i] *= mv;
+
+    double mv2 = -sqrt(3.0 / 2.0) * fv * pw * nv / (eta * eta) * pv;
+    double deta = sqrt(2.0/3.0) * fluidity_->deta(alpha[0], T);
+    res.dy_da[0] += deta * mv2;
+  }
+  else {
+    res.y = 0.0;
+  }
+
+  // Hardening rule, all at once
+  hardening_->evaluate(s, alpha, T, &res.h[0], &res.dh_ds[0], &res.dh_da[0],
+                       &res.h_time[0], &res.dh_ds_time[0], &res.dh_da_time[0],
+                       &res.h_temp[0], &res.dh_ds_temp[0], &res.dh_da_temp[0]);
+
+  evaluate_g_rates_(s, alpha, T, res);
+}
+
+std::vector<size_t> ChabocheFlowRule::history_blocks() const
+{
+  return hardening_->history_blocks();
+}
+
+size_t ChabocheFlowRule::history_rank() const
+{
+  return hardening_->history_rank();
+}
+
+void ChabocheFlowRule::dh_da_coupling(const double * const s,
+                                      const double * const alpha, double T,
+                                      double * const U, double * const V) const
+{
+  hardening_->dh_da_coupling(s, alpha, T, U, V);
+}
+
+std::shared_ptr<const YieldSurface> ChabocheFlowRule::surface() const
+{
+  return surface_;
+}
+
+std::shared_ptr<const NonAssociativeHardening> ChabocheFlowRule::hardening() const
+{
+  return hardening_;
+}
+
+std::shared_ptr<const FluidityModel> ChabocheFlowRule::fluidity() const
+{
+  return fluidity_;
+}
+
+double ChabocheFlowRule::n(double T) const
+{
+  return n_->value(T);
+}
+
+double ChabocheFlowRule::prefactor(double T) const
+{
+  return prefactor_->value(T);
+}
+
 YaguchiGr91FlowRule::YaguchiGr91FlowRule(ParameterSet & params) : 
     ViscoPlasticFlowRule(params)
 {
@@ -1221,6 +1473,180 @@ void YaguchiGr91FlowRule::dh_da_time(const double * const s,
 }
 
 
+void YaguchiGr91FlowRule::evaluate(const double * const s,
+                                   const double * const alpha, double T,
+                                   ViscoPlasticEvaluation & res) const
+{
+  int nh = nhist();
+  res.resize(nh);
+
+  double nT = n(T);
+  double DT = D(T);
+  double sa = alpha[13];
+
+  // Effective stress, its norm, and its deviatoric part
+  double X[6];
+  std::fill(X, X+6, 0.0);
+  add_vec(&alpha[0], &alpha[6], 6, X);
+  double dS[6];
+  sub_vec(s, X, 6, dS);
+  double j2 = J2_(dS);
+  double mdS[6];
+  dev_vec_deriv_(dS, mdS);
+  double devS[6];
+  std::copy(dS, dS+6, devS);
+  dev_vec(devS);
+
+  // Rate
+  double yq = (j2 - sa) / DT;
+  std::fill(res.dy_ds, res.dy_ds+6, 0.0);
+  std::fill(res.dy_da.begin(), res.dy_da.end(), 0.0);
+  if (yq > 0.0) {
+    res.y = pow(fabs(yq), nT);
+  }
+  else {
+    res.y = 0.0;
+  }
+  if (res.y > 0.0) {
+    double sp = pow(fabs(yq), nT - 1.0) * nT * copysign(1.0, yq) / DT;
+    for (int i=0; i<6; i++) {
+      res.dy_ds[i] = mdS[i] * (3.0/2.0 / j2 * sp);
+      res.dy_da[i] = mdS[i] * (-3.0/2.0 / j2 * sp);
+      res.dy_da[i+6] = mdS[i] * (-3.0/2.0 / j2 * sp);
+    }
+    res.dy_da[13] = -nT * pow(fabs(yq), nT - 1.0) * copysign(1.0, yq) / DT;
+  }
+
+  // Flow rule
+  std::fill(res.g, res.g+6, 0.0);
+  if (j2 > 0.0) {
+    for (int i=0; i<6; i++) {
+      res.g[i] = 3.0/2.0 * devS[i] / j2;
+    }
+  }
+
+  double * dgv = res.dg_ds;
+  std::fill(dgv, dgv+36, 0.0);
+  for (int i=0; i<3; i++) {
+    for (int j=0; j<3; j++) {
+      if (i==j) {
+        dgv[CINDEX(i,j,6)] = 2.0/3.0;
+      }
+      else {
+        dgv[CINDEX(i,j,6)] = -1.0/3.0;
+      }
+    }
+  }
+  for (int i=3; i<6; i++) {
+    dgv[CINDEX(i,i,6)] = 1.0;
+  }
+  double sdS[6];
+  for (int i=0; i<6; i++) {
+    sdS[i] = devS[i] * (3.0 / (2.0 * pow(j2,2.0)));
+  }
+  outer_update_minus(sdS, 6, mdS, 6, dgv);
+  for (int i=0; i<36; i++) {
+    dgv[i] *= 3.0/(2.0 * j2);
+  }
+
+  std::fill(res.dg_da.begin(), res.dg_da.end(), 0.0);
+  for (int i=0; i<6; i++) {
+    for (int j=0; j<6; j++) {
+      res.dg_da[CINDEX(i,(j+0),nh)] = -dgv[CINDEX(i,j,6)];
+      res.dg_da[CINDEX(i,(j+6),nh)] = -dgv[CINDEX(i,j,6)];
+    }
+  }
+
+  // Hardening rule
+  double C1i = C1(T);
+  double a1i = a10(T) - alpha[12];
+  double C2i = C2(T);
+  double a2i = a2(T);
+  double qi = q(T);
+  double di = d(T);
+
+  double nv[6];
+  for (int i=0; i<6; i++) {
+    nv[i] = 3.0/2.0 * devS[i] / j2;
+  }
+
+  double * hv = &res.h[0];
+  std::fill(hv, hv+nh, 0.0);
+  for (int i=0; i<6; i++) {
+    hv[i+0] = C1i * (2.0/3.0 * a1i * nv[i] - alpha[i+0]);
+    hv[i+6] = C2i * (2.0/3.0 * a2i * nv[i] - alpha[i+6]);
+  }
+  hv[12] = di*(qi - alpha[12]);
+
+  double * dhs = &res.dh_ds[0];
+  std::fill(dhs, dhs+nh*6, 0.0);
+  for (int i=0; i<6; i++) {
+    for (int j=0; j<6; j++) {
+      dhs[CINDEX((i+0),j,6)] = dgv[CINDEX(i,j,6)] * 2.0/3.0 * C1i * a1i;
+      dhs[CINDEX((i+6),j,6)] = dgv[CINDEX(i,j,6)] * 2.0/3.0 * C2i * a2i;
+    }
+  }
+
+  double * dha = &res.dh_da[0];
+  std::fill(dha, dha+(nh*nh), 0.0);
+  for (int i=0; i<6; i++) {
+    for (int j=0; j<nh; j++) {
+      dha[CINDEX((i+0),j,nh)] = 2.0/3.0 * a1i * res.dg_da[CINDEX(i,j,nh)];
+      dha[CINDEX((i+6),j,nh)] = 2.0/3.0 * a2i * res.dg_da[CINDEX(i,j,nh)];
+    }
+  }
+  for (int i=0; i<6; i++) {
+    dha[CINDEX((i+0),(i+0),nh)] -= 1.0;
+    dha[CINDEX((i+6),(i+6),nh)] -= 1.0;
+  }
+  for (int i=0; i<6; i++) {
+    for (int j=0; j<nh; j++) {
+      dha[CINDEX((i+0),j,nh)] *= C1i;
+      dha[CINDEX((i+6),j,nh)] *= C2i;
+    }
+  }
+  for (int i=0; i<6; i++) {
+    dha[CINDEX(i,12,nh)] -= C1i*2.0/3.0*nv[i];
+  }
+  dha[CINDEX(12,12,nh)] = -di;
+
+  // The sa evolution goes through the rate
+  double yi = res.y;
+  if (fabs(yi) > log_tol_) {
+    double Bi = B(T);
+    double sas = A(T) + Bi * log10(yi);
+    double bi;
+    if ((sas - alpha[13]) >= 0.0) {
+      bi = bh(T);
+    }
+    else {
+      bi = br(T);
+    }
+    if (sas > 0.0) {
+      hv[13] = bi * (sas - alpha[13]);
+      for (int i=0; i<6; i++) {
+        dhs[CINDEX(13,i,6)] = bi * Bi / (yi * log(10.0)) * res.dy_ds[i];
+      }
+      for (int i=0; i<nh; i++) {
+        dha[CINDEX(13,i,nh)] = bi * Bi / (yi * log(10.0)) * res.dy_da[i];
+      }
+    }
+    else {
+      // The saturated value is clipped at zero for the rate itself
+      if ((0.0 - alpha[13]) >= 0.0) {
+        hv[13] = bh(T) * (0.0 - alpha[13]);
+      }
+      else {
+        hv[13] = br(T) * (0.0 - alpha[13]);
+      }
+    }
+    dha[CINDEX(13,13,nh)] += -bi;
+  }
+
+  evaluate_g_rates_(s, alpha, T, res);
+  evaluate_h_rates_(s, alpha, T, res);
+}
+
 // Properties...
 
 double YaguchiGr91FlowRule::D(double T) const
@@ -178,6 +178,51 @@ PYBIND11_MODULE(visco_flow, m) {
             return f;
            }, "Hardening rule (temperature) derivative with respect to history.")
 
+      .def("evaluate",
+           [](ViscoPlasticFlowRule & m, py::array_t<double, py::array::c_style> s, py::array_t<double, py::array::c_style> alpha, double T) -> py::dict
+           {
+            ViscoPlasticEvaluation res;
+            m.evaluate(arr2ptr<double>(s), arr2ptr<double>(alpha), T, res);
+
+            size_t nh = m.nhist();
+            auto vec = [](const double * const v, size_t n) -> py::array_t<double>
+            {
+              auto f = alloc_vec<double>(n);
+              std::copy(v, v+n, arr2ptr<double>(f));
+              return f;
+            };
+            auto mat = [](const double * const v, size_t n, size_t k) -> py::array_t<double>
+            {
+              auto f = alloc_mat<double>(n,k);
+              std::copy(v, v+n*k, arr2ptr<double>(f));
+              return f;
+            };
+
+            py::dict d;
+            d["y"] = res.y;
+            d["dy_ds"] = vec(res.dy_ds, 6);
+            d["dy_da"] = vec(&res.dy_da[0], nh);
+            d["g"] = vec(res.g, 6);
+            d["dg_ds"] = mat(res.dg_ds, 6, 6);
+            d["dg_da"] = mat(&res.dg_da[0], 6, nh);
+            d["g_time"] = vec(res.g_time, 6);
+            d["dg_ds_time"] = mat(res.dg_ds_time, 6, 6);
+            d["dg_da_time"] = mat(&res.dg_da_time[0], 6, nh);
+            d["g_temp"] = vec(res.g_temp, 6);
+            d["dg_ds_temp"] = mat(res.dg_ds_temp, 6, 6);
+            d["dg_da_temp"] = mat(&res.dg_da_temp[0], 6, nh);
+            d["h"] = vec(&res.h[0], nh);
+            d["dh_ds"] = mat(&res.dh_ds[0], nh, 6);
+            d["dh_da"] = mat(&res.dh_da[0], nh, nh);
+            d["h_time"] = vec(&res.h_time[0], nh);
+            d["dh_ds_time"] = mat(&res.dh_ds_time[0], nh, 6);
+            d["dh_da_time"] = mat(&res.dh_da_time[0], nh, nh);
+            d["h_temp"] = vec(&res.h_temp[0], nh);
+            d["dh_ds_temp"] = mat(&res.dh_ds_temp[0], nh, 6);
+            d["dh_da_temp"] = mat(&res.dh_da_temp[0], nh, nh);
+            return d;
+           }, "Everything at once, as a dictionary keyed by the method names.")
+
       ;
 
   py::class_<GFlow, NEMLObject, std::shared_ptr<GFlow>>(m, "GFlow")
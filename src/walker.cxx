@@ -1492,11 +1492,58 @@ SymSymR4 WalkerKinematicHardening::dN_(VariableState & state)
 
 WrappedViscoPlasticFlowRule::WrappedViscoPlasticFlowRule(ParameterSet & params) :
     ViscoPlasticFlowRule(params),
-    stored_hist_(false)
+    stored_hist_(false),
+    dscalar_layout_(false),
+    dsymmetric_layout_(false),
+    dhistory_layout_(false),
+    hh_flat_(true)
 {
 
 }
 
+void WrappedViscoPlasticFlowRule::setup_hist_()
+{
+  populate_hist(stored_hist_);
+
+  // The layouts never change, so build the maps once and afterwards
+  // only point copies at the caller's memory
+  auto setup_layout = [](History & layout, const History & deriv)
+  {
+    layout.copy_maps(deriv);
+    layout.resize(deriv.size());
+  };
+  setup_layout(dscalar_layout_, stored_hist_.derivative<double>());
+  setup_layout(dsymmetric_layout_, stored_hist_.derivative<Symmetric>());
+  setup_layout(dhistory_layout_, stored_hist_.derivative<History>());
+
+  // Same logic as History::unravel_hh, but only done once
+  size_t m = stored_hist_.size();
+  hh_index_.resize(m * m);
+  for (auto n1 : stored_hist_.get_order()) {
+    size_t s1 = stored_hist_.size_of_entry(n1);
+    size_t o1 = stored_hist_.get_loc().at(n1);
+    for (auto n2 : stored_hist_.get_order()) {
+      size_t s2 = stored_hist_.size_of_entry(n2);
+      size_t o2 = stored_hist_.get_loc().at(n2);
+      size_t k = dhistory_layout_.get_loc().at(n1 + "_" + n2);
+      for (size_t i = 0; i < s1; i++) {
+        for (size_t j = 0; j < s2; j++) {
+          hh_index_[k] = CINDEX(o1+i,o2+j,m);
+          k++;
+        }
+      }
+    }
+  }
+
+  hh_flat_ = true;
+  for (size_t k = 0; k < hh_index_.size(); k++) {
+    if (hh_index_[k] != k) {
+      hh_flat_ = false;
+      break;
+    }
+  }
+}
+
 History WrappedViscoPlasticFlowRule::blank_hist_() const
 {
   return stored_hist_;
@@ -1523,15 +1570,47 @@ History WrappedViscoPlasticFlowRule::gather_hist_(const double * const h) const
   return hv;
 }
 
+template <>
+const History & WrappedViscoPlasticFlowRule::derivative_layout_<double>() const
+{
+  return dscalar_layout_;
+}
+
+template <>
+const History & WrappedViscoPlasticFlowRule::derivative_layout_<Symmetric>() const
+{
+  return dsymmetric_layout_;
+}
+
+template <>
+const History & WrappedViscoPlasticFlowRule::derivative_layout_<History>() const
+{
+  return dhistory_layout_;
+}
+
+void WrappedViscoPlasticFlowRule::unravel_hh_(const double * const wrapped,
+                                              double * const flat) const
+{
+  for (size_t k = 0; k < hh_index_.size(); k++)
+    flat[hh_index_[k]] = wrapped[k];
+}
+
 State WrappedViscoPlasticFlowRule::make_state_(const double * const s, const double *
                                                const alpha, double T) const
 {
+  // Both the stress and the history are views of the caller's data
   return State(Symmetric(s), gather_hist_(alpha), T);
 }
 
+std::shared_ptr<const StateCache> WrappedViscoPlasticFlowRule::cache_state_(
+    const State & state) const
+{
+  return nullptr;
+}
+
 size_t WrappedViscoPlasticFlowRule::nhist() const
 {
-  return blank_hist_().size();
+  return stored_hist_.size();
 }
 
 void WrappedViscoPlasticFlowRule::init_hist(double * const h) const
@@ -1584,14 +1663,14 @@ void WrappedViscoPlasticFlowRule::dg_da(const double * const s, const double * c
              double * const dgv) const
 {
   // This is transposed and it does matter
-  double * temp = new double [nhist() * 6];
-  History res = gather_derivative_<Symmetric>(temp);
+  size_t nh = nhist();
+  std::vector<double> temp(nh * 6);
+  History res = gather_derivative_<Symmetric>(&temp[0]);
   dg_da(make_state_(s, alpha, T), res);
-  
-  for (size_t i = 0; i < nhist(); i++)
+
+  for (size_t i = 0; i < nh; i++)
     for (size_t j = 0; j < 6; j++)
-      dgv[CINDEX(j,i,nhist())] = temp[CINDEX(i,j,6)];
-  delete [] temp;
+      dgv[CINDEX(j,i,nh)] = temp[CINDEX(i,j,6)];
 }
 
 // Hardening rule
@@ -1612,15 +1691,17 @@ void WrappedViscoPlasticFlowRule::dh_ds(const double * const s, const double * c
 void WrappedViscoPlasticFlowRule::dh_da(const double * const s, const double * const alpha, double T,
               double * const dhv) const
 {
-  // Very messed up
-  double * temp = new double[nhist() * nhist()];
-  History res = gather_derivative_<History>(temp);
+  // Very messed up, unless everything is a scalar
+  if (hh_flat_) {
+    History res = gather_derivative_<History>(dhv);
+    dh_da(make_state_(s, alpha, T), res);
+    return;
+  }
 
+  std::vector<double> temp(hh_index_.size());
+  History res = gather_derivative_<History>(&temp[0]);
   dh_da(make_state_(s, alpha, T), res);
-
-  res.unravel_hh(blank_hist_(), dhv);
-
-  delete [] temp;
+  unravel_hh_(&temp[0], dhv);
 }
 
 // Hardening rule wrt time
@@ -1651,15 +1732,17 @@ void WrappedViscoPlasticFlowRule::dh_ds_time(const State & state, History & res)
 void WrappedViscoPlasticFlowRule::dh_da_time(const double * const s, const double * const alpha, double T,
               double * const dhv) const
 {
-  // Very messed up
-  double * temp = new double[nhist() * nhist()];
-  History res = gather_derivative_<History>(temp);
+  // Very messed up, unless everything is a scalar
+  if (hh_flat_) {
+    History res = gather_derivative_<History>(dhv);
+    dh_da_time(make_state_(s, alpha, T), res);
+    return;
+  }
 
+  std::vector<double> temp(hh_index_.size());
+  History res = gather_derivative_<History>(&temp[0]);
   dh_da_time(make_state_(s, alpha, T), res);
-
-  res.unravel_hh(blank_hist_(), dhv);
-
-  delete [] temp;
+  unravel_hh_(&temp[0], dhv);
 }
 
 void WrappedViscoPlasticFlowRule::dh_da_time(const State & state, History & res) const
@@ -1704,6 +1787,70 @@ void WrappedViscoPlasticFlowRule::dh_da_temp(const State & state, History & res)
   res.zero();
 }
 
+// Everything at once, wrapping the raw pointers only one time
+void WrappedViscoPlasticFlowRule::evaluate(const double * const s,
+                                           const double * const alpha,
+                                           double T,
+                                           ViscoPlasticEvaluation & res) const
+{
+  size_t nh = nhist();
+  res.resize(nh);
+
+  State state = make_state_(s, alpha, T);
+  state.cache = cache_state_(state);
+
+  // Scratch for the blocks that need reordering
+  std::vector<double> temp(nh * std::max(nh, (size_t) 6));
+
+  // One view per layout, pointed at each output block in turn
+  History hv = gather_hist_(&res.h[0]);
+  History dya = gather_derivative_<double>(&res.dy_da[0]);
+  History dsv = gather_derivative_<Symmetric>(&temp[0]);
+  History dhv = gather_derivative_<History>(hh_flat_ ? &res.dh_da[0] : &temp[0]);
+
+  // Rate
+  y(state, res.y);
+  Symmetric dy(res.dy_ds);
+  dy_ds(state, dy);
+  dy_da(state, dya);
+
+  // Flow rule
+  Symmetric gv(res.g);
+  g(state, gv);
+  SymSymR4 dgs(res.dg_ds);
+  dg_ds(state, dgs);
+  dg_da(state, dsv);
+  for (size_t i = 0; i < nh; i++)
+    for (size_t j = 0; j < 6; j++)
+      res.dg_da[CINDEX(j,i,nh)] = temp[CINDEX(i,j,6)];
+
+  // Hardening
+  h(state, hv);
+  dsv.set_data(&res.dh_ds[0]);
+  dh_ds(state, dsv);
+  dh_da(state, dhv);
+  if (! hh_flat_) unravel_hh_(&temp[0], &res.dh_da[0]);
+
+  // Hardening wrt time
+  hv.set_data(&res.h_time[0]);
+  h_time(state, hv);
+  dsv.set_data(&res.dh_ds_time[0]);
+  dh_ds_time(state, dsv);
+  if (hh_flat_) dhv.set_data(&res.dh_da_time[0]);
+  dh_da_time(state, dhv);
+  if (! hh_flat_) unravel_hh_(&temp[0], &res.dh_da_time[0]);
+
+  // Hardening wrt temperature
+  hv.set_data(&res.h_temp[0]);
+  h_temp(state, hv);
+  dsv.set_data(&res.dh_ds_temp[0]);
+  dh_ds_temp(state, dsv);
+  dhv.set_data(&res.dh_da_temp[0]);
+  dh_da_temp(state, dhv);
+
+  evaluate_g_rates_(s, alpha, T, res);
+}
+
 TestFlowRule::TestFlowRule(ParameterSet & params)
   : WrappedViscoPlasticFlowRule(params), 
     eps0_(params.get_parameter<double>("eps0")), 
@@ -1712,7 +1859,7 @@ TestFlowRule::TestFlowRule(ParameterSet & params)
     s0_(params.get_parameter<double>("s0")), 
     K_(params.get_parameter<double>("K"))
 {
-  populate_hist(stored_hist_);
+  setup_hist_();
 }
 
 std::string TestFlowRule::type()
@@ -1851,7 +1998,7 @@ WalkerFlowRule::WalkerFlowRule(ParameterSet & params) :
     X->set_scaling(scaling_);
   }
 
-  populate_hist(stored_hist_);
+  setup_hist_();
 }
 
 std::string WalkerFlowRule::type()
@@ -1903,100 +2050,47 @@ void WalkerFlowRule::initialize_hist(History & h) const
 
 void WalkerFlowRule::y(const State & state, double & res) const
 {
-  res = prefactor_(state) * flow_(state);
+  res = kinetics_(state, false)->y;
 }
 
 void WalkerFlowRule::dy_ds(const State & state, Symmetric & res) const
 {
-  Symmetric d = state.S.dev() - TX_(state);
-  if (d.norm() == 0)
-    res = Symmetric::zero();
-  else
-    res = prefactor_(state) * dflow_(state) * 
-        std::sqrt(3.0/2.0)/(state.h.get<double>("D") * d.norm()) * 
-        SymSymR4::id_dev().dot(d);
+  res = kinetics_(state)->dy_ds;
 }
 
 void WalkerFlowRule::dy_da(const State & state, History & res) const
 {
-  // These are very annoying because it covers all the history variables...
-  
-  // alpha
-  res.get<double>("alpha") = eps0_->value(state.T) * 
-      softening_->dphi(state.h.get<double>("alpha"), state.T) * 
-      scaling_->value(state.T) * flow_(state);
-
-  // R
-  double D = state.h.get<double>("D");
-  double D0 = D_->D_0(state.T);
-  double Dx = D_->D_xi(state.T);
-  double m = m_->value(state.T);
-
-  double Dr = 1.0e-8;
-  if ((D - D0) > 0) Dr = (D-D0)/Dx;
-  
-  res.get<double>("R") = -prefactor_(state) * dflow_(state) * 
-      std::pow(Dr, m) / D;
-
-  // D
-  Symmetric d = state.S.dev() - TX_(state);
-  double k = k_->value(state.T);
-  double R = state.h.get<double>("R");
-  double p1 = -(k + R) * m * std::pow(Dr, m-1.0) / (Dx*D);
-  double p2 = -(std::sqrt(3.0/2.0) * d.norm() - (k + R) * std::pow(Dr, m)) / (D*D);
-
-  res.get<double>("D") = prefactor_(state) * dflow_(state) * 
-      (p1 + p2);
-
-  // The backstresses
-  for (auto X : X_)
-    if (d.norm() == 0) {
-      res.get<Symmetric>(X->name()) = Symmetric::zero();
-    }
-    else {
-      res.get<Symmetric>(X->name()) = -prefactor_(state) * dflow_(state) * 
-          std::sqrt(3.0/2.0)/(state.h.get<double>("D") * d.norm()) * d;
-    }
+  dy_da_(*kinetics_(state), res);
 }
 
 void WalkerFlowRule::g(const State & state, Symmetric & res) const
 {
-  Symmetric d = state.S.dev() - TX_(state);
-  if (d.norm() == 0)
-    res = Symmetric::zero();
-  else
-    res = 3.0/2.0 * d / (std::sqrt(3.0/2.0) * d.norm());
+  res = kinetics_(state, false)->g;
 }
 
 void WalkerFlowRule::dg_ds(const State & state, SymSymR4 & res) const
 {
-  SymSymR4 G = G_(state);
-  res = G.dot(SymSymR4::id_dev());
+  res = kinetics_(state)->dg_ds;
 }
 
 void WalkerFlowRule::dg_da(const State & state, History & res) const
 {
-  res.get<Symmetric>("alpha") = Symmetric::zero();
-  res.get<Symmetric>("R") = Symmetric::zero();
-  res.get<Symmetric>("D") = Symmetric::zero();
-
-  SymSymR4 G = G_(state);
-  for (auto X : X_)
-    res.get<SymSymR4>(X->name()) = -G;
+  dg_da_(*kinetics_(state), res);
 }
 
 void WalkerFlowRule::h(const State & state, History & res) const
 {
   // Scalar variables
+  auto kin = kinetics_(state, false);
   res.get<double>("alpha") = 1.0;
-  auto ss = scalar_state_(state);
-  ss.h = state.h.get<double>("R");
+  auto ss = kin->ss;
+  ss.h = kin->R;
   res.get<double>("R") = R_->ratep(ss);
-  ss.h = state.h.get<double>("D");
+  ss.h = kin->D;
   res.get<double>("D") = D_->ratep(ss);
   
   // Backstresses
-  auto Ss = symmetric_state_(state);
+  auto Ss = kin->Ss;
   for (auto X : X_) {
     Ss.h.copy_data(state.h.get<Symmetric>(X->name()).data());
     res.get<Symmetric>(X->name()) = X->ratep(Ss);
@@ -2010,29 +2104,28 @@ void WalkerFlowRule::dh_ds(const State & state, History & res) const
   res.get<Symmetric>("alpha") = Symmetric::zero();
   
   // Common junk
-  Symmetric dy;
-  dy_ds(state, dy);
-  SymSymR4 dg;
-  dg_ds(state, dg);
+  auto kin = kinetics_(state);
+  const Symmetric & dy = kin->dy_ds;
+  const SymSymR4 & dg = kin->dg_ds;
 
-  auto ss = scalar_state_(state);  
+  auto ss = kin->ss;
 
   // R
-  ss.h = state.h.get<double>("R");
+  ss.h = kin->R;
   res.get<Symmetric>("R") = 
         R_->d_ratep_d_s(ss) 
       + R_->d_ratep_d_adot(ss) * dy
       + dg.dot(R_->d_ratep_d_g(ss)).transpose();
 
   // D
-  ss.h = state.h.get<double>("D");
+  ss.h = kin->D;
   res.get<Symmetric>("D") = 
         D_->d_ratep_d_s(ss) 
       + D_->d_ratep_d_adot(ss) * dy
       + dg.dot(D_->d_ratep_d_g(ss)).transpose();
 
   // Backstresses
-  auto Ss = symmetric_state_(state);
+  auto Ss = kin->Ss;
   for (auto X : X_) {
     Ss.h.copy_data(state.h.get<Symmetric>(X->name()).data());
     res.get<SymSymR4>(X->name()) = 
@@ -2047,23 +2140,25 @@ void WalkerFlowRule::dh_da(const State & state, History & res) const
   // Well this is the worst...
   
   // Common stuff we need...
+  auto kin = kinetics_(state);
+
   History dy = blank_derivative_<double>();
-  dy_da(state, dy);
+  dy_da_(*kin, dy);
 
   History dg = blank_derivative_<Symmetric>();
-  dg_da(state, dg);
+  dg_da_(*kin, dg);
 
   // Make sure the result starts out as zero
   res.zero();
 
   // Scalar variables
-  auto ss = scalar_state_(state);
+  auto ss = kin->ss;
 
   // Alpha
   // (zero)
 
   // R
-  ss.h = state.h.get<double>("R");
+  ss.h = kin->R;
   // a
   res.get<double>("R_alpha") =
         R_->d_ratep_d_a(ss)
@@ -2087,7 +2182,7 @@ void WalkerFlowRule::dh_da(const State & state, History & res) const
   }
 
   // D
-  ss.h = state.h.get<double>("D");
+  ss.h = kin->D;
   // a
   res.get<double>("D_alpha") =
         D_->d_ratep_d_a(ss)
@@ -2110,7 +2205,7 @@ void WalkerFlowRule::dh_da(const State & state, History & res) const
   }
 
   // And the backstresses...
-  auto Ss = symmetric_state_(state);
+  auto Ss = kin->Ss;
   for (auto X : X_) {
     Ss.h.copy_data(state.h.get<Symmetric>(X->name()).data()); 
     // a
@@ -2145,15 +2240,16 @@ void WalkerFlowRule::dh_da(const State & state, History & res) const
 void WalkerFlowRule::h_time(const State & state, History & res) const
 {
   // Scalar variables
+  auto kin = kinetics_(state, false);
   res.get<double>("alpha") = 0.0;
-  auto ss = scalar_state_(state);
-  ss.h = state.h.get<double>("R");
+  auto ss = kin->ss;
+  ss.h = kin->R;
   res.get<double>("R") = R_->ratet(ss);
-  ss.h = state.h.get<double>("D");
+  ss.h = kin->D;
   res.get<double>("D") = D_->ratet(ss);
   
   // Backstresses
-  auto Ss = symmetric_state_(state);
+  auto Ss = kin->Ss;
   for (auto X : X_) {
     Ss.h.copy_data(state.h.get<Symmetric>(X->name()).data());
     res.get<Symmetric>(X->name()) = X->ratet(Ss);
@@ -2167,29 +2263,28 @@ void WalkerFlowRule::dh_ds_time(const State & state, History & res) const
   res.get<Symmetric>("alpha") = Symmetric::zero();
   
   // Common junk
-  Symmetric dy;
-  dy_ds(state, dy);
-  SymSymR4 dg;
-  dg_ds(state, dg);
+  auto kin = kinetics_(state);
+  const Symmetric & dy = kin->dy_ds;
+  const SymSymR4 & dg = kin->dg_ds;
 
-  auto ss = scalar_state_(state);  
+  auto ss = kin->ss;
 
   // R
-  ss.h = state.h.get<double>("R");
+  ss.h = kin->R;
   res.get<Symmetric>("R") = 
         R_->d_ratet_d_s(ss) 
       + R_->d_ratet_d_adot(ss) * dy
       + dg.dot(R_->d_ratet_d_g(ss)).transpose();
 
   // D
-  ss.h = state.h.get<double>("D");
+  ss.h = kin->D;
   res.get<Symmetric>("D") = 
         D_->d_ratet_d_s(ss) 
       + D_->d_ratet_d_adot(ss) * dy
       + dg.dot(D_->d_ratet_d_g(ss)).transpose();
 
   // Backstresses
-  auto Ss = symmetric_state_(state);
+  auto Ss = kin->Ss;
   for (auto X : X_) {
     Ss.h.copy_data(state.h.get<Symmetric>(X->name()).data());
     res.get<SymSymR4>(X->name()) = 
@@ -2204,23 +2299,25 @@ void WalkerFlowRule::dh_da_time(const State & state, History & res) const
   // Well this is the worst...
   
   // Common stuff we need...
+  auto kin = kinetics_(state);
+
   History dy = blank_derivative_<double>();
-  dy_da(state, dy);
+  dy_da_(*kin, dy);
 
   History dg = blank_derivative_<Symmetric>();
-  dg_da(state, dg);
+  dg_da_(*kin, dg);
 
   // Make sure the result starts out as zero
   res.zero();
 
   // Scalar variables
-  auto ss = scalar_state_(state);
+  auto ss = kin->ss;
 
   // Alpha
   // (zero)
 
   // R
-  ss.h = state.h.get<double>("R");
+  ss.h = kin->R;
   // a
   res.get<double>("R_alpha") =
         R_->d_ratet_d_a(ss)
@@ -2244,7 +2341,7 @@ void WalkerFlowRule::dh_da_time(const State & state, History & res) const
   }
 
   // D
-  ss.h = state.h.get<double>("D");
+  ss.h = kin->D;
   // a
   res.get<double>("D_alpha") =
         D_->d_ratet_d_a(ss)
@@ -2267,7 +2364,7 @@ void WalkerFlowRule::dh_da_time(const State & state, History & res) const
   }
 
   // And the backstresses...
-  auto Ss = symmetric_state_(state);
+  auto Ss = kin->Ss;
   for (auto X : X_) {
     Ss.h.copy_data(state.h.get<Symmetric>(X->name()).data()); 
     // a
@@ -2307,81 +2404,155 @@ Symmetric WalkerFlowRule::TX_(const State & state) const
   return res;
 }
 
-ScalarInternalVariable::VariableState WalkerFlowRule::scalar_state_(
+std::shared_ptr<const StateCache> WalkerFlowRule::cache_state_(
     const State & state) const
 {
-  ScalarInternalVariable::VariableState vstate;
-
-  vstate.a = state.h.get<double>("alpha");
-  y(state, vstate.adot);
-  vstate.D = state.h.get<double>("D");
-  vstate.s = state.S;
-  g(state, vstate.g);
-  vstate.T = state.T;
-
-  return vstate;
+  auto kin = std::make_shared<WalkerKinetics>();
+  rate_kinetics_(state, *kin);
+  derivative_kinetics_(*kin);
+  return kin;
 }
 
-SymmetricInternalVariable::VariableState WalkerFlowRule::symmetric_state_(
-    const State & state) const
+std::shared_ptr<const WalkerKinetics> WalkerFlowRule::kinetics_(
+    const State & state, bool derivatives) const
 {
-  SymmetricInternalVariable::VariableState vstate;
-  
-  vstate.a = state.h.get<double>("alpha");
-  y(state, vstate.adot);
-  vstate.D = state.h.get<double>("D");
-  vstate.s = state.S;
-  g(state, vstate.g);
-  vstate.T = state.T;
+  auto kin = std::dynamic_pointer_cast<const WalkerKinetics>(state.cache);
+  if (kin) return kin;
 
-  return vstate;
+  // Without a cache only compute what the caller needs
+  auto res = std::make_shared<WalkerKinetics>();
+  rate_kinetics_(state, *res);
+  if (derivatives) derivative_kinetics_(*res);
+  return res;
 }
 
-double WalkerFlowRule::prefactor_(const State & state) const
+void WalkerFlowRule::rate_kinetics_(const State & state,
+                                    WalkerKinetics & kin) const
 {
-  return eps0_->value(state.T) * 
-      softening_->phi(state.h.get<double>("alpha"), state.T) * 
-      scaling_->value(state.T);
-}
+  double T = state.T;
 
-double WalkerFlowRule::flow_(const State & state) const
-{
-  Symmetric d = state.S.dev() - TX_(state);
-  double Y = Y_(state);
-  double h = (std::sqrt(3.0/2.0) * d.norm() - Y) / state.h.get<double>("D");
-  if (h <= 0.0)
-    return 0.0;
-  else
-    return std::pow(std::fabs(h), n_->value(state.T));
+  // History
+  kin.alpha = state.h.get<double>("alpha");
+  kin.R = state.h.get<double>("R");
+  kin.D = state.h.get<double>("D");
+
+  // Temperature dependent parameters
+  kin.eps0 = eps0_->value(T);
+  kin.phi = softening_->phi(kin.alpha, T);
+  kin.dphi = softening_->dphi(kin.alpha, T);
+  kin.scale = scaling_->value(T);
+  kin.n = n_->value(T);
+  kin.k = k_->value(T);
+  kin.m = m_->value(T);
+  kin.D0 = D_->D_0(T);
+  kin.Dx = D_->D_xi(T);
+
+  // The prefactor part of the scalar flow rate (Walker's alpha)
+  kin.prefactor = kin.eps0 * kin.phi * kin.scale;
+
+  // Effective stress
+  kin.d = state.S.dev() - TX_(state);
+  kin.nd = kin.d.norm();
+
+  // The actual threshold stress (Walker's Y)
+  double xi = (kin.D - kin.D0) / kin.Dx;
+  if (xi < 0.0) xi = 0.0;
+  kin.Y = (kin.k + kin.R) * std::pow(xi, kin.m);
+
+  // The flow rule (Walker's h) and its derivative
+  double h = (std::sqrt(3.0/2.0) * kin.nd - kin.Y) / kin.D;
+  if (h <= 0.0) {
+    kin.flow = 0.0;
+    kin.dflow = 0.0;
+  }
+  else {
+    kin.flow = std::pow(std::fabs(h), kin.n);
+    kin.dflow = kin.n * std::pow(std::fabs(h), kin.n-1.0);
+  }
+
+  // Rate and flow direction
+  kin.y = kin.prefactor * kin.flow;
+  if (kin.nd == 0.0) {
+    kin.g = Symmetric::zero();
+  }
+  else {
+    kin.g = 3.0/2.0 * kin.d / (std::sqrt(3.0/2.0) * kin.nd);
+  }
+
+  // States for the internal variables, the history value is set by the user
+  kin.ss.a = kin.alpha;
+  kin.ss.adot = kin.y;
+  kin.ss.D = kin.D;
+  kin.ss.s = state.S;
+  kin.ss.g = kin.g;
+  kin.ss.T = T;
+
+  kin.Ss.a = kin.alpha;
+  kin.Ss.adot = kin.y;
+  kin.Ss.D = kin.D;
+  kin.Ss.s = state.S;
+  kin.Ss.g = kin.g;
+  kin.Ss.T = T;
 }
 
-double WalkerFlowRule::dflow_(const State & state) const
+void WalkerFlowRule::derivative_kinetics_(WalkerKinetics & kin) const
 {
-  Symmetric d = state.S.dev() - TX_(state);
-  double Y = Y_(state);
-  double h = (std::sqrt(3.0/2.0) * d.norm() - Y) / state.h.get<double>("D");
-  if (h <= 0.0)
-    return 0.0;
-  else
-    return n_->value(state.T) * std::pow(std::fabs(h), n_->value(state.T)-1.0);
+  if (kin.nd == 0.0) {
+    kin.dy_ds = Symmetric::zero();
+    kin.G = SymSymR4::id();
+  }
+  else {
+    kin.dy_ds = kin.prefactor * kin.dflow *
+        std::sqrt(3.0/2.0)/(kin.D * kin.nd) *
+        SymSymR4::id_dev().dot(kin.d);
+    kin.G = std::sqrt(3.0/2.0) / kin.nd * (SymSymR4::id() -
+                                           douter(kin.d/kin.nd,
+                                                  kin.d/kin.nd));
+  }
+  kin.dg_ds = kin.G.dot(SymSymR4::id_dev());
 }
 
-double WalkerFlowRule::Y_(const State & state) const
+void WalkerFlowRule::dy_da_(const WalkerKinetics & kin, History & res) const
 {
-  double xi = (state.h.get<double>("D") - D_->D_0(state.T)) / D_->D_xi(state.T);
-  if (xi < 0.0) xi = 0.0;
-  return (k_->value(state.T) + state.h.get<double>("R")) * std::pow(xi,
-                                                                    m_->value(state.T));
+  // These are very annoying because it covers all the history variables...
+
+  // alpha
+  res.get<double>("alpha") = kin.eps0 * kin.dphi * kin.scale * kin.flow;
+
+  // R
+  double Dr = 1.0e-8;
+  if ((kin.D - kin.D0) > 0) Dr = (kin.D - kin.D0) / kin.Dx;
+
+  res.get<double>("R") = -kin.prefactor * kin.dflow *
+      std::pow(Dr, kin.m) / kin.D;
+
+  // D
+  double p1 = -(kin.k + kin.R) * kin.m * std::pow(Dr, kin.m-1.0) /
+      (kin.Dx * kin.D);
+  double p2 = -(std::sqrt(3.0/2.0) * kin.nd - (kin.k + kin.R) *
+                std::pow(Dr, kin.m)) / (kin.D * kin.D);
+
+  res.get<double>("D") = kin.prefactor * kin.dflow * (p1 + p2);
+
+  // The backstresses
+  for (auto X : X_)
+    if (kin.nd == 0) {
+      res.get<Symmetric>(X->name()) = Symmetric::zero();
+    }
+    else {
+      res.get<Symmetric>(X->name()) = -kin.prefactor * kin.dflow *
+          std::sqrt(3.0/2.0)/(kin.D * kin.nd) * kin.d;
+    }
 }
 
-SymSymR4 WalkerFlowRule::G_(const State & state) const
+void WalkerFlowRule::dg_da_(const WalkerKinetics & kin, History & res) const
 {
-  Symmetric d = state.S.dev() - TX_(state);
-  double nd = d.norm();
-  if (nd == 0.0)
-    return SymSymR4::id();
-  else
-    return std::sqrt(3.0/2.0) / nd * (SymSymR4::id() - douter(d/nd, d/nd));
+  res.get<Symmetric>("alpha") = Symmetric::zero();
+  res.get<Symmetric>("R") = Symmetric::zero();
+  res.get<Symmetric>("D") = Symmetric::zero();
+
+  for (auto X : X_)
+    res.get<SymSymR4>(X->name()) = -kin.G;
 }
 
 void WalkerFlowRule::override_guess(double * const x)
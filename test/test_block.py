@@ -2,6 +2,8 @@ import sys
 sys.path.append('..')
 
 from neml import models, block, elasticity, surfaces, hardening, ri_flow
+from neml.cp import crystallography, slipharden, sliprules, inelasticity, kinematics, singlecrystal, polycrystal
+from neml.math import rotations
 from common import *
 
 import unittest
@@ -62,6 +64,95 @@ class TestBlockEvaluate(unittest.TestCase):
       self.assertTrue(np.isclose(u_np1[i], u))
       self.assertTrue(np.isclose(p_np1[i], p))
 
+class TestBlockTaylor(unittest.TestCase):
+  """
+    Each point of the block is a polycrystal, so the grains are nested
+    tasks under the points
+  """
+  def setUp(self):
+    strength = slipharden.VoceSlipHardening(50.0, 2.5, 10.0)
+    slip = sliprules.PowerLawSlipRule(strength, 1.0, 3.0)
+    imodel = inelasticity.AsaroInelasticity(slip)
+    emodel = elasticity.CubicLinearElasticModel(120000.0, 0.3, 29000.0,
+        "moduli")
+    kmodel = kinematics.StandardKinematicModel(emodel, imodel)
+
+    L = crystallography.CubicLattice(1.0)
+    L.add_slip_system([1,1,0],[1,1,1])
+
+    # No substepping, so a large enough step fails
+    single = singlecrystal.SingleCrystalModel(kmodel, L, max_divide = 0)
+    qs = [rotations.Orientation(35.0 * i, 17.0 * i**2, 14.0 * i + 5.0,
+      angle_type = "degrees") for i in range(4)]
+    self.model = polycrystal.TaylorModel(single, qs)
+
+    self.nblock = 6
+
+  def evaluate(self, e_np1):
+    e_n = np.zeros((self.nblock,3,3))
+    T_np1 = np.ones((self.nblock,)) * 300.0
+    T_n = np.ones((self.nblock,)) * 300.0
+    t_np1 = 1.0
+    t_n = 0.0
+    s_np1 = np.zeros((self.nblock,3,3))
+    s_n = np.zeros((self.nblock,3,3))
+    h_np1 = np.zeros((self.nblock, self.model.nstore))
+    h_n = np.array([self.model.init_store() for i in range(self.nblock)])
+    A_np1 = np.zeros((self.nblock,3,3,3,3))
+    u_np1 = np.zeros((self.nblock,))
+    u_n = np.zeros((self.nblock,))
+    p_np1 = np.zeros((self.nblock,))
+    p_n = np.zeros((self.nblock,))
+
+    block.block_evaluate(self.model,
+        e_np1, e_n, T_np1, T_n, t_np1, t_n, s_np1, s_n, h_np1, h_n,
+        A_np1, u_np1, u_n, p_np1, p_n)
+
+    serial = []
+    for i in range(self.nblock):
+      try:
+        serial.append(self.model.update_sd(
+            sym(e_np1[i]), sym(e_n[i]), T_np1[i], T_n[i],
+            t_np1, t_n, sym(s_n[i]), h_n[i], u_n[i], p_n[i]))
+      except RuntimeError:
+        serial.append(None)
+
+    return (s_np1, h_np1, A_np1, u_np1, p_np1), serial
+
+  def strains(self):
+    e_np1 = np.zeros((self.nblock,3,3))
+    e_np1[:,0,0] = np.linspace(0.002, 0.012, self.nblock)
+    e_np1[:,1,1] = -0.5 * e_np1[:,0,0]
+    return e_np1
+
+  def test_nested(self):
+    (s_np1, h_np1, A_np1, u_np1, p_np1), serial = self.evaluate(
+        self.strains())
+
+    for i in range(self.nblock):
+      s, h, A, u, p = serial[i]
+      self.assertTrue(np.allclose(usym(s), s_np1[i]))
+      self.assertTrue(np.allclose(h, h_np1[i]))
+      self.assertTrue(np.allclose(ms2ts(A), A_np1[i]))
+      self.assertTrue(np.isclose(u_np1[i], u))
+      self.assertTrue(np.isclose(p_np1[i], p))
+
+  def test_failing_point(self):
+    e_np1 = self.strains()
+    e_np1[3,0,0] = 5.0
+
+    # The failure in one point's grains is caught, not fatal
+    (s_np1, h_np1, A_np1, u_np1, p_np1), serial = self.evaluate(e_np1)
+
+    self.assertIsNone(serial[3])
+    for i in range(self.nblock):
+      if i == 3:
+        continue
+      s, h, A, u, p = serial[i]
+      self.assertTrue(np.allclose(h, h_np1[i]))
+      self.assertTrue(np.isclose(u_np1[i], u))
+      self.assertTrue(np.isclose(p_np1[i], p))
+
 mandel = ((0,0),(1,1),(2,2),(1,2),(0,2),(0,1))
 mandel_mults = (1,1,1,np.sqrt(2),np.sqrt(2),np.sqrt(2))
 
@@ -64,6 +64,18 @@ class TestBatch(unittest.TestCase):
     for q1,q2 in zip(self.orientations,nq):
       self.assertTrue(np.allclose(q1.quat,q2.quat))
 
+  def test_batch_set_get_array(self):
+    H = batch.init_history_batch(self.model, self.N)
+    Q = np.array([q.quat for q in self.orientations])
+
+    batch.set_orientation_passive_batch(self.model, H, Q)
+
+    self.assertTrue(np.allclose(batch.get_orientation_passive_array(
+      self.model, H), Q))
+    for q1,q2 in zip(self.orientations, 
+        batch.get_orientation_passive_batch(self.model, H)):
+      self.assertTrue(np.allclose(q1.quat,q2.quat))
+
   def test_batch_no_threads(self):
     self.batch_run(1)
 
@@ -99,3 +111,12 @@ class TestBatch(unittest.TestCase):
 
     self.assertTrue(np.allclose(s_np1, other_s_np1))
 
+    # Skipping the tangent should not change the update
+    s_nt, h_nt, A_nt, B_nt, u_nt, p_nt = batch.evaluate_crystal_batch(
+        self.model, d_np1, d_n, w_np1, w_n, T_np1, T_n, self.dt, 0.0,
+        s_n, h_n, u_n, p_n, nthreads = nthreads, tangent = False)
+
+    self.assertTrue(np.allclose(s_nt, s_np1))
+    self.assertTrue(np.allclose(h_nt, h_np1))
+    self.assertTrue(np.allclose(A_nt, 0.0))
+
@@ -315,6 +315,18 @@ class TestCubicFCC(unittest.TestCase, LTests, ShearTests, SlipTest):
 
     self.correct_numbers = [12,]
 
+  def test_add_after_rotate(self):
+    # The rotated systems are cached, adding a system has to refresh them
+    self.lattice.M(0,0,self.Q)
+    self.lattice.add_slip_system([1,1,1],[1,1,0])
+    self.assertEqual(self.lattice.ngroup, 2)
+    for j in range(self.lattice.nslip(1)):
+      self.assertEqual(
+          tensors.Symmetric(
+            np.dot(self.QM,np.dot(np.outer(self.lattice.slip_directions[1][j].data,
+              self.lattice.slip_planes[1][j].data), self.QM.T))),
+            self.lattice.M(1,j,self.Q))
+
   def test_planes(self):
     self.assertEqual(self.lattice.nplanes, 4)
     for i in range(12):
@@ -306,6 +306,55 @@ class TestComplicatedCrystal(unittest.TestCase, CommonTangents, CommonSolver):
   def test_nhist(self):
     self.assertEqual(self.model.nstore, 10)
 
+class TestStaggeredCrystal(TestComplicatedCrystal):
+  def setUp(self):
+    super().setUp()
+
+    self.monolithic = self.model
+    self.model = singlecrystal.SingleCrystalModel(self.kmodel, self.L, 
+        initial_rotation = self.Q, integration = "staggered")
+    self.model_no_rot = singlecrystal.SingleCrystalModel(self.kmodel, self.L,
+        initial_rotation = self.Q, update_rotation = False, verbose = False,
+        integration = "staggered")
+
+  def test_bad_integration(self):
+    with self.assertRaises(Exception):
+      singlecrystal.SingleCrystalModel(self.kmodel, self.L, 
+          integration = "explicit")
+
+  def test_matches_monolithic(self):
+    d_n = np.zeros((6,))
+    w_n = np.zeros((3,))
+    s_n = np.zeros((6,))
+    h_n = self.model.init_store()
+    t_n = 0.0
+    u_n = 0.0
+    p_n = 0.0
+
+    for i in range(self.nsteps):
+      t_np1 = t_n + self.dt
+      d_np1 = d_n + self.Ddir * self.dt
+      w_np1 = w_n + self.Wdir * self.dt
+
+      s_m, h_m, A_m, B_m, u_m, p_m = self.monolithic.update_ld_inc(
+          d_np1, d_n, w_np1, w_n, self.T, self.T, t_np1, t_n, s_n, h_n,
+          u_n, p_n)
+      s_np1, h_np1, A_np1, B_np1, u_np1, p_np1 = self.model.update_ld_inc(
+          d_np1, d_n, w_np1, w_n, self.T, self.T, t_np1, t_n, s_n, h_n,
+          u_n, p_n)
+
+      self.assertTrue(np.allclose(s_np1, s_m, rtol = 1.0e-6))
+      self.assertTrue(np.allclose(h_np1, h_m, rtol = 1.0e-6))
+      self.assertTrue(np.allclose(A_np1, A_m, rtol = 1.0e-6))
+
+      s_n = np.copy(s_np1)
+      h_n = np.copy(h_np1)
+      d_n = np.copy(d_np1)
+      w_n = np.copy(w_np1)
+      t_n = t_np1
+      u_n = u_np1
+      p_n = p_np1
+
 class TestNyeStuffCrystal(unittest.TestCase):
   def setUp(self):
     self.tau0 = 10.0
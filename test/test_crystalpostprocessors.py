@@ -77,3 +77,36 @@ class TestPTRTwinReorientation(unittest.TestCase):
     self.assertTrue(np.allclose(h, np.zeros((13,))))
    
 
+  def test_resolve_layout(self):
+    h = history.History()
+    for i in range(24):
+      h.add_scalar("slip"+str(i))
+    self.processor.populate_history(self.lattice, h)
+
+    slots = self.processor.resolve_layout(self.lattice, h)
+
+    expected = [36]
+    for i in range(12):
+      expected += [12 + i, 24 + i]
+
+    self.assertEqual(slots, expected)
+
+  def test_act_below_threshold(self):
+    h = history.History()
+    for i in range(24):
+      h.add_scalar("slip"+str(i))
+    self.processor.populate_history(self.lattice, h)
+    slots = self.processor.resolve_layout(self.lattice, h)
+
+    prev = np.zeros((h.size,))
+    state = np.zeros((h.size,))
+    state[12:24] = 0.01
+
+    self.processor.act(self.model, self.lattice, 300.0, self.D, self.W,
+        state, prev, slots)
+
+    shear = np.array([self.lattice.characteristic_shear(3 + i // 6, i % 6)
+      for i in range(12)])
+    self.assertTrue(np.allclose(state[24:36], 0.01 / shear))
+    self.assertTrue(np.allclose(state[12:24], 0.01))
+    self.assertEqual(state[36], 0.0)
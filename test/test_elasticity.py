@@ -120,7 +120,13 @@ class TestCubicModel(CommonElasticity, unittest.TestCase):
     self.assertEqual(self.model.C_tensor(self.T),
         self.model.C_tensor(self.T, self.Q_cube))
 
-class TestCubicModel(CommonElasticity, unittest.TestCase):
+  def test_rotated(self):
+    self.assertEqual(self.model.C_tensor(self.T, self.Q),
+        self.Q.apply(self.model.C_tensor(self.T)))
+    self.assertEqual(self.model.S_tensor(self.T, self.Q),
+        self.Q.apply(self.model.S_tensor(self.T)))
+
+class TestTransverseIsotropicModel(CommonElasticity, unittest.TestCase):
   def setUp(self):
     self.C11 = 160000.0
     self.C33 = 181000.0
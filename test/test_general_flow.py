@@ -99,6 +99,44 @@ class CommonGeneralFlow(object):
 
     self.assertTrue(np.allclose(num, should, rtol = 1.0e-3))
 
+  def test_evaluate(self):
+    t_np1 = self.gen_t()
+    e_np1 = self.gen_e()
+    e_dot = self.gen_edot(e_np1, t_np1)
+    T_np1 = self.gen_T()
+    T_dot = self.gen_Tdot(T_np1, t_np1)
+    s_np1 = self.gen_stress()
+    h_np1 = self.gen_hist()
+
+    actual = self.model.evaluate(s_np1, h_np1, e_dot, T_np1, T_dot)
+    should = [self.model.s, self.model.ds_ds, self.model.ds_da,
+        self.model.a, self.model.da_ds, self.model.da_da]
+
+    for a, fn in zip(actual, should):
+      self.assertTrue(np.allclose(a, fn(s_np1, h_np1, e_dot, T_np1, T_dot)))
+
+  def test_history_blocks(self):
+    blocks = self.model.history_blocks()
+    self.assertEqual(sum(blocks), self.model.nhist)
+
+    t_np1 = self.gen_t()
+    e_np1 = self.gen_e()
+    e_dot = self.gen_edot(e_np1, t_np1)
+    T_np1 = self.gen_T()
+    T_dot = self.gen_Tdot(T_np1, t_np1)
+    s_np1 = self.gen_stress()
+    h_np1 = self.gen_hist()
+
+    # Anything outside the declared blocks has to be in the coupling
+    J = self.model.da_da(s_np1, h_np1, e_dot, T_np1, T_dot)
+    U, V = self.model.da_da_coupling(s_np1, h_np1, e_dot, T_np1, T_dot)
+    self.assertEqual(U.shape, (self.model.nhist, self.model.history_rank()))
+    J -= np.dot(U, V.T)
+    offsets = np.cumsum([0] + blocks)
+    for i,j in zip(offsets[:-1], offsets[1:]):
+      J[i:j,i:j] = 0.0
+    self.assertTrue(np.allclose(J, 0.0))
+
 
 class CommonTVPFlow(object):
   def test_history(self):
@@ -250,6 +250,18 @@ class CommonNonAssociative(object):
 
     self.assertTrue(np.allclose(dh_model, dh_num, rtol = 1.0e-3))
 
+  def test_evaluate(self):
+    s = self.gen_stress()
+    a = self.gen_hist()
+
+    actual = self.model.evaluate(s, a, self.T)
+    should = [self.model.h, self.model.dh_ds, self.model.dh_da,
+        self.model.h_time, self.model.dh_ds_time, self.model.dh_da_time,
+        self.model.h_temp, self.model.dh_ds_temp, self.model.dh_da_temp]
+
+    for v, fn in zip(actual, should):
+      self.assertTrue(np.allclose(v, fn(s, a, self.T)))
+
 class CommonGamma(object):
   def gen_alpha(self):
     return 0.15
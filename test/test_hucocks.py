@@ -1,12 +1,13 @@
 from neml import models, interpolate, elasticity, history
-from neml.cp import hucocks, crystallography, sliprules, slipharden
+from neml import parse
+from neml.cp import hucocks, crystallography, sliprules, slipharden, polycrystal
 from neml.math import rotations, tensors
 
 import unittest
 import numpy as np
 import scipy.interpolate as inter
 
-from common import differentiate_new
+from common import differentiate_new, localize
 from test_slipharden import CommonSlipHardening
 from test_sliprules import CommonSlipStrengthSlipRule, CommonSlipRule
 
@@ -356,6 +357,32 @@ class TestPercipitationModel(unittest.TestCase):
 
     self.assertTrue(np.allclose(exact, num))
 
+  def test_jac_components(self):
+    """
+      Test the individual derivatives against differences of the python
+      reference rates, and the fused jacobian against them
+    """
+    T = 550.0 + 273.15
+    m = self.model_neml
+    py = self.model_py
+    scales = np.array([m.fs, m.rs, m.Ns])
+    rates = lambda x: np.array([py.f_dot(x[0], x[1], x[2], T),
+      py.r_dot(x[0], x[1], x[2], T), py.N_dot(x[0], x[1], x[2], T)])
+    for f, r in ((0.0035, 34e-9), (0.0045, 95e-9)):
+      N = f / (4.0/3.0*np.pi*r**3.0)
+      state = np.array([f, r, N]) / scales
+
+      comps = np.array([
+        [m.df_df(f, r, N, T), m.df_dr(f, r, N, T), m.df_dN(f, r, N, T)],
+        [m.dr_df(f, r, N, T), m.dr_dr(f, r, N, T), m.dr_dN(f, r, N, T)],
+        [m.dN_df(f, r, N, T), m.dN_dr(f, r, N, T), m.dN_dN(f, r, N, T)]])
+      comps = comps / scales[:,None] * scales[None,:]
+
+      num = differentiate_new(lambda x: rates(x * scales) / scales, state)
+
+      self.assertTrue(np.allclose(comps, num))
+      self.assertTrue(np.allclose(m.jac(self.vector_state(state), T), comps))
+
   def test_c(self):
     """
       Test the conversion from f to c
@@ -632,6 +659,114 @@ class TestHuCocksHardening(unittest.TestCase, CommonSlipHardening):
 
     self.assertTrue(np.allclose(assem, fmodel))
 
+  def test_fixed_terms(self):
+    """
+      The temperature terms stored once for the substep give the same answers
+    """
+    fixed = self.fixed.deepcopy()
+    self.model.populate_fixed(fixed, self.T)
+
+    for f in [self.model.hist, self.model.d_hist_d_h]:
+      self.assertTrue(np.allclose(
+        np.array(f(self.S, self.Q, self.H, self.L, self.T, self.sliprule, fixed)),
+        np.array(f(self.S, self.Q, self.H, self.L, self.T, self.sliprule, self.fixed))))
+    self.assertAlmostEqual(
+        self.model.hist_to_tau(0, 0, self.H, self.L, self.T, fixed),
+        self.model.hist_to_tau(0, 0, self.H, self.L, self.T, self.fixed))
+
+class TestHuCocksHardeningDecoupled(TestHuCocksHardening):
+  """
+    Same model, but with the precipitation integrated outside the crystal
+    update and read from the fixed history
+  """
+  def setUp(self):
+    super().setUp()
+
+    # The hardening model renames the variables, so start from fresh models
+    self.carbide = hucocks.HuCocksPrecipitationModel(self.c0_car, self.cp_car, self.ceq_car, 
+        self.am_car, self.N0_car, self.Vm_car, self.chi_car, self.D0_car,
+        self.Q0_car, self.Cf_car, fs = 0.1, rs = 1.0e-9, Ns = 1.0e8, 
+        w = self.w) 
+    self.laves = hucocks.HuCocksPrecipitationModel(self.c0_laves, self.cp_laves, self.ceq_laves, 
+        self.am_laves, self.N0_laves, self.Vm_laves, self.chi_laves, self.D0_laves,
+        self.Q0_laves, self.Cf_laves, fs = 0.1, rs = 1.0e-9, Ns = 1.0e8,
+        w = self.w) 
+
+    self.model = hucocks.HuCocksHardening(self.dmodel, [self.carbide, self.laves], self.ap, self.ac, self.b,
+        self.G, decouple_precipitation = True)
+    self.sliprule = sliprules.PowerLawSlipRule(self.model, self.g0, self.n)
+
+    self.H = history.History()
+    for i in range(self.nslip):
+      self.H.add_scalar("spacing_"+str(i))
+      self.H.set_scalar("spacing_"+str(i), self.current)
+
+    self.fixed = history.History()
+    for i, (f, r, N) in enumerate([(self.f_carbide, self.r_carbide, self.N_carbide),
+        (self.f_laves, self.r_laves, self.N_laves)]):
+      for n, v in zip(["f", "r", "N"], [f, r, N]):
+        self.fixed.add_scalar(n+"_"+str(i))
+        self.fixed.set_scalar(n+"_"+str(i), v)
+
+  def test_history(self):
+    H1 = history.History()
+    self.model.populate_history(H1)
+    self.model.init_history(H1)
+    self.assertEqual(len(np.array(H1)), 12)
+    self.assertTrue(np.allclose(np.array(H1), [self.L0]*12))
+
+    F1 = history.History()
+    self.model.populate_decoupled(F1)
+    self.model.init_decoupled(F1)
+    should = np.array([4.18879e-16/self.carbide.fs, 1.0e-9/self.carbide.rs, 1.0e11/self.carbide.Ns]*2) 
+    self.assertTrue(np.allclose(np.array(F1), should))
+
+  def test_hist_to_tau(self):
+    for g in range(self.L.ngroup):
+      for i in range(self.L.nslip(g)):
+        model = self.model.hist_to_tau(g, i, self.H, self.L, self.T,
+            self.fixed)
+
+        tau_d = self.dmodel.hist_to_tau(g, i, self.H, self.L, self.T,
+            self.fixed)
+
+        Na = 2.0 * self.carbide.r(self.fixed) * self.carbide.N(self.fixed) + 2.0 * self.laves.r(self.fixed) * self.laves.N(self.fixed)
+        f0 = self.carbide.f(self.fixed)
+        f1 = self.laves.f(self.fixed)
+        c = np.sum(self.carbide.c(f0, self.T))/self.carbide.vm + np.sum(
+            self.laves.c(f1, self.T)) / self.laves.vm
+        tau_p = self.ap * self.G.value(self.T) * self.b * np.sqrt(Na)
+        tau_c = self.ac * self.G.value(self.T) * self.b * np.sqrt(c*self.b)
+        should = np.sqrt(tau_d**2.0 + tau_p**2.0) + tau_c
+        self.assertAlmostEqual(model, should)
+
+  def test_definition(self):
+    """
+      Only the dislocation model is left
+    """
+    assem = np.array(self.dmodel.hist(self.S, self.Q, self.H, 
+      self.L, self.T, self.sliprule, self.fixed))
+    fmodel = self.model.hist(self.S, self.Q, self.H, self.L, self.T,
+        self.sliprule, self.fixed)
+
+    self.assertTrue(np.allclose(assem, fmodel))
+
+  def test_update_decoupled(self):
+    """
+      One backward Euler step of the precipitation models
+    """
+    dt = 1.0
+    fixed_np1 = self.fixed.deepcopy()
+    self.model.update_decoupled(fixed_np1, self.fixed, self.T, self.T, dt, 0.0)
+
+    for model in [self.carbide, self.laves]:
+      x_n = np.array([model.f(self.fixed) / model.fs, model.r(self.fixed) / model.rs,
+        model.N(self.fixed) / model.Ns])
+      x_np1 = np.array([model.f(fixed_np1) / model.fs, model.r(fixed_np1) / model.rs,
+        model.N(fixed_np1) / model.Ns])
+      self.assertTrue(np.allclose(x_np1, x_n + dt * np.array(model.rate(fixed_np1, self.T)),
+        rtol = 1.0e-8))
+
 class TestArrheniusSlip(unittest.TestCase, CommonSlipStrengthSlipRule, CommonSlipRule):
   def setUp(self):
     self.L = crystallography.CubicLattice(1.0)
@@ -814,3 +949,51 @@ class TestArrheniusSlipReal(unittest.TestCase, CommonSlipStrengthSlipRule, Commo
     self.strength_values = [self.strength + self.static]
     
     self.tau = -35.0
+
+class TestHuCocksPolycrystal(unittest.TestCase):
+  """
+    The precipitation is integrated once per material point, in the shared
+    polycrystal history, and read by every grain
+  """
+  def setUp(self):
+    with open(localize("../examples/cp/hucocks/model.xml")) as f:
+      xml = f.read().replace('<resistance type="HuCocksHardening">',
+          '<resistance type="HuCocksHardening"><decouple_precipitation>true</decouple_precipitation>')
+    self.single = parse.parse_string(xml)
+
+    self.qs = [rotations.Orientation(a, b, c, angle_type = "degrees") for
+        a, b, c in [(0.0, 0.0, 0.0), (35.0, 17.0, 14.0), (-80.0, 50.0, 10.0)]]
+    self.T = 600.0 + 273.15
+    self.dt = 100.0
+    self.nsteps = 5
+
+  def run_steps(self, model):
+    h = model.init_store()
+    s = np.zeros((6,))
+    d_n = np.zeros((6,))
+    w = np.zeros((3,))
+    hs = [h]
+    for i in range(1, self.nsteps+1):
+      d = np.array([1.0,-0.4,-0.5,0.2,0.0,0.1]) * 1.0e-6 * i
+      s, h, A, B, u, p = model.update_ld_inc(d, d_n, w, w, self.T, self.T,
+          i * self.dt, (i-1) * self.dt, s, h, 0.0, 0.0)
+      d_n = d
+      hs.append(h)
+    return hs
+
+  def test_shared(self):
+    for layout in ["blocked", "interleaved"]:
+      model = polycrystal.TaylorModel(self.single, self.qs, layout = layout)
+      hs = self.run_steps(model)
+      hc = self.run_steps(self.single)
+
+      loc = self.single.decoupled_location
+      nd = self.single.ndecoupled
+      self.assertFalse(np.allclose(model.shared(hs[0]), model.shared(hs[-1])))
+      for h, c in zip(hs, hc):
+        self.assertTrue(np.allclose(model.shared(h), c[loc:loc+nd]))
+        if layout == "blocked":
+          for i in range(len(self.qs)):
+            grain = h[i*self.single.nstore:(i+1)*self.single.nstore]
+            self.assertTrue(np.allclose(grain[loc:loc+nd], model.shared(h)))
+
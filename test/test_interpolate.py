@@ -16,6 +16,18 @@ class BaseInterpolate(object):
     nd = differentiate(lambda x: self.interpolate(x), self.x)
     self.assertTrue(np.isclose(d, nd, rtol = 1.0e-3))
 
+  def test_batch(self):
+    xs = self.x * np.linspace(0.9, 1.1, 11)
+    self.assertTrue(np.allclose(self.interpolate.value(xs),
+      [self.interpolate.value(x) for x in xs]))
+    self.assertTrue(np.allclose(self.interpolate.derivative(xs),
+      [self.interpolate.derivative(x) for x in xs]))
+
+  def test_value_and_derivative(self):
+    v, d = self.interpolate.value_and_derivative(self.x)
+    self.assertTrue(np.isclose(v, self.interpolate.value(self.x)))
+    self.assertTrue(np.isclose(d, self.interpolate.derivative(self.x)))
+
 class TestPolynomialInterpolate(unittest.TestCase, BaseInterpolate):
   def setUp(self):
     self.n = 5
@@ -59,6 +71,28 @@ class TestPiecewiseLinearInterpolate(unittest.TestCase, BaseInterpolate):
     ys2[xs > self.validx[-1]] = self.points[-1]
     self.assertTrue(np.allclose(ys1, ys2))
 
+class TestPiecewiseLinearInterpolateLargeTable(unittest.TestCase, BaseInterpolate):
+  def setUp(self):
+    self.uniform = np.linspace(300.0, 1200.0, 301)
+    self.nonuniform = np.sort(ra.random((301,))) * 900.0 + 300.0
+    self.values = ra.random((301,)) * 100.0
+
+    self.x = 641.5
+
+    self.interpolate = interpolate.PiecewiseLinearInterpolate(
+        list(self.uniform), list(self.values))
+    self.other = interpolate.PiecewiseLinearInterpolate(
+        list(self.nonuniform), list(self.values))
+
+  def test_interpolate(self):
+    xs = np.concatenate((np.linspace(200.0, 1300.0, 1001),
+      ra.random((200,)) * 1100.0 + 200.0, self.uniform))
+    for xpts, ip in ((self.uniform, self.interpolate),
+        (self.nonuniform, self.other)):
+      ys1 = [ip(x) for x in xs]
+      ys2 = np.interp(xs, xpts, self.values)
+      self.assertTrue(np.allclose(ys1, ys2))
+
 class TestGenericPiecewiseInterpolate(unittest.TestCase, BaseInterpolate):
   def setUp(self):
     self.xs = [1.0,5.0]
@@ -290,6 +290,93 @@ class TestRIAPlasticityJ2Voce(unittest.TestCase, CommonMatModel, CommonJacobian)
     return np.array(range(1,9)) / 9.0
 
 
+class TestRIARadialReturn(unittest.TestCase):
+  """
+    Check the closed form radial return against the general rate
+    independent update
+  """
+  def setUp(self):
+    self.E = 92000.0
+    self.nu = 0.3
+
+    self.s0 = 180.0
+    self.Kp = 1000.0
+    self.R = 150.0
+    self.d = 10.0
+    self.H = 1000.0
+
+    self.elastic = elasticity.IsotropicLinearElasticModel(self.E, "youngs",
+        self.nu, "poissons")
+
+    self.efinal = np.array([0.02,-0.005,0.002,-0.003,0.01,-0.015])
+    self.tfinal = 10.0
+    self.T = 300.0
+    self.nsteps = 20
+
+  def isos(self):
+    return [hardening.LinearIsotropicHardeningRule(self.s0, self.Kp),
+        hardening.VoceIsotropicHardeningRule(self.s0, self.R, self.d)]
+
+  def flows(self):
+    for iso in self.isos():
+      yield ri_flow.RateIndependentAssociativeFlow(surfaces.IsoJ2(), iso)
+      kin = hardening.LinearKinematicHardeningRule(self.H)
+      yield ri_flow.RateIndependentAssociativeFlow(surfaces.IsoKinJ2(),
+          hardening.CombinedHardeningRule(iso, kin))
+
+  def compare(self, fast, slow):
+    e_n = np.zeros((6,))
+    t_n = 0.0
+    s_f = np.zeros((6,))
+    s_s = np.zeros((6,))
+    h_f = fast.init_store()
+    h_s = slow.init_store()
+    u_f = u_s = p_f = p_s = 0.0
+
+    # Load out and back to cover both the plastic and elastic branches
+    for i in range(1, 2*self.nsteps+1):
+      f = i if i <= self.nsteps else 2 * self.nsteps - i
+      e_np1 = self.efinal * f / self.nsteps
+      t_np1 = self.tfinal * i / self.nsteps
+
+      s_f, h_f, A_f, u_f, p_f = fast.update_sd(e_np1, e_n, self.T, self.T,
+          t_np1, t_n, s_f, h_f, u_f, p_f)
+      s_s, h_s, A_s, u_s, p_s = slow.update_sd(e_np1, e_n, self.T, self.T,
+          t_np1, t_n, s_s, h_s, u_s, p_s)
+
+      self.assertTrue(np.allclose(s_f, s_s))
+      self.assertTrue(np.allclose(h_f, h_s))
+      self.assertTrue(np.allclose(A_f, A_s))
+      self.assertTrue(np.isclose(u_f, u_s))
+      self.assertTrue(np.isclose(p_f, p_s))
+
+      e_n = np.copy(e_np1)
+      t_n = t_np1
+
+  def test_detected(self):
+    for flow in self.flows():
+      model = models.SmallStrainRateIndependentPlasticity(self.elastic, flow)
+      self.assertTrue(model.radial_return)
+      model = models.SmallStrainRateIndependentPlasticity(self.elastic, flow,
+          radial_return = False)
+      self.assertFalse(model.radial_return)
+
+  def test_not_detected(self):
+    surface = surfaces.IsoKinJ2I1(1.0, 1.0)
+    iso = hardening.LinearIsotropicHardeningRule(self.s0, self.Kp)
+    kin = hardening.LinearKinematicHardeningRule(self.H)
+    flow = ri_flow.RateIndependentAssociativeFlow(surface, 
+        hardening.CombinedHardeningRule(iso, kin))
+    model = models.SmallStrainRateIndependentPlasticity(self.elastic, flow)
+    self.assertFalse(model.radial_return)
+
+  def test_matches_general(self):
+    for flow in self.flows():
+      fast = models.SmallStrainRateIndependentPlasticity(self.elastic, flow)
+      slow = models.SmallStrainRateIndependentPlasticity(self.elastic, flow,
+          radial_return = False)
+      self.compare(fast, slow)
+
 class TestRIChabocheLinear(unittest.TestCase, CommonMatModel, CommonJacobian):
   """
     Test Chaboche with linear isotropic hardening
@@ -482,9 +569,9 @@ class TestDirectIntegrateChaboche(unittest.TestCase, CommonMatModel, CommonJacob
     self.elastic = elasticity.IsotropicLinearElasticModel(mu,
         "shear", K, "bulk")
 
-    flow = general_flow.TVPFlowRule(self.elastic, vmodel)
+    self.flow = general_flow.TVPFlowRule(self.elastic, vmodel)
 
-    self.model = models.GeneralIntegrator(self.elastic, flow)
+    self.model = models.GeneralIntegrator(self.elastic, self.flow)
 
     self.efinal = np.array([0.05,0,0,0.02,0,-0.01])
     self.tfinal = 10.0
@@ -502,6 +589,50 @@ class TestDirectIntegrateChaboche(unittest.TestCase, CommonMatModel, CommonJacob
     x = [100.0,150.0,-300.0,-10.0,50.0,100.0] + list(self.gen_hist()*1.1)
     return np.array(x)
 
+class TestDirectIntegrateChabocheReduced(TestDirectIntegrateChaboche):
+  """
+    Same model, but with the reduced scalar integration
+  """
+  def setUp(self):
+    super(TestDirectIntegrateChabocheReduced, self).setUp()
+    self.full = self.model
+    self.model = models.GeneralIntegrator(self.elastic, self.flow,
+        reduced_integration = True)
+
+  def test_detected(self):
+    self.assertTrue(self.model.reduced_integration)
+    self.assertFalse(self.full.reduced_integration)
+
+  def test_matches_full(self):
+    e_n = np.zeros((6,))
+    t_n = 0.0
+    s_r = np.zeros((6,))
+    s_f = np.zeros((6,))
+    h_r = self.model.init_store()
+    h_f = self.full.init_store()
+    u_r = u_f = p_r = p_f = 0.0
+
+    # Out and back to include reverse loading
+    for i in range(1, 2*self.nsteps+1):
+      f = i if i <= self.nsteps else 2 * self.nsteps - i
+      e_np1 = self.efinal * f / self.nsteps
+      t_np1 = self.tfinal * i / self.nsteps
+
+      s_r, h_r, A_r, u_r, p_r = self.model.update_sd(e_np1, e_n, self.T,
+          self.T, t_np1, t_n, s_r, h_r, u_r, p_r)
+      s_f, h_f, A_f, u_f, p_f = self.full.update_sd(e_np1, e_n, self.T,
+          self.T, t_np1, t_n, s_f, h_f, u_f, p_f)
+
+      self.assertTrue(np.allclose(s_r, s_f, rtol = 1.0e-6))
+      self.assertTrue(np.allclose(h_r, h_f, rtol = 1.0e-6))
+      self.assertTrue(np.allclose(A_r, A_f, rtol = 1.0e-5))
+      self.assertTrue(np.isclose(u_r, u_f, rtol = 1.0e-6))
+      self.assertTrue(np.isclose(p_r, p_f, rtol = 1.0e-6))
+
+      e_n = np.copy(e_np1)
+      t_n = t_np1
+
+
 class TestPerzynaJ2Voce(unittest.TestCase, CommonMatModel, CommonJacobian):
   """
     Perzyna associated viscoplasticity w/ voce kinematic hardening
@@ -300,6 +300,11 @@ class TestSolve(unittest.TestCase):
     print(self.b)
     self.assertTrue(np.allclose(x, self.b))
 
+  def test_solve_multiple(self):
+    B = ra.random((self.n,4))
+    X = la.solve(self.A, B)
+    self.assertTrue(np.allclose(X, solve_mat_multiple(self.A, B)))
+
 class TestDiagSolve(unittest.TestCase):
   def setUp(self):
     self.n = 10
@@ -398,6 +398,11 @@ class TestPerfect(CompareMats, unittest.TestCase):
   def test_alpha(self):
     self.assertTrue(np.isclose(self.model1.alpha(self.T), 0.1))
 
+  def test_alpha_array(self):
+    Ts = np.array([300.0, 450.0, self.T])
+    self.assertTrue(np.allclose(self.model1.alpha(Ts),
+      [self.model1.alpha(T) for T in Ts]))
+
 class TestPerfectCreep(CompareMats, unittest.TestCase):
   def setUp(self):
     self.model1 = parse.parse_xml(localize("examples.xml"), "test_pcreep")
@@ -0,0 +1,268 @@
+#!/usr/bin/env python
+
+from neml import elasticity
+from neml.cp import crystallography, slipharden, sliprules, inelasticity, kinematics, singlecrystal, polycrystal
+from neml.math import rotations
+
+import unittest
+import numpy as np
+
+import common
+
+def single_crystal(**kwargs):
+  strengthmodel = slipharden.VoceSlipHardening(50.0, 2.5, 10.0)
+  slipmodel = sliprules.PowerLawSlipRule(strengthmodel, 1.0, 3.0)
+  imodel = inelasticity.AsaroInelasticity(slipmodel)
+
+  L = crystallography.CubicLattice(1.0)
+  L.add_slip_system([1,1,0],[1,1,1])
+
+  emodel = elasticity.CubicLinearElasticModel(120000.0, 0.3, 29000.0,
+      "moduli")
+  kmodel = kinematics.StandardKinematicModel(emodel, imodel)
+
+  return singlecrystal.SingleCrystalModel(kmodel, L, miter = 120,
+      update_rotation = False, **kwargs)
+
+def orientations(n):
+  return [rotations.CrystalOrientation(35.0 * i, 17.0 * i**2, 14.0 * i + 5.0,
+    angle_type = "degrees") for i in range(n)]
+
+class CommonPolycrystal(object):
+  """
+    Drive a polycrystal model through a few steps, checking the tangent
+    numerically on each one
+  """
+  def drive(self, model, nsteps, check_tangent = False):
+    d_n = np.zeros((6,))
+    w_n = np.zeros((3,))
+    s_n = np.zeros((6,))
+    h_n = model.init_store()
+    t_n = 0.0
+    u_n = 0.0
+    p_n = 0.0
+
+    res = []
+    for i in range(nsteps):
+      t_np1 = t_n + self.dt
+      d_np1 = d_n + self.Ddir * self.dt
+      w_np1 = w_n + self.Wdir * self.dt
+
+      s_np1, h_np1, A_np1, B_np1, u_np1, p_np1 = model.update_ld_inc(
+          d_np1, d_n, w_np1, w_n, self.T, self.T, t_np1, t_n, s_n, h_n,
+          u_n, p_n)
+
+      if check_tangent:
+        A_num = common.differentiate(lambda d: model.update_ld_inc(d, d_n,
+          w_np1, w_n, self.T, self.T, t_np1, t_n, s_n, h_n, u_n, p_n)[0],
+          d_np1)
+        self.assertTrue(np.allclose(A_np1, A_num, rtol = 1.0e-3,
+          atol = 1.0e-6))
+
+        B_num = common.differentiate(lambda w: model.update_ld_inc(d_np1,
+          d_n, w, w_n, self.T, self.T, t_np1, t_n, s_n, h_n, u_n, p_n)[0],
+          w_np1)
+        self.assertTrue(np.allclose(B_np1, B_num, rtol = 1.0e-3,
+          atol = 1.0e-6))
+
+      res.append((s_np1, h_np1))
+
+      s_n = np.copy(s_np1)
+      h_n = np.copy(h_np1)
+      d_n = np.copy(d_np1)
+      w_n = np.copy(w_np1)
+      t_n = t_np1
+      u_n = u_np1
+      p_n = p_np1
+
+    return res
+
+class TestClusteredTaylor(unittest.TestCase, CommonPolycrystal):
+  def setUp(self):
+    self.N = 6
+    self.single = single_crystal()
+    self.qs = orientations(self.N)
+
+    self.Ddir = np.array([0.01,-0.005,-0.003,0.01,0.02,-0.003]) * 2
+    self.Wdir = np.array([0.02,-0.03,0.01]) * 2
+    self.T = 300.0
+    self.dt = 2.0
+    self.nsteps = 5
+
+  def test_all_clusters_is_taylor(self):
+    taylor = polycrystal.TaylorModel(self.single, self.qs)
+    clustered = polycrystal.ClusteredTaylorModel(self.single, self.qs,
+        self.N)
+
+    for (s1, h1), (s2, h2) in zip(self.drive(taylor, self.nsteps),
+        self.drive(clustered, self.nsteps)):
+      self.assertTrue(np.allclose(s1, s2, rtol = 1.0e-12, atol = 1.0e-10))
+
+  def test_weights(self):
+    for k in (1, 2, 4, self.N):
+      model = polycrystal.ClusteredTaylorModel(self.single, self.qs, k)
+      h = model.init_store()
+      self.assertEqual(model.nclusters(h), k)
+      w = model.weights(h)
+      self.assertAlmostEqual(sum(w), 1.0)
+      self.assertTrue(all(wi > 0 for wi in w[:k]))
+
+  def test_membership(self):
+    for k in (1, 2, 4, self.N):
+      model = polycrystal.ClusteredTaylorModel(self.single, self.qs, k)
+      h = model.init_store()
+      m = model.membership(h)
+      self.assertEqual(len(m), self.N)
+      self.assertEqual(sorted(set(m)), list(range(k)))
+      w = model.weights(h)
+      for c in range(k):
+        self.assertAlmostEqual(w[c], list(m).count(c) / float(self.N))
+
+  def test_adaptive_split(self):
+    model = polycrystal.ClusteredTaylorModel(self.single, self.qs, 1,
+        adaptive = True, split_tol = 1.0e-6)
+    self.assertTrue(model.capacity > 1)
+
+    h0 = model.init_store()
+    self.assertEqual(model.nclusters(h0), 1)
+
+    s, h = self.drive(model, 1)[0]
+    k = model.nclusters(h)
+    self.assertTrue(k > 1)
+    w = model.weights(h)
+    self.assertAlmostEqual(sum(w), 1.0)
+    self.assertTrue(all(wi > 0 for wi in w[:k]))
+    self.assertEqual(sorted(set(model.membership(h))), list(range(k)))
+
+  def test_no_split_below_tol(self):
+    model = polycrystal.ClusteredTaylorModel(self.single, self.qs, 1,
+        adaptive = True, split_tol = 1.0e6)
+    s, h = self.drive(model, 1)[0]
+    self.assertEqual(model.nclusters(h), 1)
+
+  def test_tangent_taylor(self):
+    self.drive(polycrystal.TaylorModel(self.single, self.qs), self.nsteps,
+        check_tangent = True)
+
+  def test_tangent_clustered(self):
+    self.drive(polycrystal.ClusteredTaylorModel(self.single, self.qs, 2),
+        self.nsteps, check_tangent = True)
+
+class TestTaylorLayout(unittest.TestCase, CommonPolycrystal):
+  def setUp(self):
+    self.N = 6
+    self.single = single_crystal()
+    self.qs = orientations(self.N)
+
+    self.Ddir = np.array([0.01,-0.005,-0.003,0.01,0.02,-0.003]) * 2
+    self.Wdir = np.array([0.02,-0.03,0.01]) * 2
+    self.T = 300.0
+    self.dt = 2.0
+    self.nsteps = 5
+
+    self.blocked = polycrystal.TaylorModel(self.single, self.qs,
+        layout = "blocked")
+    self.interleaved = polycrystal.TaylorModel(self.single, self.qs,
+        layout = "interleaved")
+
+  def test_sizes(self):
+    self.assertFalse(self.blocked.interleaved)
+    self.assertTrue(self.interleaved.interleaved)
+    self.assertEqual(self.blocked.nhist, (self.single.nstore + 6) * self.N)
+    self.assertTrue(self.interleaved.nhist >= self.blocked.nhist)
+
+  def test_same_response(self):
+    for (s1, h1), (s2, h2) in zip(self.drive(self.blocked, self.nsteps),
+        self.drive(self.interleaved, self.nsteps)):
+      self.assertTrue(np.allclose(s1, s2, rtol = 1.0e-14, atol = 0.0))
+      self.assertTrue(np.allclose(self.blocked.orientations_array(h1),
+        self.interleaved.orientations_array(h2)))
+
+class TestSelfConsistent(unittest.TestCase, CommonPolycrystal):
+  def setUp(self):
+    self.N = 6
+    self.single = single_crystal()
+    self.qs = orientations(self.N)
+
+    self.Ddir = np.array([0.01,-0.005,-0.003,0.01,0.02,-0.003]) * 2
+    self.Wdir = np.array([0.02,-0.03,0.01]) * 2
+    self.T = 300.0
+    self.dt = 2.0
+    self.nsteps = 5
+
+  def drive_tangents(self, model, nsteps):
+    """
+      The stresses and returned tangents over the steps
+    """
+    d_n = np.zeros((6,))
+    w_n = np.zeros((3,))
+    s_n = np.zeros((6,))
+    h_n = model.init_store()
+
+    res = []
+    for i in range(nsteps):
+      d_np1 = d_n + self.Ddir * self.dt
+      w_np1 = w_n + self.Wdir * self.dt
+      s_np1, h_np1, A_np1, B_np1, u_np1, p_np1 = model.update_ld_inc(
+          d_np1, d_n, w_np1, w_n, self.T, self.T, (i+1) * self.dt,
+          i * self.dt, s_n, h_n, 0.0, 0.0)
+      res.append((s_np1, h_np1, A_np1))
+      s_n, h_n, d_n, w_n = s_np1, h_np1, d_np1, w_np1
+
+    return res
+
+  def check_single(self, nsame):
+    q = orientations(2)[1]
+    single = single_crystal(initial_rotation = q)
+    model = polycrystal.SelfConsistentModel(self.single, [q] * nsame)
+
+    for (s1, h1, A1), (s2, h2, A2) in zip(
+        self.drive_tangents(single, self.nsteps),
+        self.drive_tangents(model, self.nsteps)):
+      self.assertTrue(np.allclose(s1, s2, rtol = 1.0e-10))
+      self.assertTrue(np.allclose(A1, A2, rtol = 1.0e-10))
+
+  def test_one_grain(self):
+    self.check_single(1)
+
+  def test_identical_grains(self):
+    self.check_single(3)
+
+  def test_interaction_isotropic(self):
+    kappa = 130000.0
+    mu = 50000.0
+    L = np.zeros((6,6))
+    L[:3,:3] = kappa - 2.0 * mu / 3.0
+    L += 2.0 * mu * np.eye(6)
+
+    # Hill's constraint tensor for a sphere in an isotropic medium
+    ks = 4.0 * mu / 3.0
+    ms = mu * (9.0 * kappa + 8.0 * mu) / (6.0 * (kappa + 2.0 * mu))
+    Ls = np.zeros((6,6))
+    Ls[:3,:3] = ks - 2.0 * ms / 3.0
+    Ls += 2.0 * ms * np.eye(6)
+
+    self.assertTrue(np.allclose(polycrystal.SelfConsistentModel.interaction(L),
+      Ls))
+
+  def test_history(self):
+    model = polycrystal.SelfConsistentModel(self.single, self.qs)
+    h0 = model.init_store()
+    self.assertEqual(model.iterations(h0), 0)
+    self.assertTrue(np.allclose(model.effective_tangent(h0), 0.0))
+
+    for s, h, A in self.drive_tangents(model, self.nsteps):
+      self.assertTrue(model.iterations(h) >= 1)
+      self.assertTrue(np.allclose(model.effective_tangent(h), A,
+        rtol = 0.0, atol = 0.0))
+
+  def test_grains_not_converged(self):
+    model = polycrystal.SelfConsistentModel(self.single, self.qs, miter = 1)
+    with self.assertRaises(RuntimeError):
+      self.drive(model, 1)
+
+  def test_tangent_not_converged(self):
+    model = polycrystal.SelfConsistentModel(self.single, self.qs,
+        tangent_rtol = 0.0)
+    with self.assertRaises(RuntimeError):
+      self.drive(model, 1)
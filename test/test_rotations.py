@@ -1,7 +1,7 @@
 #!/usr/bin/env python
 
 from neml.math import rotations, tensors
-from common import ms2ts
+from common import ms2ts, sym
 
 import unittest
 import numpy as np
@@ -257,6 +257,28 @@ class TestApplyThings(unittest.TestCase):
         tensors.RankFour(TestApplyThings.rotate_fourth(self.SSS1, self.Q)
           ).to_sym())
 
+  def test_to_mandel(self):
+    R = self.q.to_mandel()
+    self.assertTrue(np.allclose(np.dot(R, sym(self.S)),
+      sym(np.dot(self.Q, np.dot(self.S, self.Q.T)))))
+
+  def test_symsym_batch(self):
+    qs = [self.q, rotations.Orientation(-10.0, 15.0, 200.0, 
+      angle_type = "degrees")]
+    C = rotations.rotate_symsym_batch(np.array([q.quat for q in qs]),
+        self.SS1)
+    for q, Ci in zip(qs, C):
+      self.assertEqual(tensors.SymSymR4(Ci), q.apply(self.TSS1))
+
+  def test_fourth_batch(self):
+    qs = [self.q, rotations.Orientation(-10.0, 15.0, 200.0, 
+      angle_type = "degrees")]
+    C = rotations.rotate_fourth_batch(np.array([q.quat for q in qs]),
+        self.R1)
+    for q, Ci in zip(qs, C):
+      self.assertTrue(np.allclose(Ci, 
+        TestApplyThings.rotate_fourth(self.R1, q.to_matrix())))
+
 class TestExpIntegration(unittest.TestCase):
   def setUp(self):
     self.q = rotations.Orientation(30.0, 60.0, 80.0, angle_type = "degrees")
@@ -272,6 +294,14 @@ class TestExpIntegration(unittest.TestCase):
     self.assertTrue(np.allclose(self.q.quat,
       rotations.wexp(rotations.wlog(self.q)).quat))
 
+  def test_zero_spin(self):
+    Z = tensors.Skew(np.zeros((3,3)))
+    self.assertTrue(np.allclose(rotations.wexp(Z).quat, [1.0,0,0,0]))
+    self.assertTrue(np.allclose(rotations.wexp_batch(np.zeros((2,3))),
+      [[1.0,0,0,0],[1.0,0,0,0]]))
+    self.assertTrue(np.allclose((rotations.wexp(Z) * self.q).quat,
+      self.q.quat))
+
   def test_correctly_integrates(self):
     # So we are rotating about x where t is the rotation in radians
     R = lambda t: np.array([[1.0,0,0],[0,np.cos(t),-np.sin(t)],[0,np.sin(t), np.cos(t)]])
@@ -317,6 +347,58 @@ class TestDistance(unittest.TestCase):
     self.assertTrue(np.isclose(self.q.distance(self.q), 0))
     self.assertTrue(np.isclose(rotations.distance(self.q,self.q), 0))
 
+class TestBatch(unittest.TestCase):
+  def setUp(self):
+    self.n = 10
+    self.A = rotations.random_orientations_batch(self.n)
+    self.B = rotations.random_orientations_batch(self.n)
+    self.qa = [rotations.Orientation(q) for q in self.A]
+    self.qb = [rotations.Orientation(q) for q in self.B]
+    self.v = np.random.random((self.n,3))
+    self.s = np.random.random((self.n,6))
+
+  def test_random(self):
+    self.assertTrue(np.allclose(la.norm(self.A, axis = 1), 1.0))
+
+  def test_multiply(self):
+    C = rotations.quat_multiply_batch(self.A, self.B)
+    for a, b, c in zip(self.qa, self.qb, C):
+      self.assertTrue(np.allclose((a*b).quat, c))
+
+  def test_inverse(self):
+    C = rotations.quat_inverse_batch(self.A)
+    D = rotations.quat_conj_batch(self.A)
+    for a, c, d in zip(self.qa, C, D):
+      self.assertTrue(np.allclose(a.inverse().quat, c))
+      self.assertTrue(np.allclose(a.inverse().quat, d))
+
+  def test_exp_log(self):
+    C = rotations.quat_exp_batch(rotations.quat_log_batch(self.A))
+    self.assertTrue(np.allclose(C, self.A))
+
+  def test_wexp_wlog(self):
+    W = rotations.wlog_batch(self.A)
+    for a, w in zip(self.qa, W):
+      self.assertTrue(np.allclose(rotations.wlog(a).data, w))
+    C = rotations.wexp_batch(W)
+    for a, c in zip(self.qa, C):
+      self.assertTrue(np.isclose(a.distance(rotations.Orientation(c)), 0))
+
+  def test_apply_vector(self):
+    R = rotations.quat_apply_vector_batch(self.A, self.v)
+    for a, v, r in zip(self.qa, self.v, R):
+      self.assertTrue(np.allclose(a.apply(tensors.Vector(v)).data, r))
+
+  def test_apply_symmetric(self):
+    R = rotations.quat_apply_symmetric_batch(self.A, self.s)
+    for a, s, r in zip(self.qa, self.s, R):
+      self.assertTrue(np.allclose(a.apply(tensors.Symmetric(s)).data, r))
+
+  def test_distance(self):
+    D = rotations.distance_batch(self.A, self.B)
+    for a, b, d in zip(self.qa, self.qb, D):
+      self.assertTrue(np.isclose(a.distance(b), d))
+
 class TestOrientVectors(unittest.TestCase):
   def setUp(self):
     self.v1 = tensors.Vector([1.0,4,2])
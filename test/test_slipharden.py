@@ -297,6 +297,119 @@ class TestGeneralLinearHardeningAbs(unittest.TestCase, CommonSlipHardening):
     exact = np.dot(np.array(self.M), srates)
     self.assertTrue(np.allclose(hrate, exact))
 
+class TestGeneralLinearHardeningTyped(unittest.TestCase, CommonSlipHardening):
+  def setUp(self):
+    self.L = crystallography.CubicLattice(1.0)
+    self.L.add_slip_system([1,1,0],[1,1,1])
+    
+    self.Q = rotations.Orientation(35.0,17.0,14.0, angle_type = "degrees")
+    self.S = tensors.Symmetric(np.array([
+      [100.0,-25.0,10.0],
+      [-25.0,-17.0,15.0],
+      [10.0,  15.0,35.0]]))
+    
+    self.nslip = self.L.ntotal
+
+    self.static = 20.0
+    self.current = 25.0
+
+    self.H = history.History()
+    for i in range(self.nslip):
+      self.H.add_scalar("strength"+str(i))
+      self.H.set_scalar("strength"+str(i), self.current)
+
+    self.T = 300.0
+
+    self.coefs = [0.122, 0.122, 0.625, 0.07, 0.137, 0.122]
+    self.M = slipharden.SlipInteractionMatrix(self.L, self.coefs)
+
+    self.s0 = [self.static]*self.nslip
+
+    self.model = slipharden.GeneralLinearHardening(self.M, self.s0, 
+        absval = True)
+
+    self.g0 = 1.0
+    self.n = 3.0
+    self.sliprule = sliprules.PowerLawSlipRule(self.model, self.g0, self.n)
+
+    self.fixed = history.History()
+
+  def test_counts(self):
+    # Self, coplanar, collinear, Hirth, glissile, and Lomer for FCC
+    self.assertEqual(list(self.M.counts), [12, 24, 12, 24, 48, 24])
+
+  def test_matrix(self):
+    dense = np.array(self.M)
+    for i in range(self.nslip):
+      for j in range(self.nslip):
+        self.assertAlmostEqual(dense[i,j], 
+            self.coefs[self.M.interaction_type(i,j)])
+    self.assertTrue(np.allclose(dense, dense.T))
+
+  def test_definition(self):
+    hrate = self.model.hist(self.S, self.Q, self.H, self.L, self.T, self.sliprule,
+        self.fixed)
+    srates = [np.abs(self.sliprule.slip(g, i, self.S, self.Q, self.H, self.L, self.T, 
+      self.fixed)) for g in range(self.L.ngroup) for i in range(self.L.nslip(g))]
+    exact = np.dot(np.array(self.M), srates)
+    self.assertTrue(np.allclose(hrate, exact))
+
+class TestSlipInteractionCounts(unittest.TestCase):
+  """
+    Pair counts for the BCC and HCP system sets in bench_slip_interaction,
+    and the grouped product against the dense matrix
+  """
+  def setUp(self):
+    self.coefs = [0.122, 0.122, 0.625, 0.07, 0.137, 0.122]
+
+  def check(self, L, counts):
+    M = slipharden.SlipInteractionMatrix(L, self.coefs)
+    self.assertEqual(sum(counts), L.ntotal**2)
+    self.assertEqual(list(M.counts), counts)
+
+    # Only the rest pairs not of the most common rest type are visited
+    self.assertEqual(M.npairs, sum(counts[3:]) - max(counts[3:]))
+
+    n = L.ntotal
+    model = slipharden.GeneralLinearHardening(M, [20.0] * n, absval = True)
+    rule = sliprules.PowerLawSlipRule(model, 1.0, 3.0)
+    H = history.History()
+    for i in range(n):
+      H.add_scalar("strength"+str(i))
+      H.set_scalar("strength"+str(i), 25.0 + i)
+    Q = rotations.Orientation(35.0,17.0,14.0, angle_type = "degrees")
+    S = tensors.Symmetric(np.array([
+      [100.0,-25.0,10.0],
+      [-25.0,-17.0,15.0],
+      [10.0,  15.0,35.0]]))
+    fixed = history.History()
+
+    hrate = model.hist(S, Q, H, L, 300.0, rule, fixed)
+    srates = [np.abs(rule.slip(g, i, S, Q, H, L, 300.0, fixed))
+        for g in range(L.ngroup) for i in range(L.nslip(g))]
+    self.assertTrue(np.allclose(hrate, np.dot(np.array(M), srates)))
+
+  def test_bcc48(self):
+    L = crystallography.CubicLattice(1.0)
+    L.add_slip_system([1,1,1],[1,1,0])
+    L.add_slip_system([1,1,1],[1,1,2])
+    L.add_slip_system([1,1,1],[1,2,3])
+    self.assertEqual(L.ntotal, 48)
+
+    # No orthogonal pairs, as all the directions are <111>
+    self.check(L, [48, 12, 528, 0, 264, 1452])
+
+  def test_hcp30(self):
+    L = crystallography.HCPLattice(0.29511, 0.468433)
+    L.add_slip_system([1,1,-2,0],[0,0,0,1])
+    L.add_slip_system([1,1,-2,0],[1,0,-1,0])
+    L.add_slip_system([1,1,-2,0],[1,0,-1,1])
+    L.add_slip_system([1,1,-2,3],[1,0,-1,1])
+    L.add_slip_system([1,1,-2,3],[1,1,-2,2])
+    self.assertEqual(L.ntotal, 30)
+
+    self.check(L, [30, 42, 72, 0, 240, 516])
+
 class TestSimpleLinearHardening(unittest.TestCase, CommonSlipHardening):
   def setUp(self):
     self.L = crystallography.CubicLattice(1.0)
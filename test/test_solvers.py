@@ -36,3 +36,50 @@ class TestConvergence(unittest.TestCase):
         linesearch = False, verbose = False)
     Rf, Rj = self.model.RJ(x, self.ts)
     self.assertTrue(Rf[0] < 1.0e-4)
+
+class TestAndersonMixing(unittest.TestCase):
+  """
+    Fixed point of the linear contraction x = M x + b
+  """
+  def setUp(self):
+    self.M = np.array([[0.5,0.2,0.1],[0.1,0.6,0.2],[0.0,0.3,0.7]])
+    self.b = np.array([1.0,2.0,3.0])
+    self.x_exact = np.linalg.solve(np.eye(3) - self.M, self.b)
+
+  def iterate(self, depth, miter = 1000):
+    mixer = solvers.AndersonMixing(3, depth)
+    x = np.zeros((3,))
+    for i in range(miter):
+      f = np.dot(self.M, x) + self.b - x
+      if np.linalg.norm(f) < 1.0e-12:
+        break
+      mixer.update(x, f)
+    return x, i
+
+  def test_converges(self):
+    x, its = self.iterate(5)
+    self.assertTrue(np.allclose(x, self.x_exact, rtol = 1.0e-10))
+
+  def test_faster_than_plain(self):
+    x_plain, its_plain = self.iterate(0)
+    x, its = self.iterate(5)
+    self.assertTrue(np.allclose(x_plain, self.x_exact, rtol = 1.0e-10))
+    # A linear map in 3 dimensions is resolved once the history spans it
+    self.assertTrue(its <= 5)
+    self.assertTrue(its < its_plain)
+
+  def test_reset(self):
+    # A used mixer, once reset, takes the same steps as a new one
+    used = solvers.AndersonMixing(3, 5)
+    x = np.zeros((3,))
+    for i in range(3):
+      used.update(x, np.dot(self.M, x) + self.b - x)
+    used.reset()
+
+    fresh = solvers.AndersonMixing(3, 5)
+    x1 = np.array([1.0,-2.0,0.5])
+    x2 = np.copy(x1)
+    for i in range(3):
+      used.update(x1, np.dot(self.M, x1) + self.b - x1)
+      fresh.update(x2, np.dot(self.M, x2) + self.b - x2)
+      self.assertTrue(np.allclose(x1, x2, rtol = 1.0e-14, atol = 0.0))
@@ -196,6 +196,15 @@ class CommonFlowRule(object):
 
     self.assertTrue(np.allclose(num, exact, rtol = 1.0e-3))
 
+  def test_evaluate(self):
+    stress = self.gen_stress()
+    hist = self.gen_hist()
+
+    res = self.model.evaluate(stress, hist, self.T)
+    for name, value in res.items():
+      should = getattr(self.model, name)(stress, hist, self.T)
+      self.assertTrue(np.allclose(value, should))
+
 
 class TestPerzynaIsoJ2Voce(unittest.TestCase, CommonFlowRule):
   def setUp(self):
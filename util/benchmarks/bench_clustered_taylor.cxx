@@ -0,0 +1,141 @@
+// Times the clustered reduced order Taylor model against the full Taylor
+// model on random FCC orientations and reports the error in the average
+// stress, with and without adaptive splitting.
+//
+//    bench_clustered_taylor [number of grains] [clusters] [steps]
+
+#include "cp/polycrystal.h"
+#include "cp/singlecrystal.h"
+#include "math/rotations.h"
+#include "math/nemlmath.h"
+#include "parse.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace neml;
+
+static const char * crystal = R"(
+<model type="SingleCrystalModel">
+  <kinematics type="StandardKinematicModel">
+    <emodel type="IsotropicLinearElasticModel">
+      <m1_type>youngs</m1_type>
+      <m1>100000.0</m1>
+      <m2_type>poissons</m2_type>
+      <m2>0.25</m2>
+    </emodel>
+    <imodel type="AsaroInelasticity">
+      <rule type="PowerLawSlipRule">
+        <resistance type="VoceSlipHardening">
+          <tau_sat>50.0</tau_sat>
+          <b>10.0</b>
+          <tau_0>50.0</tau_0>
+        </resistance>
+        <gamma0>1.0</gamma0>
+        <n>12.0</n>
+      </rule>
+    </imodel>
+  </kinematics>
+  <lattice type="CubicLattice">
+    <a>1.0</a>
+    <slip_systems>1 1 0 ; 1 1 1</slip_systems>
+  </lattice>
+</model>
+)";
+
+static std::shared_ptr<PolycrystalModel> make_model(
+    std::string type, std::shared_ptr<NEMLObject> model,
+    const std::vector<std::shared_ptr<NEMLObject>> & qs,
+    int nclusters, bool adaptive)
+{
+  ParameterSet params = Factory::Creator()->provide_parameters(type);
+  params.assign_parameter("model", model);
+  params.assign_parameter("qs", qs);
+  if (type == "ClusteredTaylorModel") {
+    params.assign_parameter("nclusters", nclusters);
+    params.assign_parameter("adaptive", adaptive);
+  }
+  return Factory::Creator()->create<PolycrystalModel>(params);
+}
+
+// Uniaxial tension, returning the history of the average stress
+static std::vector<double> run(PolycrystalModel & model, int steps,
+                               double & time)
+{
+  std::vector<double> h_n(model.nstore()), h_np1(model.nstore());
+  model.init_store(&h_n[0]);
+
+  double d[6] = {1.0e-3, -0.5e-3, -0.5e-3, 0, 0, 0};
+  double w[3] = {0, 0, 0};
+  double s_n[6] = {0}, s_np1[6], A[36], B[18];
+  double u_n = 0, u_np1, p_n = 0, p_np1;
+  std::vector<double> res;
+
+  auto t0 = std::chrono::steady_clock::now();
+  for (int i = 1; i <= steps; i++) {
+    model.update_ld_inc(d, d, w, w, 300.0, 300.0, i, i - 1, s_np1, s_n,
+                        &h_np1[0], &h_n[0], A, B, u_np1, u_n, p_np1, p_n);
+    std::copy(s_np1, s_np1+6, s_n);
+    std::copy(h_np1.begin(), h_np1.end(), h_n.begin());
+    u_n = u_np1;
+    p_n = p_np1;
+    res.insert(res.end(), s_np1, s_np1+6);
+  }
+  time = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - t0).count();
+
+  return res;
+}
+
+static double rel_error(const std::vector<double> & ref,
+                        const std::vector<double> & val, size_t i)
+{
+  double diff[6];
+  for (size_t j = 0; j < 6; j++) diff[j] = val[6*i+j] - ref[6*i+j];
+  return norm2_vec(diff, 6) / norm2_vec(&ref[6*i], 6);
+}
+
+static void report(const char * name, double time,
+                   const std::vector<double> & ref,
+                   const std::vector<double> & val)
+{
+  size_t steps = ref.size() / 6;
+  double e = 0.0;
+  for (size_t i = 0; i < steps; i++)
+    e = std::max(e, rel_error(ref, val, i));
+  printf("%-10s %10.4f s  max error %10.4g  final error %10.4g\n", name,
+         time, e, rel_error(ref, val, steps - 1));
+}
+
+int main(int argc, char** argv)
+{
+  size_t n = (argc > 1) ? std::atoi(argv[1]) : 500;
+  int k = (argc > 2) ? std::atoi(argv[2]) : 20;
+  int steps = (argc > 3) ? std::atoi(argv[3]) : 50;
+
+  auto model = get_object_string(crystal);
+  auto orientations = random_orientations(n);
+  std::vector<std::shared_ptr<NEMLObject>> qs;
+  for (auto q : orientations)
+    qs.push_back(std::make_shared<CrystalOrientation>(
+        make_crystal_orientation(q)));
+
+  auto full = make_model("TaylorModel", model, qs, 0, false);
+  auto clustered = make_model("ClusteredTaylorModel", model, qs, k, false);
+  auto adaptive = make_model("ClusteredTaylorModel", model, qs, k, true);
+
+  double t_full, t_clustered, t_adaptive;
+  auto s_full = run(*full, steps, t_full);
+  auto s_clustered = run(*clustered, steps, t_clustered);
+  auto s_adaptive = run(*adaptive, steps, t_adaptive);
+
+  printf("%zu grains, %d clusters, %d steps\n", n, k, steps);
+  report("Taylor", t_full, s_full, s_full);
+  report("clustered", t_clustered, s_full, s_clustered);
+  report("adaptive", t_adaptive, s_full, s_adaptive);
+
+  return 0;
+}
@@ -0,0 +1,116 @@
+// Times the fourth order rotation kernels against the generic paths they
+// replaced: the 3^8 index loop for RankFour and the BLAS A * B * A.T
+// product for SymSymR4.
+//
+//    bench_rotations [number of orientations] [repeats]
+
+#include "math/rotations.h"
+#include "math/nemlmath.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace neml;
+
+// The original full index transformation
+static void generic_fourth(const double * const M, const double * const A,
+                           double * const C)
+{
+  std::fill(C, C+81, 0.0);
+  for (size_t i = 0; i < 3; i++)
+    for (size_t j = 0; j < 3; j++)
+      for (size_t k = 0; k < 3; k++)
+        for (size_t l = 0; l < 3; l++)
+          for (size_t m = 0; m < 3; m++)
+            for (size_t n = 0; n < 3; n++)
+              for (size_t o = 0; o < 3; o++)
+                for (size_t p = 0; p < 3; p++)
+                  C[i*27+j*9+k*3+l] += M[3*i+m] * M[3*j+n] * M[3*k+o] *
+                      M[3*l+p] * A[m*27+n*9+o*3+p];
+}
+
+template <class F>
+static double time_it(int repeats, F f)
+{
+  auto t0 = std::chrono::steady_clock::now();
+  for (int r = 0; r < repeats; r++) f();
+  return std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - t0).count();
+}
+
+static double max_diff(const std::vector<double> & a,
+                       const std::vector<double> & b)
+{
+  double d = 0.0;
+  for (size_t i = 0; i < a.size(); i++)
+    d = std::max(d, std::fabs(a[i] - b[i]));
+  return d;
+}
+
+int main(int argc, char** argv)
+{
+  size_t n = (argc > 1) ? std::atoi(argv[1]) : 10000;
+  int repeats = (argc > 2) ? std::atoi(argv[2]) : 10;
+
+  auto orientations = random_orientations(n);
+  std::vector<double> q(4*n);
+  for (size_t i = 0; i < n; i++)
+    std::copy(orientations[i].quat(), orientations[i].quat()+4, &q[4*i]);
+
+  // A cubic stiffness and its full index version
+  double C1 = 160000.0, C2 = 90000.0, C3 = 2.0 * 46500.0;
+  std::vector<double> A(36, 0.0);
+  for (size_t i = 0; i < 3; i++)
+    for (size_t j = 0; j < 3; j++)
+      A[CINDEX(i,j,6)] = (i == j) ? C1 : C2;
+  for (size_t i = 3; i < 6; i++)
+    A[CINDEX(i,i,6)] = C3;
+  SymSymR4 As(A);
+  RankFour Af = As.to_full();
+
+  std::vector<double> old6(36*n), new6(36*n), batch6(36*n);
+  std::vector<double> old4(81*n), new4(81*n), batch4(81*n);
+
+  double t_old6 = time_it(repeats, [&]() {
+    double R[36];
+    for (size_t i = 0; i < n; i++) {
+      orientations[i].to_mandel(R);
+      rotate_matrix(6, 6, R, &A[0], &old6[36*i]);
+    }});
+  double t_new6 = time_it(repeats, [&]() {
+    for (size_t i = 0; i < n; i++) {
+      SymSymR4 res = orientations[i].apply(As);
+      std::copy(res.data(), res.data()+36, &new6[36*i]);
+    }});
+  double t_batch6 = time_it(repeats, [&]() {
+    rotate_symsym_batch(n, &q[0], &A[0], &batch6[0]);
+  });
+
+  double t_old4 = time_it(repeats, [&]() {
+    double M[9];
+    for (size_t i = 0; i < n; i++) {
+      orientations[i].to_matrix(M);
+      generic_fourth(M, Af.data(), &old4[81*i]);
+    }});
+  double t_new4 = time_it(repeats, [&]() {
+    for (size_t i = 0; i < n; i++) {
+      RankFour res = orientations[i].apply(Af);
+      std::copy(res.data(), res.data()+81, &new4[81*i]);
+    }});
+  double t_batch4 = time_it(repeats, [&]() {
+    rotate_fourth_batch(n, &q[0], Af.data(), &batch4[0]);
+  });
+
+  printf("%zu orientations, %d repeats\n", n, repeats);
+  printf("SymSymR4  BLAS %10.4f s  apply %10.4f s  batch %10.4f s  "
+         "max diff %g\n", t_old6, t_new6, t_batch6,
+         std::max(max_diff(old6, new6), max_diff(old6, batch6)));
+  printf("RankFour  loop %10.4f s  apply %10.4f s  batch %10.4f s  "
+         "max diff %g\n", t_old4, t_new4, t_batch4,
+         std::max(max_diff(old4, new4), max_diff(old4, batch4)));
+
+  return 0;
+}
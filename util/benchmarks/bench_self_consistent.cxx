@@ -0,0 +1,134 @@
+// Times the self-consistent polycrystal model against the Taylor model for
+// a plastically anisotropic HCP crystal, reporting the macroscale stress
+// and the self-consistent iterations per step.
+//
+//    bench_self_consistent [number of grains] [steps] [threads]
+//
+// e.g. run with 500 and 5000 grains
+
+#include "cp/polycrystal.h"
+#include "cp/singlecrystal.h"
+#include "math/rotations.h"
+#include "parse.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <vector>
+
+using namespace neml;
+
+// Soft basal and prismatic slip with hard pyramidal <c+a> slip
+static std::string crystal()
+{
+  std::stringstream ss;
+  ss << R"(
+<model type="SingleCrystalModel">
+  <kinematics type="StandardKinematicModel">
+    <emodel type="IsotropicLinearElasticModel">
+      <m1_type>youngs</m1_type>
+      <m1>110000.0</m1>
+      <m2_type>poissons</m2_type>
+      <m2>0.32</m2>
+    </emodel>
+    <imodel type="AsaroInelasticity">
+      <rule type="PowerLawSlipRule">
+        <resistance type="FixedStrengthHardening">
+          <strengths>)";
+  for (size_t i = 0; i < 18; i++) {
+    double tau = (i < 3) ? 60.0 : ((i < 6) ? 40.0 : 180.0);
+    ss << "<s" << i << " type=\"ConstantInterpolate\"><v>" << tau
+        << "</v></s" << i << ">";
+  }
+  ss << R"(</strengths>
+        </resistance>
+        <gamma0>1.0e-3</gamma0>
+        <n>12.0</n>
+      </rule>
+    </imodel>
+  </kinematics>
+  <lattice type="HCPLattice">
+    <a>0.29511</a>
+    <c>0.468433</c>
+    <slip_systems>1 1 -2 0 ; 0 0 0 1 , 1 1 -2 0 ; 1 0 -1 0 , 1 1 -2 -3 ; 1 1 -2 2</slip_systems>
+  </lattice>
+</model>
+)";
+  return ss.str();
+}
+
+static std::shared_ptr<PolycrystalModel> make_model(
+    std::string type, std::shared_ptr<NEMLObject> model,
+    const std::vector<std::shared_ptr<NEMLObject>> & qs, int nthreads)
+{
+  ParameterSet params = Factory::Creator()->provide_parameters(type);
+  params.assign_parameter("model", model);
+  params.assign_parameter("qs", qs);
+  params.assign_parameter("nthreads", nthreads);
+  return Factory::Creator()->create<PolycrystalModel>(params);
+}
+
+// Uniaxial extension in x at a constant rate
+static void run(const char * name, PolycrystalModel & model, int steps)
+{
+  std::vector<double> h_n(model.nstore()), h_np1(model.nstore());
+  model.init_store(&h_n[0]);
+
+  double rate = 1.0e-4;
+  double dt = 5.0;
+  double d_n[6] = {0}, d_np1[6];
+  double w[3] = {0, 0, 0};
+  double s_n[6] = {0}, s_np1[6], A[36], B[18];
+  double u_n = 0, u_np1, p_n = 0, p_np1;
+  size_t total = 0, most = 0;
+
+  auto t0 = std::chrono::steady_clock::now();
+  for (int i = 1; i <= steps; i++) {
+    double e = rate * dt * i;
+    double dv[6] = {e, -e/2, -e/2, 0, 0, 0};
+    std::copy(dv, dv+6, d_np1);
+    model.update_ld_inc(d_np1, d_n, w, w, 300.0, 300.0, dt * i,
+                        dt * (i - 1), s_np1, s_n, &h_np1[0], &h_n[0], A, B,
+                        u_np1, u_n, p_np1, p_n);
+    std::copy(d_np1, d_np1+6, d_n);
+    std::copy(s_np1, s_np1+6, s_n);
+    std::copy(h_np1.begin(), h_np1.end(), h_n.begin());
+    u_n = u_np1;
+    p_n = p_np1;
+
+    auto sc = dynamic_cast<SelfConsistentModel*>(&model);
+    if (sc) {
+      total += sc->iterations(&h_n[0]);
+      most = std::max(most, sc->iterations(&h_n[0]));
+    }
+  }
+  double time = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - t0).count();
+
+  printf("%-16s %10.4f s  sigma_xx %10.4f", name, time, s_n[0]);
+  if (total > 0)
+    printf("  iterations mean %5.2f max %zu", (double) total / steps, most);
+  printf("\n");
+}
+
+int main(int argc, char** argv)
+{
+  size_t n = (argc > 1) ? std::atoi(argv[1]) : 500;
+  int steps = (argc > 2) ? std::atoi(argv[2]) : 40;
+  int nthreads = (argc > 3) ? std::atoi(argv[3]) : 1;
+
+  auto model = get_object_string(crystal());
+  auto orientations = random_orientations(n);
+  std::vector<std::shared_ptr<NEMLObject>> qs;
+  for (auto q : orientations)
+    qs.push_back(std::make_shared<CrystalOrientation>(
+        make_crystal_orientation(q)));
+
+  printf("%zu grains, %d steps, %d threads\n", n, steps, nthreads);
+  run("Taylor", *make_model("TaylorModel", model, qs, nthreads), steps);
+  run("self-consistent",
+      *make_model("SelfConsistentModel", model, qs, nthreads), steps);
+
+  return 0;
+}
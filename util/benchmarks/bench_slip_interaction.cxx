@@ -0,0 +1,153 @@
+// Times GeneralLinearHardening with a dense interaction matrix against the
+// same model with a typed SlipInteractionMatrix for the FCC, BCC and HCP
+// slip system sets, and checks the two agree.  Also times the bare matrix
+// products on an n x n block, the size used for d_hist_d_h.
+//
+//    bench_slip_interaction [repeats]
+
+#include "cp/slipharden.h"
+#include "cp/sliprules.h"
+#include "parse.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <vector>
+
+using namespace neml;
+
+static const char * names[] = {"self", "coplanar", "collinear", "orthogonal",
+  "glissile", "sessile"};
+
+template <class F>
+static double time_it(int repeats, F f)
+{
+  auto t0 = std::chrono::steady_clock::now();
+  for (int r = 0; r < repeats; r++) f();
+  return std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - t0).count();
+}
+
+static std::string hardening(const std::string & matrix, size_t n)
+{
+  std::stringstream ss;
+  ss << "<h type=\"GeneralLinearHardening\">" << matrix << "<tau_0>";
+  for (size_t i = 0; i < n; i++) ss << "50.0 ";
+  ss << "</tau_0></h>";
+  return ss.str();
+}
+
+static std::shared_ptr<SlipRule> slip_rule(std::shared_ptr<NEMLObject> h)
+{
+  ParameterSet params = Factory::Creator()->provide_parameters(
+      "PowerLawSlipRule");
+  params.assign_parameter("resistance", h);
+  params.assign_parameter("gamma0", get_object_string(
+          "<g type=\"ConstantInterpolate\"><v>1.0e-3</v></g>"));
+  params.assign_parameter("n", get_object_string(
+          "<n type=\"ConstantInterpolate\"><v>5.0</v></n>"));
+  return Factory::Creator()->create<SlipRule>(params);
+}
+
+static double max_diff(const History & a, const History & b)
+{
+  double d = 0.0;
+  for (size_t i = 0; i < a.size(); i++)
+    d = std::max(d, std::fabs(a.rawptr()[i] - b.rawptr()[i]));
+  return d;
+}
+
+static void run(const char * name, const std::string & lattice, int repeats)
+{
+  auto L = std::dynamic_pointer_cast<Lattice>(get_object_string(lattice));
+  size_t n = L->ntotal();
+
+  std::string typed_xml = "<M type=\"SlipInteractionMatrix\">" + lattice +
+      "<coefficients>1.22 1.22 6.25 0.7 1.37 1.22</coefficients></M>";
+  auto typed = std::dynamic_pointer_cast<SlipInteractionMatrix>(
+      get_object_string(typed_xml));
+  std::stringstream dense_xml;
+  dense_xml.precision(17);
+  dense_xml << "<M type=\"SquareMatrix\"><m>" << n
+      << "</m><type>dense</type><data>";
+  for (size_t i = 0; i < n * n; i++) dense_xml << typed->data()[i] << " ";
+  dense_xml << "</data></M>";
+
+  auto hd = std::dynamic_pointer_cast<SlipHardening>(
+      get_object_string(hardening(dense_xml.str(), n)));
+  auto ht = std::dynamic_pointer_cast<SlipHardening>(
+      get_object_string(hardening(typed_xml, n)));
+  auto Rd = slip_rule(hd);
+  auto Rt = slip_rule(ht);
+
+  History h, fixed;
+  Rd->populate_history(h);
+  Rd->init_history(h);
+
+  Symmetric s(std::vector<double>({100.0, -25.0, 10.0, 15.0, -17.0, 35.0}));
+  Orientation Q = Orientation::createEulerAngles(0.61, 0.3, 0.24);
+  double T = 300.0;
+
+  std::vector<size_t> counts = typed->counts();
+  printf("%s, %zu systems:", name, n);
+  for (size_t t = 0; t < SlipInteractionMatrix::ntypes; t++)
+    printf(" %s %zu", names[t], counts[t]);
+  printf("\n");
+
+  double diff = 0.0;
+  diff = std::max(diff, max_diff(hd->hist(s, Q, h, *L, T, *Rd, fixed),
+                                 ht->hist(s, Q, h, *L, T, *Rt, fixed)));
+  diff = std::max(diff, max_diff(hd->d_hist_d_s(s, Q, h, *L, T, *Rd, fixed),
+                                 ht->d_hist_d_s(s, Q, h, *L, T, *Rt, fixed)));
+  diff = std::max(diff, max_diff(hd->d_hist_d_h(s, Q, h, *L, T, *Rd, fixed),
+                                 ht->d_hist_d_h(s, Q, h, *L, T, *Rt, fixed)));
+
+  for (auto m : {std::make_pair(hd, Rd), std::make_pair(ht, Rt)}) {
+    auto H = m.first;
+    auto R = m.second;
+    double th = time_it(repeats, [&]{H->hist(s, Q, h, *L, T, *R, fixed);});
+    double ts = time_it(repeats, [&]{H->d_hist_d_s(s, Q, h, *L, T, *R, fixed);});
+    double tt = time_it(repeats, [&]{H->d_hist_d_h(s, Q, h, *L, T, *R, fixed);});
+    printf("  %-6s hist %8.2f us  d_hist_d_s %8.2f us  d_hist_d_h %9.2f us\n",
+           (H == hd) ? "dense" : "typed", 1.0e6 * th / repeats,
+           1.0e6 * ts / repeats, 1.0e6 * tt / repeats);
+  }
+  printf("  max difference %e\n", diff);
+
+  // The products alone
+  std::vector<double> v(n * n), rd(n * n), rt(n * n);
+  for (size_t i = 0; i < n * n; i++) v[i] = std::sin(1.0 + i);
+  const double * M = typed->data();
+  double td = time_it(repeats, [&]{
+    std::fill(rd.begin(), rd.end(), 0.0);
+    for (size_t i = 0; i < n; i++)
+      for (size_t j = 0; j < n; j++)
+        for (size_t l = 0; l < n; l++)
+          rd[i*n+l] += M[i*n+j] * v[j*n+l];
+  });
+  double tt = time_it(repeats, [&]{typed->apply(&v[0], &rt[0], n);});
+  double pd = 0.0;
+  for (size_t i = 0; i < n * n; i++) pd = std::max(pd, std::fabs(rd[i] - rt[i]));
+  printf("  product  dense %8.2f us  typed %8.2f us  (%zu of %zu pairs "
+         "visited)  max difference %e\n", 1.0e6 * td / repeats,
+         1.0e6 * tt / repeats, typed->npairs(), n * n, pd);
+}
+
+int main(int argc, char** argv)
+{
+  int repeats = (argc > 1) ? std::atoi(argv[1]) : 1000;
+
+  run("FCC", "<lattice type=\"CubicLattice\"><a>1.0</a>"
+      "<slip_systems>1 1 0 ; 1 1 1</slip_systems></lattice>", repeats);
+  run("BCC", "<lattice type=\"CubicLattice\"><a>1.0</a>"
+      "<slip_systems>1 1 1 ; 1 1 0 , 1 1 1 ; 1 1 2 , 1 1 1 ; 1 2 3"
+      "</slip_systems></lattice>", repeats);
+  run("HCP", "<lattice type=\"HCPLattice\"><a>0.29511</a><c>0.468433</c>"
+      "<slip_systems>1 1 -2 0 ; 0 0 0 1 , 1 1 -2 0 ; 1 0 -1 0 , "
+      "1 1 -2 0 ; 1 0 -1 1 , 1 1 -2 3 ; 1 0 -1 1 , 1 1 -2 3 ; 1 1 -2 2"
+      "</slip_systems></lattice>", repeats);
+
+  return 0;
+}
@@ -0,0 +1,128 @@
+// Times the monolithic and the staggered single crystal integration for a
+// BCC crystal with 48 slip systems and latent hardening, and reports the
+// difference in the final stress and history.
+//
+//    bench_staggered_crystal [steps] [time step]
+
+#include "cp/singlecrystal.h"
+#include "parse.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <vector>
+
+using namespace neml;
+
+static std::string crystal(const std::string & integration)
+{
+  std::stringstream ss;
+  ss << R"(
+<model type="SingleCrystalModel">
+  <kinematics type="StandardKinematicModel">
+    <emodel type="IsotropicLinearElasticModel">
+      <m1_type>youngs</m1_type>
+      <m1>200000.0</m1>
+      <m2_type>poissons</m2_type>
+      <m2>0.3</m2>
+    </emodel>
+    <imodel type="AsaroInelasticity">
+      <rule type="PowerLawSlipRule">
+        <resistance type="GeneralLinearHardening">
+          <M type="SlipInteractionMatrix">
+            <lattice type="CubicLattice">
+              <a>1.0</a>
+              <slip_systems>1 1 1 ; 1 1 0 , 1 1 1 ; 1 1 2 , 1 1 1 ; 1 2 3</slip_systems>
+            </lattice>
+            <coefficients>100.0 100.0 400.0 50.0 120.0 150.0</coefficients>
+          </M>
+          <tau_0>)";
+  for (size_t i = 0; i < 48; i++) ss << "80.0 ";
+  ss << R"(</tau_0>
+        </resistance>
+        <gamma0>1.0e-3</gamma0>
+        <n>12.0</n>
+      </rule>
+    </imodel>
+  </kinematics>
+  <lattice type="CubicLattice">
+    <a>1.0</a>
+    <slip_systems>1 1 1 ; 1 1 0 , 1 1 1 ; 1 1 2 , 1 1 1 ; 1 2 3</slip_systems>
+  </lattice>
+  <initial_rotation type="CrystalOrientation">
+    <angles>0.61 0.3 0.24</angles>
+    <angle_type>radians</angle_type>
+    <angle_convention>kocks</angle_convention>
+  </initial_rotation>
+  <integration>)" << integration << R"(</integration>
+</model>
+)";
+  return ss.str();
+}
+
+// Uniaxial extension in x at a constant rate
+static double run(const char * name, NEMLModel_ldi & model, int steps,
+                  double dt, std::vector<double> & result)
+{
+  std::vector<double> h_n(model.nstore()), h_np1(model.nstore());
+  model.init_store(&h_n[0]);
+
+  double rate = 1.0e-4;
+  double d_n[6] = {0}, d_np1[6];
+  double w[3] = {0, 0, 0};
+  double s_n[6] = {0}, s_np1[6], A[36], B[18];
+  double u_n = 0, u_np1, p_n = 0, p_np1;
+
+  auto t0 = std::chrono::steady_clock::now();
+  for (int i = 1; i <= steps; i++) {
+    double e = rate * dt * i;
+    double dv[6] = {e, -e/2, -e/2, 0, 0, 0};
+    std::copy(dv, dv+6, d_np1);
+    model.update_ld_inc(d_np1, d_n, w, w, 300.0, 300.0, dt * i,
+                        dt * (i - 1), s_np1, s_n, &h_np1[0], &h_n[0], A, B,
+                        u_np1, u_n, p_np1, p_n);
+    std::copy(d_np1, d_np1+6, d_n);
+    std::copy(s_np1, s_np1+6, s_n);
+    std::copy(h_np1.begin(), h_np1.end(), h_n.begin());
+    u_n = u_np1;
+    p_n = p_np1;
+  }
+  double time = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - t0).count();
+
+  printf("%-12s %10.4f s  sigma_xx %10.4f\n", name, time, s_n[0]);
+
+  result.assign(s_n, s_n+6);
+  result.insert(result.end(), h_n.begin(), h_n.end());
+
+  return time;
+}
+
+int main(int argc, char** argv)
+{
+  int steps = (argc > 1) ? std::atoi(argv[1]) : 200;
+  double dt = (argc > 2) ? std::atof(argv[2]) : 1.0;
+
+  auto mono = std::dynamic_pointer_cast<NEMLModel_ldi>(
+      get_object_string(crystal("monolithic")));
+  auto stag = std::dynamic_pointer_cast<NEMLModel_ldi>(
+      get_object_string(crystal("staggered")));
+
+  printf("BCC, 48 slip systems, %d steps of %g s\n", steps, dt);
+  std::vector<double> rm, rs;
+  double tm = run("monolithic", *mono, steps, dt, rm);
+  double ts = run("staggered", *stag, steps, dt, rs);
+
+  double diff = 0.0, scale = 0.0;
+  for (size_t i = 0; i < rm.size(); i++) {
+    diff = std::max(diff, std::fabs(rm[i] - rs[i]));
+    scale = std::max(scale, std::fabs(rm[i]));
+  }
+  printf("speedup %5.2f, max relative difference %e\n", tm / ts,
+         diff / scale);
+
+  return 0;
+}
@@ -0,0 +1,135 @@
+// Checks that ClusteredTaylorModel treats symmetrically equivalent
+// orientations as the same grain.  Orientations are active, so the
+// equivalents of Q are Q * S for the symmetry operations S of the lattice.
+// The check confirms that
+//    1) Q and Q * S give the same single crystal response,
+//    2) ClusteredTaylorModel::distance between them is zero, and
+//    3) replacing a grain by a symmetric equivalent does not change the
+//       clustered response.
+//
+// Returns nonzero if any of these fail.
+
+#include "cp/polycrystal.h"
+#include "parse.h"
+
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace neml;
+
+static const std::string crystal_xml = R"(
+<model type="SingleCrystalModel">
+  <kinematics type="StandardKinematicModel">
+    <emodel type="CubicLinearElasticModel">
+      <m1>120000.0</m1><m2>0.3</m2><m3>29000.0</m3><method>moduli</method>
+    </emodel>
+    <imodel type="AsaroInelasticity">
+      <rule type="PowerLawSlipRule">
+        <resistance type="VoceSlipHardening">
+          <tau_sat>50.0</tau_sat><b>2.5</b><tau_0>10.0</tau_0>
+        </resistance>
+        <gamma0>1.0</gamma0><n>3.0</n>
+      </rule>
+    </imodel>
+  </kinematics>
+  <lattice type="CubicLattice">
+    <a>1.0</a><slip_systems>1 1 0 ; 1 1 1</slip_systems>
+  </lattice>
+  <update_rotation>false</update_rotation>
+</model>
+)";
+
+static std::shared_ptr<NEMLObject> crystal_orientation(const Orientation & q)
+{
+  return std::make_shared<CrystalOrientation>(make_crystal_orientation(q));
+}
+
+static std::shared_ptr<PolycrystalModel> polycrystal(
+    std::shared_ptr<NEMLObject> crystal, const std::vector<Orientation> & qs,
+    int nclusters)
+{
+  std::vector<std::shared_ptr<NEMLObject>> objs;
+  for (auto & q : qs) objs.push_back(crystal_orientation(q));
+
+  std::string type = nclusters > 0 ? "ClusteredTaylorModel" : "TaylorModel";
+  ParameterSet params = Factory::Creator()->provide_parameters(type);
+  params.assign_parameter("model", crystal);
+  params.assign_parameter("qs", objs);
+  if (nclusters > 0) params.assign_parameter("nclusters", nclusters);
+
+  return Factory::Creator()->create<PolycrystalModel>(params);
+}
+
+// Stress after a few steps of a fixed deformation rate
+static std::vector<double> drive(std::shared_ptr<PolycrystalModel> model)
+{
+  double D[6] = {0.02, -0.01, -0.006, 0.02, 0.04, -0.006};
+  double dt = 2.0;
+  double T = 300.0;
+
+  std::vector<double> h_n(model->nstore()), h_np1(model->nstore());
+  model->init_store(&h_n[0]);
+  double d_n[6] = {0}, d_np1[6], w[3] = {0};
+  double s_n[6] = {0}, s_np1[6], A[36], B[18], u, p;
+
+  for (int i = 0; i < 3; i++) {
+    for (size_t j = 0; j < 6; j++) d_np1[j] = d_n[j] + D[j] * dt;
+    model->update_ld_inc(d_np1, d_n, w, w, T, T, (i+1) * dt, i * dt,
+                         s_np1, s_n, &h_np1[0], &h_n[0], A, B, u, 0.0,
+                         p, 0.0);
+    std::copy(d_np1, d_np1+6, d_n);
+    std::copy(s_np1, s_np1+6, s_n);
+    h_n = h_np1;
+  }
+
+  return std::vector<double>(s_n, s_n+6);
+}
+
+static double rel_diff(const std::vector<double> & a,
+                       const std::vector<double> & b)
+{
+  double d = 0.0, m = 0.0;
+  for (size_t i = 0; i < a.size(); i++) {
+    d = std::fmax(d, std::fabs(a[i] - b[i]));
+    m = std::fmax(m, std::fabs(b[i]));
+  }
+  return d / m;
+}
+
+int main()
+{
+  auto crystal = get_object_string(crystal_xml);
+  auto ops = std::dynamic_pointer_cast<SingleCrystalModel>(
+      crystal)->symmetry()->ops();
+
+  std::vector<Orientation> qs;
+  for (int i = 0; i < 6; i++)
+    qs.push_back(Orientation::createEulerAngles(35.0 * i, 17.0 * i * i,
+                                                14.0 * i + 5.0, "degrees"));
+
+  // A nontrivial operation, so Q * S and S * Q differ from Q
+  const Orientation & S = ops[5];
+  Orientation QS = qs[3] * S;
+
+  // 1) The equivalent really is equivalent
+  double ds = rel_diff(drive(polycrystal(crystal, {qs[3]}, 0)),
+                       drive(polycrystal(crystal, {QS}, 0)));
+
+  // 2) And is at zero distance
+  auto pair = std::dynamic_pointer_cast<ClusteredTaylorModel>(
+      polycrystal(crystal, {qs[3], QS}, 1));
+  double dist = pair->distance(0, 1);
+
+  // 3) Replacing a grain by its equivalent does not change the clusters
+  std::vector<Orientation> replaced(qs);
+  replaced[3] = QS;
+  double dc = rel_diff(drive(polycrystal(crystal, qs, 3)),
+                       drive(polycrystal(crystal, replaced, 3)));
+
+  std::printf("equivalent stress %.2e, distance %.2e, clustered %.2e\n",
+              ds, dist, dc);
+
+  return ((ds < 1.0e-10) && (dist < 1.0e-6) && (dc < 1.0e-10)) ? 0 : 1;
+}
@@ -0,0 +1,108 @@
+// Checks that the GeneralIntegrator Newton update and tangent from the
+// condensed history solve match a dense LU solve and inverse of the same
+// jacobian.  Uses a Chaboche model with three backstresses, which declares
+// one history block per backstress coupled through the flow direction.
+//
+// Returns nonzero if the two disagree.
+
+#include "models.h"
+#include "parse.h"
+#include "solvers.h"
+#include "math/nemlmath.h"
+
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace neml;
+
+static const std::string model_xml = R"(
+<model type="GeneralIntegrator">
+  <elastic type="IsotropicLinearElasticModel">
+    <m1>60384.61</m1><m1_type>shear</m1_type>
+    <m2>130833.3</m2><m2_type>bulk</m2_type>
+  </elastic>
+  <rule type="TVPFlowRule">
+    <elastic type="IsotropicLinearElasticModel">
+      <m1>60384.61</m1><m1_type>shear</m1_type>
+      <m2>130833.3</m2><m2_type>bulk</m2_type>
+    </elastic>
+    <flow type="ChabocheFlowRule">
+      <surface type="IsoKinJ2"/>
+      <hardening type="Chaboche">
+        <iso type="VoceIsotropicHardeningRule">
+          <s0>10.0</s0><R>80.0</R><d>3.0</d>
+        </iso>
+        <C><C1>135.0e3</C1><C2>61.0e3</C2><C3>11.0e3</C3></C>
+        <gmodels>
+          <g1 type="SatGamma"><gs>400.0</gs><g0>5000.0</g0><beta>5.0</beta></g1>
+          <g2 type="ConstantGamma"><g>1100.0</g></g2>
+          <g3 type="SatGamma"><gs>1.0</gs><g0>20.0</g0><beta>2.0</beta></g3>
+        </gmodels>
+        <A><A1>1.0e-4</A1><A2>2.0e-5</A2><A3>0.0</A3></A>
+        <a><a1>2.0</a1><a2>1.5</a2><a3>1.0</a3></a>
+      </hardening>
+      <fluidity type="ConstantFluidity"><eta>701.0</eta></fluidity>
+      <n>10.5</n>
+    </flow>
+  </rule>
+</model>
+)";
+
+static double max_diff(const std::vector<double> & a,
+                       const std::vector<double> & b)
+{
+  double d = 0.0;
+  double m = 0.0;
+  for (size_t i = 0; i < a.size(); i++) {
+    d = std::fmax(d, std::fabs(a[i] - b[i]));
+    m = std::fmax(m, std::fabs(b[i]));
+  }
+  return d / m;
+}
+
+int main()
+{
+  auto model = std::dynamic_pointer_cast<GeneralIntegrator>(
+      get_object_string(model_xml));
+
+  size_t n = model->nparams();
+  size_t nh = model->nhist();
+
+  double e_n[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+  double e_np1[6] = {0.012, -0.005, -0.004, 0.003, 0.006, -0.008};
+  double s_n[6] = {150.0, -80.0, 20.0, 30.0, 15.0, -40.0};
+  std::vector<double> h_n(nh, 0.0);
+  h_n[0] = 0.05;
+  for (size_t i = 1; i < nh; i++) {
+    h_n[i] = 10.0 * std::sin(3.0 * i);
+  }
+
+  GITrialState ts;
+  model->make_trial_state(e_np1, e_n, 450.0, 300.0, 1.0, 0.0, s_n, &h_n[0],
+                          ts);
+
+  // The converged step, which itself uses the condensed Newton updates
+  std::vector<double> x(n);
+  solve(model.get(), &x[0], &ts, {1.0e-8, 1.0e-6, 50, false, false});
+
+  std::vector<double> R(n), J(n*n);
+  model->RJ(&x[0], &ts, &R[0], &J[0]);
+
+  // Newton update
+  std::vector<double> dense(R), condensed(R);
+  solve_mat(&J[0], n, &dense[0]);
+  model->linear_solve(&J[0], &ts, &condensed[0]);
+  double du = max_diff(condensed, dense);
+
+  // Tangent
+  std::vector<double> Ad(J), Ac(J);
+  invert_mat(&Ad[0], n);
+  model->invert_jacobian(&Ac[0], &ts);
+  double dA = max_diff(Ac, Ad);
+
+  std::printf("%zu history, update %.2e, inverse %.2e\n", nh, du, dA);
+
+  return ((du < 1.0e-10) && (dA < 1.0e-10)) ? 0 : 1;
+}
@@ -0,0 +1,81 @@
+// Checks that evaluating the isotropic-only yield surfaces, which adapt the
+// isotropic + kinematic surfaces, does not touch the heap.  Counts calls to
+// the global operator new while calling every YieldSurface method.
+//
+// Returns nonzero if any method allocates.
+
+#include "surfaces.h"
+#include "parse.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+static size_t allocations = 0;
+
+void * operator new(std::size_t n)
+{
+  allocations++;
+  void * p = std::malloc(n ? n : 1);
+  if (p == nullptr) throw std::bad_alloc();
+  return p;
+}
+
+void * operator new[](std::size_t n)
+{
+  return operator new(n);
+}
+
+void operator delete(void * p) noexcept
+{
+  std::free(p);
+}
+
+void operator delete[](void * p) noexcept
+{
+  std::free(p);
+}
+
+using namespace neml;
+
+static bool check(const std::string & name, const std::string & xml)
+{
+  auto surface = std::dynamic_pointer_cast<YieldSurface>(
+      get_object_string(xml));
+
+  size_t nh = surface->nhist();
+  double s[6] = {100.0, -25.0, 10.0, 15.0, -17.0, 35.0};
+  double q[7] = {-50.0, 10.0, -5.0, 2.0, 3.0, -1.0, 4.0};
+  double T = 300.0;
+
+  double fv;
+  double ds[6], dq[7], dsds[36], dqdq[49], dsdq[42], dqds[42];
+
+  allocations = 0;
+  surface->f(s, q, T, fv);
+  surface->df_ds(s, q, T, ds);
+  surface->df_dq(s, q, T, dq);
+  surface->df_dsds(s, q, T, dsds);
+  surface->df_dqdq(s, q, T, dqdq);
+  surface->df_dsdq(s, q, T, dsdq);
+  surface->df_dqds(s, q, T, dqds);
+  size_t count = allocations;
+
+  std::printf("%-12s %zu history, %zu allocations\n",
+              name.c_str(), nh, count);
+  return count == 0;
+}
+
+int main()
+{
+  bool ok = true;
+
+  ok &= check("IsoJ2", "<y type=\"IsoJ2\"/>");
+  ok &= check("IsoKinJ2", "<y type=\"IsoKinJ2\"/>");
+  ok &= check("IsoJ2I1", "<y type=\"IsoJ2I1\"><h>1.5</h><l>2.0</l></y>");
+  ok &= check("IsoKinJ2I1",
+              "<y type=\"IsoKinJ2I1\"><h>1.5</h><l>2.0</l></y>");
+
+  return ok ? 0 : 1;
+}